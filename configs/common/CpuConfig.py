@@ -34,12 +34,16 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from m5 import fatal
+from m5.params import NULL
 import m5.objects
 
 def config_etrace(cpu_cls, cpu_list, options):
     if issubclass(cpu_cls, m5.objects.DerivO3CPU):
-        # Assign the same file name to all cpus for now. This must be
-        # revisited when creating elastic traces for multi processor systems.
+        # The trace files of each cpu are prefixed with the name of its
+        # trace listener. With several cpus, their listeners share a sync
+        # domain recording the order of the synchronization operations so
+        # that the traces can be replayed together.
+        sync = m5.objects.TraceSync() if len(cpu_list) > 1 else NULL
         for cpu in cpu_list:
             # Attach the elastic trace probe listener. Set the protobuf trace
             # file names. Set the dependency window size equal to the cpu it
@@ -47,7 +51,8 @@ def config_etrace(cpu_cls, cpu_list, options):
             cpu.traceListener = m5.objects.ElasticTrace(
                                 instFetchTraceFile = options.inst_trace_file,
                                 dataDepTraceFile = options.data_trace_file,
-                                depWindowSize = 3 * cpu.numROBEntries)
+                                depWindowSize = 3 * cpu.numROBEntries,
+                                sync = sync)
             # Make the number of entries in the ROB, LQ and SQ very
             # large so that there are no stalls due to resource
             # limitation as such stalls will get captured in the trace
@@ -56,6 +61,18 @@ def config_etrace(cpu_cls, cpu_list, options):
             cpu.numROBEntries = 512;
             cpu.LQEntries = 128;
             cpu.SQEntries = 128;
+    elif issubclass(cpu_cls, m5.objects.BaseAtomicSimpleCPU):
+        sync = m5.objects.TraceSync() if len(cpu_list) > 1 else NULL
+        for cpu in cpu_list:
+            # The atomic cpu has no instruction window of its own, so the
+            # dependency window is the one the O3 probe uses for an O3 cpu
+            # with the default 192 ROB entries.
+            cpu.traceListener = m5.objects.AtomicElasticTrace(
+                                instFetchTraceFile = options.inst_trace_file,
+                                dataDepTraceFile = options.data_trace_file,
+                                depWindowSize = 3 * 192,
+                                sync = sync)
     else:
         fatal("%s does not support data dependency tracing. Use a CPU model of"
-              " type or inherited from DerivO3CPU.", cpu_cls)
+              " type or inherited from DerivO3CPU or AtomicSimpleCPU.",
+              cpu_cls)
@@ -269,6 +269,12 @@ def addCommonOptions(parser):
                         help="""Data dependency trace file input to
                       Elastic Trace probe in a capture simulation and
                       Trace CPU in a replay simulation""", default="")
+    parser.add_argument("--inst-trace-start-chunk", type=int, default=0,
+                        help="""Chunk of a zstd compressed instruction
+                      fetch trace to start replaying from""")
+    parser.add_argument("--data-trace-start-chunk", type=int, default=0,
+                        help="""Chunk of a zstd compressed data dependency
+                      trace to start replaying from""")
 
     # dist-gem5 options
     parser.add_argument("--dist", action="store_true",
@@ -63,15 +63,26 @@ if args.cpu_type != "TraceCPU":
     fatal("This is a script for elastic trace replay simulation, use "\
             "--cpu-type=TraceCPU\n");
 
-if args.num_cpus > 1:
-    fatal("This script does not support multi-processor trace replay.\n")
+np = args.num_cpus
+
+# For multi-processor replay, the trace file names are patterns in which %d
+# is replaced by the cpu index, e.g. system.cpu%d.traceListener.data.proto.gz
+if np > 1 and not ('%d' in args.inst_trace_file and
+                   '%d' in args.data_trace_file):
+    fatal("Multi-processor trace replay needs trace file names with %d "\
+          "standing for the cpu index.\n")
+
+# The recorded order of the synchronization operations starts with the
+# first ones in the traces
+if np > 1 and (args.inst_trace_start_chunk or args.data_trace_start_chunk):
+    fatal("Multi-processor traces can only be replayed from the start.\n")
 
 # In this case FutureClass will be None as there is not fast forwarding or
 # switching
 (CPUClass, test_mem_mode, FutureClass) = Simulation.setCPUClass(args)
 CPUClass.numThreads = numThreads
 
-system = System(cpu = CPUClass(cpu_id=0),
+system = System(cpu = [CPUClass(cpu_id=i) for i in range(np)],
                 mem_mode = test_mem_mode,
                 mem_ranges = [AddrRange(args.mem_size)],
                 cache_line_size = args.cacheline_size)
@@ -103,9 +114,20 @@ for cpu in system.cpu:
 for cpu in system.cpu:
     cpu.createThreads()
 
-# Assign input trace files to the Trace CPU
-system.cpu.instTraceFile=args.inst_trace_file
-system.cpu.dataTraceFile=args.data_trace_file
+# Assign input trace files to the Trace CPUs
+if np == 1:
+    system.cpu[0].instTraceFile = args.inst_trace_file
+    system.cpu[0].dataTraceFile = args.data_trace_file
+    system.cpu[0].instTraceStartChunk = args.inst_trace_start_chunk
+    system.cpu[0].dataTraceStartChunk = args.data_trace_start_chunk
+else:
+    # Replay the synchronization operations of the threads in the order
+    # recorded when capturing the traces
+    system.trace_sync = TraceSync()
+    for i, cpu in enumerate(system.cpu):
+        cpu.instTraceFile = args.inst_trace_file % i
+        cpu.dataTraceFile = args.data_trace_file % i
+        cpu.sync = system.trace_sync
 
 # Configure the classic memory system args
 MemClass = Simulation.setMemClass(args)
@@ -278,5 +278,22 @@ system.workload = SEWorkload.init_compatible(mp0_path)
 if args.wait_gdb:
     system.workload.wait_for_remote_gdb = True
 
+if (ObjectList.is_kvm_cpu(CPUClass) or ObjectList.is_kvm_cpu(FutureClass)) \
+        and np > 1:
+    # Run the threads of the guest on different host cores by giving each
+    # KVM CPU its own event queue. This has to be done after creating
+    # caches and other child objects since these mustn't inherit the CPU
+    # event queue. Syscalls are then executed at global barriers.
+    for i, cpu in enumerate(system.cpu):
+        for obj in cpu.descendants():
+            obj.eventq_index = 0
+        cpu.eventq_index = i + 1
+
 root = Root(full_system = False, system = system)
+
+if (ObjectList.is_kvm_cpu(CPUClass) or ObjectList.is_kvm_cpu(FutureClass)) \
+        and np > 1:
+    # Uses gem5's parallel event queue feature. Each syscall is delayed
+    # by up to a quantum, so keep it short compared to the one fs.py uses.
+    root.sim_quantum = int(1e7) # 10 us
 Simulation.run(args, root, system, FutureClass)
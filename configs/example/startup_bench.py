@@ -0,0 +1,123 @@
+# Copyright (c) 2026 The Regents of The University of Michigan
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script measures how long it takes to get to the first simulated
+# tick, i.e. the time spent creating, connecting and initialising the
+# SimObjects of a large configuration. The generated system is made of
+# clusters of memory testers with private L1 caches sharing an L2, all
+# connected to a single memory through a coherent crossbar.
+
+import argparse
+import cProfile
+import pstats
+import time
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath('../')
+
+from common.Caches import L1_DCache, L2Cache
+
+parser = argparse.ArgumentParser(
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+
+parser.add_argument("--clusters", type=int, default=32,
+                    help="Number of L2 clusters")
+parser.add_argument("--testers", type=int, default=8,
+                    help="Number of testers (with an L1 each) per cluster")
+parser.add_argument("--profile", action="store_true",
+                    help="Split the instantiation time between Python code "
+                    "and native code (gem5 C++ and Python builtins)")
+
+args = parser.parse_args()
+
+start = time.time()
+
+system = System(physmem = SimpleMemory(), mem_mode = 'timing')
+system.voltage_domain = VoltageDomain(voltage = '1V')
+system.clk_domain = SrcClockDomain(clock = '2GHz',
+                                   voltage_domain = system.voltage_domain)
+
+system.membus = SystemXBar(point_of_coherency = True)
+system.membus.mem_side_ports = system.physmem.port
+system.system_port = system.membus.cpu_side_ports
+
+clusters = []
+for c in range(args.clusters):
+    cluster = SubSystem()
+    cluster.tester = [ MemTest(max_loads = 1) for t in range(args.testers) ]
+    cluster.l1 = [ L1_DCache() for t in range(args.testers) ]
+    cluster.xbar = L2XBar()
+    cluster.l2 = L2Cache()
+
+    for tester, l1 in zip(cluster.tester, cluster.l1):
+        tester.port = l1.cpu_side
+        l1.mem_side = cluster.xbar.cpu_side_ports
+    cluster.xbar.mem_side_ports = cluster.l2.cpu_side
+    cluster.l2.mem_side = system.membus.cpu_side_ports
+
+    clusters.append(cluster)
+system.cluster = clusters
+
+root = Root(full_system = False, system = system)
+
+configured = time.time()
+if args.profile:
+    profiler = cProfile.Profile()
+    profiler.enable()
+m5.instantiate()
+if args.profile:
+    profiler.disable()
+instantiated = time.time()
+m5.simulate(1)
+first_tick = time.time()
+
+print("SimObjects:        %d" % len(list(root.descendants())))
+print("Configuration:     %.3fs" % (configured - start))
+print("Instantiation:     %.3fs" % (instantiated - configured))
+print("First tick:        %.3fs" % (first_tick - configured))
+
+if args.profile:
+    # Native functions (pybind-wrapped C++ and Python builtins) have no
+    # source file, everything else is Python code. Only the latter is
+    # affected by changes to the Python SimObject layer.
+    python = 0
+    native = 0
+    stats = pstats.Stats(profiler).stats
+    for (filename, _, _), (_, _, tottime, _, _) in stats.items():
+        if filename == "~":
+            native += tottime
+        else:
+            python += tottime
+    total = python + native
+    print("Python code:       %.3fs (%.0f%%)" %
+          (python, 100 * python / total if total else 0))
+    print("Native code:       %.3fs (%.0f%%)" %
+          (native, 100 * native / total if total else 0))
+    print()
+    pstats.Stats(profiler).sort_stats("tottime").print_stats(15)
@@ -67,6 +67,13 @@ void m5_panic(void);
 void m5_work_begin(uint64_t workid, uint64_t threadid);
 void m5_work_end(uint64_t workid, uint64_t threadid);
 
+/*
+ * Activate (enable != 0) or deactivate (enable == 0) the TraceTrigger
+ * objects of the system listening to this pseudo-op, to only trace a
+ * region of interest of the workload.
+ */
+void m5_trace_trigger(uint64_t enable);
+
 /*
  * Send a very generic poke to the workload so it can do something. It's up to
  * the workload to know what information to look for to interpret an event,
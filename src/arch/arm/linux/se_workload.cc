@@ -312,7 +312,7 @@ class SyscallTable32 : public SyscallDescTable<EmuLinux::SyscallABI32>
         { base + 184, "capget" },
         { base + 185, "capset" },
         { base + 186, "sigaltstack" },
-        { base + 187, "sendfile" },
+        { base + 187, "sendfile", sendfileFunc<ArmLinux32> },
         { base + 190, "vfork" },
         { base + 191, "getrlimit", getrlimitFunc<ArmLinux32> },
         { base + 192, "mmap2", mmapFunc<ArmLinux32> },
@@ -364,7 +364,7 @@ class SyscallTable32 : public SyscallDescTable<EmuLinux::SyscallABI32>
         { base + 236, "lremovexattr" },
         { base + 237, "fremovexattr" },
         { base + 238, "tkill" },
-        { base + 239, "sendfile64" },
+        { base + 239, "sendfile64", sendfileFunc<ArmLinux32, int64_t> },
         { base + 240, "futex", futexFunc<ArmLinux32> },
         { base + 241, "sched_setaffinity", ignoreWarnOnceFunc },
         { base + 242, "sched_getaffinity", ignoreFunc },
@@ -375,9 +375,9 @@ class SyscallTable32 : public SyscallDescTable<EmuLinux::SyscallABI32>
         { base + 247, "io_cancel" },
         { base + 248, "exit_group", exitGroupFunc },
         { base + 249, "lookup_dcookie" },
-        { base + 250, "epoll_create" },
-        { base + 251, "epoll_ctl" },
-        { base + 252, "epoll_wait" },
+        { base + 250, "epoll_create", epollCreateFunc<ArmLinux32> },
+        { base + 251, "epoll_ctl", epollCtlFunc<ArmLinux32> },
+        { base + 252, "epoll_wait", epollWaitFunc<ArmLinux32> },
         { base + 253, "remap_file_pages" },
         { base + 256, "set_tid_address", setTidAddressFunc },
         { base + 257, "timer_create" },
@@ -468,7 +468,7 @@ class SyscallTable32 : public SyscallDescTable<EmuLinux::SyscallABI32>
         { base + 343, "vmsplice" },
         { base + 344, "move_pages" },
         { base + 345, "getcpu", getcpuFunc },
-        { base + 346, "epoll_pwait" },
+        { base + 346, "epoll_pwait", epollPwaitFunc<ArmLinux32> },
         { base + 347, "sys_kexec_load" },
         { base + 348, "sys_utimensat" },
         { base + 349, "sys_signalfd" },
@@ -478,8 +478,8 @@ class SyscallTable32 : public SyscallDescTable<EmuLinux::SyscallABI32>
         { base + 353, "sys_timerfd_settime" },
         { base + 354, "sys_timerfd_gettime" },
         { base + 355, "sys_signalfd4" },
-        { base + 356, "sys_eventfd2" },
-        { base + 357, "sys_epoll_create1" },
+        { base + 356, "sys_eventfd2", eventfdFunc<ArmLinux32> },
+        { base + 357, "sys_epoll_create1", epollCreate1Func<ArmLinux32> },
         { base + 358, "sys_dup3" },
         { base + 359, "sys_pipe2" },
         { base + 360, "sys_inotify_init1" },
@@ -488,7 +488,8 @@ class SyscallTable32 : public SyscallDescTable<EmuLinux::SyscallABI32>
         { base + 363, "sys_rt_tgsigqueueinfo" },
         { base + 364, "sys_perf_event_open" },
         { base + 365, "sys_recvmmsg" },
-        { base + 384, "getrandom", getrandomFunc<ArmLinux32> }
+        { base + 384, "getrandom", getrandomFunc<ArmLinux32> },
+        { base + 391, "copy_file_range", copyFileRangeFunc<ArmLinux32> }
     })
     {}
 };
@@ -518,10 +519,10 @@ class SyscallTable64 : public SyscallDescTable<EmuLinux::SyscallABI64>
         {   base + 16, "fremovexattr" },
         {   base + 17, "getcwd", getcwdFunc },
         {   base + 18, "lookup_dcookie" },
-        {   base + 19, "eventfd2" },
-        {   base + 20, "epoll_create1" },
-        {   base + 21, "epoll_ctl" },
-        {   base + 22, "epoll_pwait" },
+        {   base + 19, "eventfd2", eventfdFunc<ArmLinux64> },
+        {   base + 20, "epoll_create1", epollCreate1Func<ArmLinux64> },
+        {   base + 21, "epoll_ctl", epollCtlFunc<ArmLinux64> },
+        {   base + 22, "epoll_pwait", epollPwaitFunc<ArmLinux64> },
         {   base + 23, "dup", dupFunc },
         {   base + 24, "dup3" },
         {   base + 25, "fcntl64", fcntl64Func },
@@ -574,7 +575,7 @@ class SyscallTable64 : public SyscallDescTable<EmuLinux::SyscallABI64>
         {   base + 68, "pwrite64" },
         {   base + 69, "preadv" },
         {   base + 70, "pwritev" },
-        {   base + 71, "sendfile64" },
+        {   base + 71, "sendfile64", sendfileFunc<ArmLinux64> },
         {   base + 72, "pselect6" },
         {   base + 73, "ppoll" },
         {   base + 74, "signalfd4" },
@@ -772,7 +773,7 @@ class SyscallTable64 : public SyscallDescTable<EmuLinux::SyscallABI64>
         {  base + 282, "userfaultfd"},
         {  base + 283, "membarrier"},
         {  base + 284, "mlock2"},
-        {  base + 285, "copy_file_range"},
+        {  base + 285, "copy_file_range", copyFileRangeFunc<ArmLinux64> },
         {  base + 286, "preadv2"},
         {  base + 287, "pwritev2"},
         {  base + 288, "pkey_mprotect"},
@@ -800,11 +801,11 @@ class SyscallTable64 : public SyscallDescTable<EmuLinux::SyscallABI64>
         { base + 1039, "lstat64", lstat64Func<ArmLinux64> },
         { base + 1040, "pipe", pipePseudoFunc },
         { base + 1041, "dup2" },
-        { base + 1042, "epoll_create" },
+        { base + 1042, "epoll_create", epollCreateFunc<ArmLinux64> },
         { base + 1043, "inotify_init" },
         { base + 1044, "eventfd" },
         { base + 1045, "signalfd" },
-        { base + 1046, "sendfile" },
+        { base + 1046, "sendfile", sendfileFunc<ArmLinux64> },
         { base + 1047, "ftruncate", ftruncateFunc<ArmLinux64> },
         { base + 1048, "truncate", truncateFunc<ArmLinux64> },
         { base + 1049, "stat", statFunc<ArmLinux64> },
@@ -831,7 +832,7 @@ class SyscallTable64 : public SyscallDescTable<EmuLinux::SyscallABI64>
         { base + 1066, "futimesat", futimesatFunc<ArmLinux64> },
         { base + 1067, "select" },
         { base + 1068, "poll" },
-        { base + 1069, "epoll_wait" },
+        { base + 1069, "epoll_wait", epollWaitFunc<ArmLinux64> },
         { base + 1070, "ustat" },
         { base + 1071, "vfork" },
         { base + 1072, "oldwait4" },
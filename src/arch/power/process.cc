@@ -154,8 +154,8 @@ PowerProcess::argsInit(int pageSize)
     uint64_t align = 16;
 
     // load object file into target memory
-    image.write(*initVirtMem);
-    interpImage.write(*initVirtMem);
+    writeImage(image);
+    writeImage(interpImage);
 
     //Setup the auxilliary vectors. These will already have endian conversion.
     //Auxilliary vectors are loaded only for elf formatted executables.
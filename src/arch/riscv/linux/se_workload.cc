@@ -143,10 +143,10 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs64 = {
     { 16,   "fremovexattr" },
     { 17,   "getcwd", getcwdFunc },
     { 18,   "lookup_dcookie" },
-    { 19,   "eventfd2" },
-    { 20,   "epoll_create1" },
-    { 21,   "epoll_ctl" },
-    { 22,   "epoll_pwait" },
+    { 19,   "eventfd2", eventfdFunc<RiscvLinux64> },
+    { 20,   "epoll_create1", epollCreate1Func<RiscvLinux64> },
+    { 21,   "epoll_ctl", epollCtlFunc<RiscvLinux64> },
+    { 22,   "epoll_pwait", epollPwaitFunc<RiscvLinux64> },
     { 23,   "dup", dupFunc },
     { 24,   "dup3" },
     { 25,   "fcntl", fcntl64Func },
@@ -198,7 +198,7 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs64 = {
     { 68,   "pwrite64", pwrite64Func<RiscvLinux64> },
     { 69,   "preadv" },
     { 70,   "pwritev" },
-    { 71,   "sendfile" },
+    { 71,   "sendfile", sendfileFunc<RiscvLinux64> },
     { 72,   "pselect6" },
     { 73,   "ppoll" },
     { 74,   "signalfd64" },
@@ -396,7 +396,7 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs64 = {
     { 282,  "userfaultid" },
     { 283,  "membarrier" },
     { 284,  "mlock2" },
-    { 285,  "copy_file_range" },
+    { 285,  "copy_file_range", copyFileRangeFunc<RiscvLinux64> },
     { 286,  "preadv2" },
     { 287,  "pwritev2" },
     { 1024, "open", openFunc<RiscvLinux64> },
@@ -417,11 +417,11 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs64 = {
     { 1039, "lstat", lstat64Func<RiscvLinux64> },
     { 1040, "pipe", pipeFunc },
     { 1041, "dup2", dup2Func },
-    { 1042, "epoll_create" },
+    { 1042, "epoll_create", epollCreateFunc<RiscvLinux64> },
     { 1043, "inotifiy_init" },
     { 1044, "eventfd", eventfdFunc<RiscvLinux64> },
     { 1045, "signalfd" },
-    { 1046, "sendfile" },
+    { 1046, "sendfile", sendfileFunc<RiscvLinux64> },
     { 1047, "ftruncate", ftruncate64Func },
     { 1048, "truncate", truncate64Func },
     { 1049, "stat", stat64Func<RiscvLinux64> },
@@ -448,7 +448,7 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs64 = {
     { 1066, "futimesat" },
     { 1067, "select", selectFunc<RiscvLinux64> },
     { 1068, "poll", pollFunc<RiscvLinux64> },
-    { 1069, "epoll_wait" },
+    { 1069, "epoll_wait", epollWaitFunc<RiscvLinux64> },
     { 1070, "ustat" },
     { 1071, "vfork" },
     { 1072, "oldwait4" },
@@ -482,10 +482,10 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs32 = {
     { 16,   "fremovexattr" },
     { 17,   "getcwd", getcwdFunc },
     { 18,   "lookup_dcookie" },
-    { 19,   "eventfd2" },
-    { 20,   "epoll_create1" },
-    { 21,   "epoll_ctl" },
-    { 22,   "epoll_pwait" },
+    { 19,   "eventfd2", eventfdFunc<RiscvLinux32> },
+    { 20,   "epoll_create1", epollCreate1Func<RiscvLinux32> },
+    { 21,   "epoll_ctl", epollCtlFunc<RiscvLinux32> },
+    { 22,   "epoll_pwait", epollPwaitFunc<RiscvLinux32> },
     { 23,   "dup", dupFunc },
     { 24,   "dup3" },
     { 25,   "fcntl", fcntlFunc },
@@ -537,7 +537,7 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs32 = {
     { 68,   "pwrite64", pwrite64Func<RiscvLinux32> },
     { 69,   "preadv" },
     { 70,   "pwritev" },
-    { 71,   "sendfile" },
+    { 71,   "sendfile", sendfileFunc<RiscvLinux32, int64_t> },
     { 72,   "pselect6" },
     { 73,   "ppoll" },
     { 74,   "signalfd64" },
@@ -735,7 +735,7 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs32 = {
     { 282,  "userfaultid" },
     { 283,  "membarrier" },
     { 284,  "mlock2" },
-    { 285,  "copy_file_range" },
+    { 285,  "copy_file_range", copyFileRangeFunc<RiscvLinux32> },
     { 286,  "preadv2" },
     { 287,  "pwritev2" },
     { 1024, "open", openFunc<RiscvLinux32> },
@@ -756,11 +756,11 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs32 = {
     { 1039, "lstat", lstatFunc<RiscvLinux32> },
     { 1040, "pipe", pipeFunc },
     { 1041, "dup2", dup2Func },
-    { 1042, "epoll_create" },
+    { 1042, "epoll_create", epollCreateFunc<RiscvLinux32> },
     { 1043, "inotifiy_init" },
     { 1044, "eventfd", eventfdFunc<RiscvLinux32> },
     { 1045, "signalfd" },
-    { 1046, "sendfile" },
+    { 1046, "sendfile", sendfileFunc<RiscvLinux32> },
     { 1047, "ftruncate", ftruncateFunc<RiscvLinux32> },
     { 1048, "truncate", truncateFunc<RiscvLinux32> },
     { 1049, "stat", statFunc<RiscvLinux32> },
@@ -787,7 +787,7 @@ SyscallDescTable<SEWorkload::SyscallABI> EmuLinux::syscallDescs32 = {
     { 1066, "futimesat" },
     { 1067, "select", selectFunc<RiscvLinux32> },
     { 1068, "poll", pollFunc<RiscvLinux32> },
-    { 1069, "epoll_wait" },
+    { 1069, "epoll_wait", epollWaitFunc<RiscvLinux32> },
     { 1070, "ustat" },
     { 1071, "vfork" },
     { 1072, "oldwait4" },
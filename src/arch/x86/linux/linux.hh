@@ -57,6 +57,13 @@ class X86Linux : public Linux
   public:
     static const ByteOrder byteOrder = ByteOrder::little;
 
+    // The x86 ABI packs struct epoll_event
+    struct GEM5_PACKED tgt_epoll_event
+    {
+        uint32_t events;
+        uint64_t data; // epoll_data_t
+    };
+
     static void
     archClone(uint64_t flags,
                           Process *pp, Process *cp,
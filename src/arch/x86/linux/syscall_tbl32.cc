@@ -230,7 +230,7 @@ SyscallDescTable<EmuLinux::SyscallABI32> EmuLinux::syscallDescs32 = {
     { 184, "capget" },
     { 185, "capset" },
     { 186, "sigaltstack" },
-    { 187, "sendfile" },
+    { 187, "sendfile", sendfileFunc<X86Linux32> },
     { 188, "getpmsg" },
     { 189, "putpmsg" },
     { 190, "vfork" },
@@ -286,7 +286,7 @@ SyscallDescTable<EmuLinux::SyscallABI32> EmuLinux::syscallDescs32 = {
     { 236, "lremovexattr" },
     { 237, "fremovexattr" },
     { 238, "tkill" },
-    { 239, "sendfile64" },
+    { 239, "sendfile64", sendfileFunc<X86Linux32, int64_t> },
     { 240, "futex" },
     { 241, "sched_setaffinity", ignoreFunc },
     { 242, "sched_getaffinity", ignoreFunc },
@@ -301,9 +301,9 @@ SyscallDescTable<EmuLinux::SyscallABI32> EmuLinux::syscallDescs32 = {
     { 251, "unused" },
     { 252, "exit_group", exitFunc },
     { 253, "lookup_dcookie" },
-    { 254, "epoll_create" },
-    { 255, "epoll_ctl" },
-    { 256, "epoll_wait" },
+    { 254, "epoll_create", epollCreateFunc<X86Linux32> },
+    { 255, "epoll_ctl", epollCtlFunc<X86Linux32> },
+    { 256, "epoll_wait", epollWaitFunc<X86Linux32> },
     { 257, "remap_file_pages" },
     { 258, "set_tid_address", setTidAddressFunc },
     { 259, "timer_create" },
@@ -366,12 +366,15 @@ SyscallDescTable<EmuLinux::SyscallABI32> EmuLinux::syscallDescs32 = {
     { 316, "vmsplice" },
     { 317, "move_pages" },
     { 318, "getcpu", getcpuFunc },
-    { 319, "epoll_pwait" },
+    { 319, "epoll_pwait", epollPwaitFunc<X86Linux32> },
     { 320, "utimensat" },
     { 321, "signalfd" },
     { 322, "timerfd" },
     { 323, "eventfd", eventfdFunc<X86Linux32> },
-    { 355, "getrandom", getrandomFunc<X86Linux32>}
+    { 328, "eventfd2", eventfdFunc<X86Linux32> },
+    { 329, "epoll_create1", epollCreate1Func<X86Linux32> },
+    { 355, "getrandom", getrandomFunc<X86Linux32>},
+    { 377, "copy_file_range", copyFileRangeFunc<X86Linux32> }
 };
 
 } // namespace X86ISA
@@ -79,7 +79,7 @@ SyscallDescTable<EmuLinux::SyscallABI64> EmuLinux::syscallDescs64 = {
     {  37, "alarm" },
     {  38, "setitimer" },
     {  39, "getpid", getpidFunc },
-    {  40, "sendfile" },
+    {  40, "sendfile", sendfileFunc<X86Linux64> },
     {  41, "socket", socketFunc<X86Linux64> },
     {  42, "connect", connectFunc },
     {  43, "accept", acceptFunc<X86Linux64> },
@@ -256,7 +256,7 @@ SyscallDescTable<EmuLinux::SyscallABI64> EmuLinux::syscallDescs64 = {
     { 210, "io_cancel" },
     { 211, "get_thread_area" },
     { 212, "lookup_dcookie" },
-    { 213, "epoll_create" },
+    { 213, "epoll_create", epollCreateFunc<X86Linux64> },
     { 214, "epoll_ctl_old" },
     { 215, "epoll_wait_old" },
     { 216, "remap_file_pages" },
@@ -279,8 +279,8 @@ SyscallDescTable<EmuLinux::SyscallABI64> EmuLinux::syscallDescs64 = {
     { 229, "clock_getres", clock_getresFunc<X86Linux64> },
     { 230, "clock_nanosleep" },
     { 231, "exit_group", exitGroupFunc },
-    { 232, "epoll_wait" },
-    { 233, "epoll_ctl" },
+    { 232, "epoll_wait", epollWaitFunc<X86Linux64> },
+    { 233, "epoll_ctl", epollCtlFunc<X86Linux64> },
     { 234, "tgkill", tgkillFunc<X86Linux64> },
     { 235, "utimes", utimesFunc<X86Linux64> },
     { 236, "vserver" },
@@ -328,7 +328,7 @@ SyscallDescTable<EmuLinux::SyscallABI64> EmuLinux::syscallDescs64 = {
     { 278, "vmsplice" },
     { 279, "move_pages" },
     { 280, "utimensat" },
-    { 281, "epoll_pwait" },
+    { 281, "epoll_pwait", epollPwaitFunc<X86Linux64> },
     { 282, "signalfd" },
     { 283, "timerfd_create" },
     { 284, "eventfd", eventfdFunc<X86Linux64> },
@@ -338,7 +338,7 @@ SyscallDescTable<EmuLinux::SyscallABI64> EmuLinux::syscallDescs64 = {
     { 288, "accept4" },
     { 289, "signalfd4" },
     { 290, "eventfd2", eventfdFunc<X86Linux64> },
-    { 291, "epoll_create1" },
+    { 291, "epoll_create1", epollCreate1Func<X86Linux64> },
     { 292, "dup3" },
     { 293, "pipe2", pipe2Func },
     { 294, "inotify_init1" },
@@ -362,6 +362,7 @@ SyscallDescTable<EmuLinux::SyscallABI64> EmuLinux::syscallDescs64 = {
     { 312, "kcmp" },
     { 313, "finit_module" },
     { 318, "getrandom", getrandomFunc<X86Linux64> },
+    { 326, "copy_file_range", copyFileRangeFunc<X86Linux64> },
     { 334, "rseq", ignoreFunc }
 };
 
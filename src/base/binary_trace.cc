@@ -0,0 +1,670 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/binary_trace.hh"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <optional>
+#include <sstream>
+
+#include "base/compiler.hh"
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+
+namespace gem5
+{
+
+namespace Trace
+{
+
+namespace
+{
+
+std::atomic<uint64_t> nextTraceId(1);
+
+/**
+ * Find the conversion specification of every argument of a message, the
+ * way cp::Print parses them. Arguments taken by a '*' width or precision,
+ * or past the end of the format, get an empty specification. The value
+ * of the former is put in the one of the argument they apply to.
+ */
+std::vector<std::string>
+conversionSpecs(const char *fmt, std::initializer_list<RecordedArg> args)
+{
+    std::vector<std::string> specs;
+    auto arg = args.begin();
+    const char *ptr = fmt;
+    while (arg != args.end() && (ptr = std::strchr(ptr, '%'))) {
+        if (ptr[1] == '%') {
+            ptr += 2;
+            continue;
+        }
+
+        // Flags, width and precision, then the conversion character
+        const char *end = ptr + 1 + std::strspn(ptr + 1, "#-+ .0123456789*l");
+        if (*end)
+            ++end;
+
+        std::string spec;
+        for (; ptr != end; ++ptr) {
+            if (*ptr != '*' || arg == args.end()) {
+                spec += *ptr;
+                continue;
+            }
+            // Only an int sets the width or precision, as in cp::Print
+            spec += std::to_string(
+                    arg->type == RecordedArg::Int32Arg ? arg->i : 0);
+            specs.emplace_back();
+            ++arg;
+        }
+        if (arg != args.end()) {
+            specs.push_back(std::move(spec));
+            ++arg;
+        }
+    }
+    specs.resize(args.size());
+    return specs;
+}
+
+/** Cursor over a buffer read back from a binary trace */
+class Reader
+{
+  private:
+    const uint8_t *ptr;
+    const uint8_t *end;
+
+  public:
+    Reader(const uint8_t *begin, size_t size)
+        : ptr(begin), end(begin + size)
+    {}
+
+    bool done() const { return ptr >= end; }
+
+    uint8_t
+    byte()
+    {
+        fatal_if(ptr >= end, "Truncated binary trace record.\n");
+        return *ptr++;
+    }
+
+    uint64_t
+    varint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; ; shift += 7) {
+            const uint8_t b = byte();
+            value |= uint64_t(b & 0x7f) << shift;
+            if (b < 0x80)
+                return value;
+        }
+    }
+
+    int64_t
+    svarint()
+    {
+        const uint64_t v = varint();
+        return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+    }
+
+    std::string
+    string()
+    {
+        const uint64_t size = varint();
+        fatal_if(size > uint64_t(end - ptr),
+                 "Truncated binary trace string.\n");
+        std::string str(reinterpret_cast<const char *>(ptr), size);
+        ptr += size;
+        return str;
+    }
+
+    template <typename T>
+    T
+    raw()
+    {
+        fatal_if(sizeof(T) > size_t(end - ptr), "Truncated binary trace.\n");
+        T value;
+        std::memcpy(&value, ptr, sizeof(T));
+        ptr += sizeof(T);
+        return value;
+    }
+};
+
+struct Format
+{
+    std::string flag;
+    std::string fmt;
+};
+
+/**
+ * Read the chunks of a binary trace, calling a function with a reader
+ * over the contents of every chunk.
+ */
+template <typename Func>
+void
+forEachChunk(std::ifstream &in, Func func)
+{
+    in.clear();
+    in.seekg(sizeof(BinaryTrace::magic) + sizeof(uint32_t));
+
+    std::vector<uint8_t> data;
+    int c;
+    while ((c = in.get()) != EOF) {
+        fatal_if(c != BinaryTrace::ChunkRecord,
+                 "Corrupt binary trace, expected a chunk.\n");
+
+        // Chunk headers are two varints, the thread and the size
+        uint64_t header[2] = { 0, 0 };
+        for (auto &value : header) {
+            for (int shift = 0; ; shift += 7) {
+                c = in.get();
+                fatal_if(c == EOF, "Truncated binary trace.\n");
+                value |= uint64_t(c & 0x7f) << shift;
+                if (c < 0x80)
+                    break;
+            }
+        }
+
+        data.resize(header[1]);
+        in.read(reinterpret_cast<char *>(data.data()), data.size());
+        if (in.gcount() != std::streamsize(data.size())) {
+            warn("Binary trace truncated, ignoring its last chunk.\n");
+            return;
+        }
+        func(Reader(data.data(), data.size()));
+    }
+}
+
+} // anonymous namespace
+
+BinaryTrace::BinaryTrace(const std::string &filename, size_t chunk_size,
+                         size_t ring_size)
+    : chunkSize(chunk_size), ringSize(ring_size), id(nextTraceId++),
+      flushRequests(0), flushesDone(0), stopping(false)
+{
+    fatal_if(!ringSize, "Binary traces need room for a buffer per thread.\n");
+
+    stream.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    fatal_if(!stream, "Unable to open binary trace file '%s'.\n", filename);
+
+    stream.write(magic, sizeof(magic));
+    const uint32_t le_version = version;
+    stream.write(reinterpret_cast<const char *>(&le_version),
+                 sizeof(le_version));
+
+    writerThread = std::thread([this]() { writer(); });
+}
+
+BinaryTrace::~BinaryTrace()
+{
+    flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cond.notify_all();
+    writerThread.join();
+}
+
+BinaryTrace::Buffer &
+BinaryTrace::buffer()
+{
+    // Threads find their buffer without taking the lock, unless this is
+    // the first message they record in this trace.
+    thread_local uint64_t owner = 0;
+    thread_local Buffer *buf = nullptr;
+
+    if (GEM5_UNLIKELY(owner != id)) {
+        std::lock_guard<std::mutex> lock(mutex);
+        buffers.emplace_back(new Buffer);
+        buf = buffers.back().get();
+        buf->thread = buffers.size() - 1;
+        buf->data.reserve(chunkSize);
+        buf->ring.resize(ringSize);
+        owner = id;
+    }
+
+    return *buf;
+}
+
+void
+BinaryTrace::record(Tick when, const std::string &name,
+                    const std::string &flag, const char *fmt,
+                    std::initializer_list<RecordedArg> args)
+{
+    Buffer &buf = buffer();
+    const uint64_t fmt_id = formatId(buf, flag, fmt);
+    const uint64_t name_id = nameId(buf, name);
+
+    if (when == MaxTick) {
+        buf.data.push_back(RawMessageRecord);
+    } else {
+        buf.data.push_back(MessageRecord);
+    }
+    putVarint(buf, fmt_id);
+    putVarint(buf, name_id);
+    if (when != MaxTick) {
+        // Ticks are mostly increasing within a buffer
+        putVarint(buf, zigzag(when - buf.lastTick));
+        buf.lastTick = when;
+    }
+    // Objects are formatted with their conversion specification now
+    std::vector<std::string> specs;
+    for (const auto &arg : args) {
+        if (arg.type == RecordedArg::ObjectArg) {
+            specs = conversionSpecs(fmt, args);
+            break;
+        }
+    }
+
+    putVarint(buf, args.size());
+    size_t i = 0;
+    for (const auto &arg : args) {
+        putArg(buf, arg, specs.empty() ? "" : specs[i].c_str());
+        ++i;
+    }
+
+    if (buf.data.size() >= chunkSize)
+        submit(buf);
+}
+
+void
+BinaryTrace::putArg(Buffer &buf, const RecordedArg &arg, const char *spec)
+{
+    switch (arg.type) {
+      case RecordedArg::CharArg:
+      case RecordedArg::SignedCharArg:
+      case RecordedArg::UnsignedCharArg:
+      case RecordedArg::BoolArg:
+        buf.data.push_back(arg.type);
+        buf.data.push_back(static_cast<uint8_t>(arg.u));
+        break;
+      case RecordedArg::Int16Arg:
+      case RecordedArg::Int32Arg:
+      case RecordedArg::Int64Arg:
+        buf.data.push_back(arg.type);
+        putVarint(buf, zigzag(arg.i));
+        break;
+      case RecordedArg::Uint16Arg:
+      case RecordedArg::Uint32Arg:
+      case RecordedArg::Uint64Arg:
+        buf.data.push_back(arg.type);
+        putVarint(buf, arg.u);
+        break;
+      case RecordedArg::FloatArg:
+        buf.data.push_back(arg.type);
+        buf.data.insert(buf.data.end(),
+                        reinterpret_cast<const uint8_t *>(&arg.f),
+                        reinterpret_cast<const uint8_t *>(&arg.f + 1));
+        break;
+      case RecordedArg::DoubleArg:
+        buf.data.push_back(arg.type);
+        buf.data.insert(buf.data.end(),
+                        reinterpret_cast<const uint8_t *>(&arg.d),
+                        reinterpret_cast<const uint8_t *>(&arg.d + 1));
+        break;
+      case RecordedArg::StringArg:
+        buf.data.push_back(arg.type);
+        putString(buf, static_cast<const char *>(arg.ptr), arg.size);
+        break;
+      case RecordedArg::PointerArg:
+        buf.data.push_back(arg.type);
+        putVarint(buf, reinterpret_cast<uintptr_t>(arg.ptr));
+        break;
+      case RecordedArg::ObjectArg:
+        {
+            std::ostringstream os;
+            arg.format(os, spec, arg.ptr);
+            const std::string str = os.str();
+            buf.data.push_back(arg.type);
+            putString(buf, str.data(), str.size());
+        }
+        break;
+    }
+}
+
+uint64_t
+BinaryTrace::formatId(Buffer &buf, const std::string &flag, const char *fmt)
+{
+    auto it = buf.formats.find(fmt);
+    if (GEM5_LIKELY(it != buf.formats.end() && it->second.flag == flag &&
+                    it->second.fmt == fmt)) {
+        return it->second.id;
+    }
+
+    std::string key(flag);
+    key += '\0';
+    key += fmt;
+
+    uint64_t fmt_id;
+    bool defined;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto res = formatIds.emplace(key, formatIds.size() + 1);
+        fmt_id = res.first->second;
+        defined = !res.second;
+    }
+
+    if (!defined) {
+        buf.data.push_back(FormatRecord);
+        putVarint(buf, fmt_id);
+        putString(buf, flag.data(), flag.size());
+        putString(buf, fmt, std::strlen(fmt));
+    }
+
+    // The last format and flag seen at an address are cached
+    buf.formats[fmt] = Format{flag, fmt, fmt_id};
+
+    return fmt_id;
+}
+
+uint64_t
+BinaryTrace::nameId(Buffer &buf, const std::string &name)
+{
+    if (name.empty())
+        return 0;
+
+    auto it = buf.names.find(name);
+    if (GEM5_LIKELY(it != buf.names.end()))
+        return it->second;
+
+    uint64_t name_id;
+    bool defined;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto res = nameIds.emplace(name, nameIds.size() + 1);
+        name_id = res.first->second;
+        defined = !res.second;
+    }
+
+    if (!defined) {
+        buf.data.push_back(NameRecord);
+        putVarint(buf, name_id);
+        putString(buf, name.data(), name.size());
+    }
+
+    buf.names.emplace(name, name_id);
+    return name_id;
+}
+
+void
+BinaryTrace::submit(Buffer &buf)
+{
+    const uint64_t head = buf.head.load(std::memory_order_relaxed);
+    while (head - buf.tail.load(std::memory_order_acquire) == ringSize) {
+        cond.notify_one();
+        std::this_thread::yield();
+    }
+
+    // The slot holds a buffer the writer is done with, reuse it
+    std::vector<uint8_t> &slot = buf.ring[head % ringSize];
+    slot.swap(buf.data);
+    if (buf.data.capacity() < chunkSize)
+        buf.data.reserve(chunkSize);
+    // Tick deltas restart with every buffer
+    buf.lastTick = 0;
+
+    buf.head.store(head + 1, std::memory_order_release);
+    cond.notify_one();
+}
+
+void
+BinaryTrace::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    std::vector<Buffer *> bufs;
+    for (auto &buf : buffers)
+        bufs.push_back(buf.get());
+
+    // The writer may need the lock to make room in the rings
+    lock.unlock();
+    for (Buffer *buf : bufs) {
+        if (!buf->data.empty())
+            submit(*buf);
+    }
+    lock.lock();
+
+    const uint64_t request = ++flushRequests;
+    cond.notify_all();
+    cond.wait(lock, [this, request]() { return flushesDone >= request; });
+}
+
+bool
+BinaryTrace::drain(const std::vector<Buffer *> &bufs)
+{
+    bool wrote = false;
+    for (Buffer *buf : bufs) {
+        uint64_t tail = buf->tail.load(std::memory_order_relaxed);
+        const uint64_t head = buf->head.load(std::memory_order_acquire);
+        for (; tail != head; ++tail) {
+            std::vector<uint8_t> &chunk = buf->ring[tail % ringSize];
+
+            uint8_t header[1 + 2 * 10];
+            size_t size = 0;
+            header[size++] = ChunkRecord;
+            for (uint64_t value : { buf->thread, uint64_t(chunk.size()) }) {
+                while (value >= 0x80) {
+                    header[size++] = static_cast<uint8_t>(value) | 0x80;
+                    value >>= 7;
+                }
+                header[size++] = static_cast<uint8_t>(value);
+            }
+            stream.write(reinterpret_cast<const char *>(header), size);
+            stream.write(reinterpret_cast<const char *>(chunk.data()),
+                         chunk.size());
+
+            chunk.clear();
+            buf->tail.store(tail + 1, std::memory_order_release);
+            wrote = true;
+        }
+    }
+    return wrote;
+}
+
+void
+BinaryTrace::writer()
+{
+    std::vector<Buffer *> bufs;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        bufs.clear();
+        for (auto &buf : buffers)
+            bufs.push_back(buf.get());
+        const uint64_t requests = flushRequests;
+        const bool stop = stopping;
+        lock.unlock();
+
+        // Everything pushed before the requests were read is written
+        // once the rings have been drained
+        bool wrote = false;
+        while (drain(bufs))
+            wrote = true;
+        if (requests != flushesDone)
+            stream.flush();
+
+        lock.lock();
+        if (requests != flushesDone) {
+            flushesDone = requests;
+            cond.notify_all();
+        }
+        if (stop)
+            break;
+        // Threads don't take the lock to wake the writer up, so a wake up
+        // may be missed and the rings are polled regularly.
+        if (!wrote) {
+            cond.wait_for(lock, std::chrono::milliseconds(1), [this]() {
+                return flushRequests != flushesDone || stopping;
+            });
+        }
+    }
+}
+
+uint64_t
+decodeBinaryTrace(const std::string &filename, Logger &logger)
+{
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    fatal_if(!in, "Unable to open binary trace file '%s'.\n", filename);
+
+    char magic[sizeof(BinaryTrace::magic)];
+    uint32_t version = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    fatal_if(!in || std::memcmp(magic, BinaryTrace::magic, sizeof(magic)),
+             "'%s' is not a binary trace file.\n", filename);
+    fatal_if(version != BinaryTrace::version,
+             "Unsupported binary trace version %d.\n", version);
+
+    std::unordered_map<uint64_t, Format> formats;
+    std::unordered_map<uint64_t, std::string> names;
+    uint64_t messages = 0;
+
+    // Definitions may be written by another thread in a later chunk than
+    // their first use, so collect them all before decoding the messages.
+    for (bool decode : { false, true }) {
+        forEachChunk(in, [&](Reader reader) {
+            Tick last_tick = 0;
+            while (!reader.done()) {
+                const uint8_t type = reader.byte();
+                if (type == BinaryTrace::FormatRecord) {
+                    const uint64_t fmt_id = reader.varint();
+                    Format &format = formats[fmt_id];
+                    format.flag = reader.string();
+                    format.fmt = reader.string();
+                    continue;
+                } else if (type == BinaryTrace::NameRecord) {
+                    const uint64_t name_id = reader.varint();
+                    names[name_id] = reader.string();
+                    continue;
+                }
+
+                fatal_if(type != BinaryTrace::MessageRecord &&
+                         type != BinaryTrace::RawMessageRecord,
+                         "Corrupt binary trace, unknown record %#x.\n", type);
+
+                const uint64_t fmt_id = reader.varint();
+                const uint64_t name_id = reader.varint();
+                Tick when = MaxTick;
+                if (type == BinaryTrace::MessageRecord) {
+                    when = last_tick + reader.svarint();
+                    last_tick = when;
+                }
+
+                static const Format unknown{"", "<unknown format>\n"};
+                auto fit = formats.find(fmt_id);
+                const Format &format =
+                    fit != formats.end() ? fit->second : unknown;
+
+                // Arguments are only formatted when decoding, the first
+                // pass just skips them
+                std::ostringstream line;
+                std::optional<cp::Print> print;
+                if (decode)
+                    print.emplace(line, format.fmt.c_str());
+                auto add = [&print](const auto &arg) {
+                    if (print)
+                        print->addArg(arg);
+                };
+
+                const uint64_t num_args = reader.varint();
+                for (uint64_t i = 0; i < num_args; ++i) {
+                    switch (reader.byte()) {
+                      case RecordedArg::CharArg:
+                        add(static_cast<char>(reader.byte()));
+                        break;
+                      case RecordedArg::SignedCharArg:
+                        add(static_cast<signed char>(reader.byte()));
+                        break;
+                      case RecordedArg::UnsignedCharArg:
+                        add(static_cast<unsigned char>(reader.byte()));
+                        break;
+                      case RecordedArg::BoolArg:
+                        add(static_cast<bool>(reader.byte()));
+                        break;
+                      case RecordedArg::Int16Arg:
+                        add(static_cast<int16_t>(reader.svarint()));
+                        break;
+                      case RecordedArg::Int32Arg:
+                        add(static_cast<int32_t>(reader.svarint()));
+                        break;
+                      case RecordedArg::Int64Arg:
+                        add(static_cast<int64_t>(reader.svarint()));
+                        break;
+                      case RecordedArg::Uint16Arg:
+                        add(static_cast<uint16_t>(reader.varint()));
+                        break;
+                      case RecordedArg::Uint32Arg:
+                        add(static_cast<uint32_t>(reader.varint()));
+                        break;
+                      case RecordedArg::Uint64Arg:
+                        add(static_cast<uint64_t>(reader.varint()));
+                        break;
+                      case RecordedArg::FloatArg:
+                        add(reader.raw<float>());
+                        break;
+                      case RecordedArg::DoubleArg:
+                        add(reader.raw<double>());
+                        break;
+                      case RecordedArg::StringArg:
+                        add(reader.string());
+                        break;
+                      case RecordedArg::PointerArg:
+                        add(reinterpret_cast<const void *>(
+                                static_cast<uintptr_t>(reader.varint())));
+                        break;
+                      case RecordedArg::ObjectArg:
+                        {
+                            const std::string str = reader.string();
+                            if (print)
+                                print->addFormatted(str);
+                        }
+                        break;
+                      default:
+                        fatal("Corrupt binary trace, unknown argument.\n");
+                    }
+                }
+                if (!decode)
+                    continue;
+                print->endArgs();
+
+                static const std::string no_name;
+                auto nit = names.find(name_id);
+                logger.logMessage(when,
+                                  nit != names.end() ? nit->second : no_name,
+                                  format.flag, line.str());
+                messages++;
+            }
+        });
+    }
+
+    return messages;
+}
+
+} // namespace Trace
+} // namespace gem5
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_BINARY_TRACE_HH__
+#define __BASE_BINARY_TRACE_HH__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "base/trace.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace Trace
+{
+
+/**
+ * Binary debug trace writer.
+ *
+ * Instead of formatting debug messages when they are logged, a record
+ * holding the format string id, the object name id, the tick and the raw
+ * arguments is appended to a per-thread buffer. Format strings and names
+ * are interned and only written out the first time a thread uses them.
+ * Full buffers are pushed to a per-thread ring, which a writer thread
+ * drains to the file in the background. The rings have a single producer
+ * and a single consumer and take no lock, so the simulation threads only
+ * ever append to memory they own, and only wait for the writer when
+ * their ring is full.
+ *
+ * Arguments keep their C++ type (size and signedness of integers,
+ * character, floating point, string or pointer), so that decoding them
+ * with cprintf produces exactly the same text as formatting them when
+ * logging. Other types are formatted with the conversion specification
+ * they are printed with when recorded, unless they convert to an integer,
+ * like Cycles or BitUnions, which are recorded as that integer.
+ *
+ * The file is decoded by decodeBinaryTrace().
+ */
+class BinaryTrace
+{
+  public:
+    /** Record types */
+    enum Record : uint8_t
+    {
+        /** A buffer written by a thread */
+        ChunkRecord = 'C',
+        /** Format string definition */
+        FormatRecord = 'F',
+        /** Name definition */
+        NameRecord = 'N',
+        /** Message with a tick */
+        MessageRecord = 'M',
+        /** Message without a tick, e.g., from DPRINTFR */
+        RawMessageRecord = 'R',
+    };
+
+    static constexpr char magic[8] = { 'g', 'e', 'm', '5', 'd', 'b', 'g', 0 };
+    static constexpr uint32_t version = 2;
+
+    /**
+     * @param filename File to write the trace to
+     * @param chunk_size Size of the per-thread buffers
+     * @param ring_size Number of full buffers of every thread that may be
+     * waiting for the writer before the thread waits for it to catch up
+     */
+    BinaryTrace(const std::string &filename, size_t chunk_size = 1 << 20,
+                size_t ring_size = 8);
+    ~BinaryTrace();
+
+    BinaryTrace(const BinaryTrace &) = delete;
+    BinaryTrace &operator=(const BinaryTrace &) = delete;
+
+    /** Record a message to be formatted with cprintf when decoded. */
+    void record(Tick when, const std::string &name, const std::string &flag,
+                const char *fmt, std::initializer_list<RecordedArg> args);
+
+    template <typename ...Args>
+    void
+    record(Tick when, const std::string &name, const std::string &flag,
+           const char *fmt, const Args &...args)
+    {
+        record(when, name, flag, fmt, { RecordedArg(args)... });
+    }
+
+    /**
+     * Hand the buffers of all threads to the writer and wait for them to
+     * be written. No other thread may record messages at the same time.
+     */
+    void flush();
+
+  protected:
+    /** A format string and the flag it is used with */
+    struct Format
+    {
+        std::string flag;
+        std::string fmt;
+        uint64_t id;
+    };
+
+    /** Per-thread state */
+    struct Buffer
+    {
+        std::vector<uint8_t> data;
+        /** Tick of the last message in the buffer */
+        Tick lastTick = 0;
+        uint64_t thread;
+        /**
+         * Format string ids by the address of the format. Formats are
+         * usually string literals, but the cached contents are checked
+         * as the same address may hold another format later.
+         */
+        std::unordered_map<const char *, Format> formats;
+        /** Name ids */
+        std::unordered_map<std::string, uint64_t> names;
+
+        /** Full buffers waiting for the writer */
+        std::vector<std::vector<uint8_t>> ring;
+        /** Number of buffers pushed to the ring by the thread */
+        std::atomic<uint64_t> head = 0;
+        /** Number of buffers written out by the writer */
+        std::atomic<uint64_t> tail = 0;
+    };
+
+    /** Buffer of the calling thread */
+    Buffer &buffer();
+
+    uint64_t formatId(Buffer &buf, const std::string &flag, const char *fmt);
+    uint64_t nameId(Buffer &buf, const std::string &name);
+
+    /** Push a buffer to its ring, waiting for room if it is full */
+    void submit(Buffer &buf);
+
+    /**
+     * Write out the buffers waiting in the rings.
+     * @return Whether anything was written
+     */
+    bool drain(const std::vector<Buffer *> &bufs);
+
+    /** Body of the writer thread */
+    void writer();
+
+    static uint64_t
+    zigzag(Tick delta)
+    {
+        const int64_t d = static_cast<int64_t>(delta);
+        return (static_cast<uint64_t>(d) << 1) ^
+            static_cast<uint64_t>(d >> 63);
+    }
+
+    static void
+    putVarint(Buffer &buf, uint64_t value)
+    {
+        while (value >= 0x80) {
+            buf.data.push_back(static_cast<uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+        buf.data.push_back(static_cast<uint8_t>(value));
+    }
+
+    static void
+    putString(Buffer &buf, const char *str, size_t size)
+    {
+        putVarint(buf, size);
+        buf.data.insert(buf.data.end(), str, str + size);
+    }
+
+    /**
+     * @param spec Conversion specification of an object argument, which
+     * is formatted with it when recorded
+     */
+    static void putArg(Buffer &buf, const RecordedArg &arg, const char *spec);
+
+  protected:
+    const size_t chunkSize;
+    const size_t ringSize;
+
+    /** Unique id of this trace, to tell per-thread state apart */
+    const uint64_t id;
+
+    /** Only accessed by the writer thread once it is started */
+    std::ofstream stream;
+
+    /** Protects everything below */
+    std::mutex mutex;
+    std::condition_variable cond;
+
+    /** Buffers of all threads that recorded messages */
+    std::vector<std::unique_ptr<Buffer>> buffers;
+
+    /** Interned format strings and names */
+    std::unordered_map<std::string, uint64_t> formatIds;
+    std::unordered_map<std::string, uint64_t> nameIds;
+
+    /** Number of flushes requested, and completed by the writer */
+    uint64_t flushRequests;
+    uint64_t flushesDone;
+    bool stopping;
+
+    std::thread writerThread;
+};
+
+/**
+ * Decode a binary debug trace, passing every message to a logger which
+ * formats it as if it had been logged to it.
+ *
+ * Messages are logged in the order they were written to the file, which
+ * for multi-threaded simulations interleaves the messages of the threads
+ * at the granularity of their buffers.
+ *
+ * @param filename Binary trace to decode
+ * @param logger Logger to output the messages to
+ * @return Number of messages decoded
+ */
+uint64_t decodeBinaryTrace(const std::string &filename, Logger &logger);
+
+} // namespace Trace
+} // namespace gem5
+
+#endif // __BASE_BINARY_TRACE_HH__
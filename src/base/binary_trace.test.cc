@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/binary_trace.hh"
+#include "base/bitunion.hh"
+#include "base/gtest/cur_tick_fake.hh"
+#include "base/gtest/logging.hh"
+#include "base/trace.hh"
+#include "base/types.hh"
+
+using namespace gem5;
+
+// Instantiate the mock class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+std::string
+tempFile(const std::string &name)
+{
+    return testing::TempDir() + "/" + name;
+}
+
+/** @return The text output of decoding a binary trace. */
+std::string
+decode(const std::string &filename, uint64_t *num_messages = nullptr)
+{
+    std::stringstream ss;
+    Trace::OstreamLogger logger(ss);
+    const uint64_t messages = Trace::decodeBinaryTrace(filename, logger);
+    if (num_messages)
+        *num_messages = messages;
+    return ss.str();
+}
+
+BitUnion16(Bits16)
+    Bitfield<15, 4> high;
+EndBitUnion(Bits16)
+
+BitUnion64(Bits64)
+    Bitfield<63, 32> high;
+EndBitUnion(Bits64)
+
+/** A type that is only printed through its stream operator. */
+struct Printable
+{
+    int value;
+};
+
+std::ostream &
+operator<<(std::ostream &os, const Printable &p)
+{
+    return os << "<" << p.value << ">";
+}
+
+/** Log messages with objects formatted by cprintf. */
+void
+logObjects(Trace::Logger &logger)
+{
+    const Bits16 bits16 = 0xab;
+    const Bits64 bits64 = 0x123456789abcdefULL;
+
+    logger.dprintf_flag(10, "system.cpu", "Flag", "%#x %#x %#x\n",
+                        Cycles(255), bits16, bits64);
+    logger.dprintf_flag(10, "system.cpu", "Flag", "%5d|%-5d|%#08x|%o\n",
+                        Cycles(42), bits16, Cycles(255), bits16.high);
+    logger.dprintf_flag(10, "system.cpu", "Flag", "%#x %8s|%-8s|%*s|\n",
+                        Cycles(16), Printable{1}, Printable{2}, 6,
+                        Printable{3});
+    logger.dprintf_flag(10, "system.cpu", "Flag", "%%%-6s|\n", Printable{4});
+    logger.dprintf_flag(10, "system.cpu", "Flag", "extra %d\n", 1,
+                        Printable{5});
+}
+
+/** Log the same messages of every kind to a logger. */
+void
+logMessages(Trace::Logger &logger)
+{
+    const char c = 'x';
+    const signed char sc = -5;
+    const unsigned char uc = 200;
+    const int16_t i16 = -1234;
+    const uint16_t u16 = 65000;
+    const std::string str("string");
+    const char *cstr = "c string";
+    char array[] = "array";
+    const void *ptr = reinterpret_cast<const void *>(0xdeadbeef);
+
+    logger.dprintf_flag(10, "system.cpu", "Flag", "no arguments\n");
+    logger.dprintf_flag(10, "system.cpu", "Flag", "%c %d %d %#x\n",
+                        c, sc, uc, uc);
+    logger.dprintf_flag(20, "system.mem", "Other", "%d %u %x %o\n",
+                        i16, u16, -1, 0777);
+    logger.dprintf_flag(15, "system.mem", "Other", "%lld %llu %#018x\n",
+                        INT64_MIN, UINT64_MAX, 0x1234ULL);
+    logger.dprintf_flag(MaxTick, "", "Flag", "%s %s %s %-10s|\n",
+                        str, cstr, array, "literal");
+    logger.dprintf_flag(30, "system.cpu", "Flag", "%f %.2f %e %g\n",
+                        1.5f, 3.14159, 1e-10, 2.5L);
+    logger.dprintf_flag(30, "system.cpu", "Flag", "%p %s %d\n", ptr, true,
+                        false);
+    logger.dprintf_flag(30, "system.cpu", "Flag", "%*d|%-5d|\n", 6, 42, 7);
+    logger.dprintf(5, "system.cpu", "tick went %s\n", "backwards");
+    logger.dprintf_flag(40, "system.cpu", "Flag", "extra %d\n", 1, 2);
+}
+
+} // anonymous namespace
+
+/** Test that decoding gives the same text as logging directly. */
+TEST(BinaryTraceTest, SameAsOstream)
+{
+    std::stringstream expected;
+    Trace::OstreamLogger ostream_logger(expected);
+    logMessages(ostream_logger);
+
+    const std::string filename = tempFile("same_as_ostream.bin");
+    {
+        Trace::BinaryLogger logger(filename);
+        logMessages(logger);
+    }
+
+    uint64_t messages = 0;
+    ASSERT_EQ(decode(filename, &messages), expected.str());
+    ASSERT_EQ(messages, 10);
+}
+
+/**
+ * Test that objects are formatted with their conversion specification,
+ * as integers if they convert to one.
+ */
+TEST(BinaryTraceTest, Objects)
+{
+    std::stringstream expected;
+    Trace::OstreamLogger ostream_logger(expected);
+    logObjects(ostream_logger);
+    ASSERT_NE(expected.str().find("0xff 0xab 0x123456789abcdef\n"),
+              std::string::npos);
+
+    const std::string filename = tempFile("objects.bin");
+    {
+        Trace::BinaryLogger logger(filename);
+        logObjects(logger);
+    }
+
+    ASSERT_EQ(decode(filename), expected.str());
+}
+
+/** Test that formatted messages and the ostream are recorded too. */
+TEST(BinaryTraceTest, LogMessageAndOstream)
+{
+    const std::string filename = tempFile("ostream.bin");
+    {
+        Trace::BinaryLogger logger(filename);
+        logger.logMessage(100, "system", "Flag", "formatted\n");
+        logger.getOstream() << "first line" << std::endl;
+        logger.getOstream() << "second " << 2 << std::endl;
+        logger.logMessage(MaxTick, "", "", "raw\n");
+        logger.getOstream() << "unterminated";
+    }
+
+    ASSERT_EQ(decode(filename),
+              "    100: system: formatted\n"
+              "first line\n"
+              "second 2\n"
+              "raw\n"
+              "unterminated");
+}
+
+/** Test that ignored objects are not recorded. */
+TEST(BinaryTraceTest, Ignore)
+{
+    const std::string filename = tempFile("ignore.bin");
+    {
+        Trace::BinaryLogger logger(filename);
+        logger.addIgnore(ObjectMatch("system.ignored"));
+        logger.dprintf(1, "system.ignored", "Ignored %d\n", 1);
+        logger.dprintf(2, "system.cpu", "Kept %d\n", 2);
+        logger.logMessage(3, "system.ignored", "", "Ignored\n");
+    }
+
+    ASSERT_EQ(decode(filename), "      2: system.cpu: Kept 2\n");
+}
+
+/**
+ * Test that many small buffers are written in order, and that formats
+ * and names defined in earlier buffers are still found.
+ */
+TEST(BinaryTraceTest, ManyChunks)
+{
+    const std::string filename = tempFile("chunks.bin");
+    std::stringstream expected;
+    Trace::OstreamLogger ostream_logger(expected);
+    {
+        Trace::BinaryTrace trace(filename, 64, 2);
+        for (int i = 0; i < 1000; ++i) {
+            const Tick when = 1000 - i % 7 * 100 + i * 1000;
+            const std::string name = "obj" + std::to_string(i % 5);
+            trace.record(when, name, "Flag", "message %d of %s\n", i, name);
+            ostream_logger.dprintf_flag(when, name, "Flag",
+                                        "message %d of %s\n", i, name);
+        }
+    }
+
+    uint64_t messages = 0;
+    ASSERT_EQ(decode(filename, &messages), expected.str());
+    ASSERT_EQ(messages, 1000);
+}
+
+/**
+ * Test that a format string changing at the same address is recorded
+ * with its new contents.
+ */
+TEST(BinaryTraceTest, ReusedFormatAddress)
+{
+    const std::string filename = tempFile("reused_format.bin");
+    {
+        Trace::BinaryLogger logger(filename);
+        char fmt[16] = "first %d\n";
+        logger.dprintf(1, "system", fmt, 1);
+        std::strcpy(fmt, "second %d\n");
+        logger.dprintf(2, "system", fmt, 2);
+        std::strcpy(fmt, "first %d\n");
+        logger.dprintf(3, "system", fmt, 3);
+    }
+
+    ASSERT_EQ(decode(filename),
+              "      1: system: first 1\n"
+              "      2: system: second 2\n"
+              "      3: system: first 3\n");
+}
+
+/** Test recording from several threads at the same time. */
+TEST(BinaryTraceTest, Threads)
+{
+    const std::string filename = tempFile("threads.bin");
+    const int num_threads = 4;
+    const int num_messages = 5000;
+    {
+        Trace::BinaryTrace trace(filename, 256, 4);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&trace, t]() {
+                const std::string name = "thread" + std::to_string(t);
+                for (int i = 0; i < num_messages; ++i)
+                    trace.record(i, name, "", "%d %d\n", t, i);
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+    }
+
+    uint64_t messages = 0;
+    std::istringstream lines(decode(filename, &messages));
+    ASSERT_EQ(messages, num_threads * num_messages);
+
+    // The messages of every thread must be in order
+    std::vector<int> next(num_threads, 0);
+    Tick when;
+    std::string name;
+    int t, i;
+    char colon;
+    while (lines >> when >> colon >> name >> t >> i) {
+        ASSERT_EQ(name, "thread" + std::to_string(t) + ":");
+        ASSERT_EQ(when, i);
+        ASSERT_EQ(i, next[t]++);
+    }
+    for (t = 0; t < num_threads; ++t)
+        ASSERT_EQ(next[t], num_messages);
+}
+
+/** Test that the messages recorded so far are written on a flush. */
+TEST(BinaryTraceTest, Flush)
+{
+    const std::string filename = tempFile("flush.bin");
+    Trace::BinaryLogger logger(filename);
+    logger.dprintf(1, "system", "before flush\n");
+    logger.flush();
+    ASSERT_EQ(decode(filename), "      1: system: before flush\n");
+
+    logger.dprintf(2, "system", "after flush\n");
+    logger.flush();
+    ASSERT_EQ(decode(filename),
+              "      1: system: before flush\n"
+              "      2: system: after flush\n");
+}
+
+/** Test that decoding a file which is not a trace fails. */
+TEST(BinaryTraceTest, NotATrace)
+{
+    const std::string filename = tempFile("not_a_trace.bin");
+    {
+        std::ofstream file(filename);
+        file << "This is not a binary trace";
+    }
+
+    gtestLogOutput.str("");
+    std::stringstream ss;
+    Trace::OstreamLogger logger(ss);
+    ASSERT_ANY_THROW(Trace::decodeBinaryTrace(filename, logger));
+    ASSERT_NE(gtestLogOutput.str().find("is not a binary trace file"),
+              std::string::npos);
+}
@@ -121,6 +121,19 @@ struct Print
         }
     }
 
+    /**
+     * Add an argument which was already formatted with its conversion
+     * specification, e.g., when it was recorded to a binary trace.
+     */
+    void
+    addFormatted(const std::string &text)
+    {
+        if (!cont)
+            process();
+
+        stream << text;
+    }
+
     void endArgs();
 };
 
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_FLAT_ADDR_MAP_HH__
+#define __BASE_FLAT_ADDR_MAP_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * An open-addressing hash map keyed on addresses. All the entries live
+ * in a single flat array and collisions are resolved with linear
+ * probing, which keeps lookups within a few cache lines, unlike the
+ * node based std::unordered_map. Erased entries leave a tombstone
+ * behind, which is cleaned up when the table is rehashed.
+ *
+ * Iterators are plain pointers to the stored key-value pairs. They are
+ * stable across lookups, erases and emplace() or operator[] on a key
+ * that is already present, but are invalidated by the insertion of a
+ * new key, as it may trigger a rehash.
+ */
+template <typename V>
+class FlatAddrMap
+{
+  public:
+    typedef std::pair<Addr, V> value_type;
+    typedef value_type *iterator;
+    typedef const value_type *const_iterator;
+
+  private:
+    enum SlotState : uint8_t
+    {
+        Empty = 0,
+        Full,
+        Deleted
+    };
+
+    std::vector<value_type> slots;
+    std::vector<SlotState> states;
+
+    /** Number of entries in use */
+    size_t entries;
+    /** Number of tombstones left by erased entries */
+    size_t tombstones;
+    /** log2 of the number of slots */
+    unsigned bits;
+
+    size_t
+    hash(Addr key) const
+    {
+        // Fibonacci hashing spreads aligned addresses over the table
+        return (key * 0x9E3779B97F4A7C15ULL) >> (64 - bits);
+    }
+
+    size_t mask() const { return slots.size() - 1; }
+
+    /**
+     * Find the slot holding a key, or the slot where it should be
+     * inserted if not present.
+     *
+     * @return the slot index and whether the key was found
+     */
+    std::pair<size_t, bool>
+    probe(Addr key) const
+    {
+        size_t idx = hash(key);
+        size_t insert_idx = slots.size();
+        while (true) {
+            if (states[idx] == Empty) {
+                return std::make_pair(insert_idx != slots.size() ?
+                                      insert_idx : idx, false);
+            } else if (states[idx] == Deleted) {
+                if (insert_idx == slots.size())
+                    insert_idx = idx;
+            } else if (slots[idx].first == key) {
+                return std::make_pair(idx, true);
+            }
+            idx = (idx + 1) & mask();
+        }
+    }
+
+    /**
+     * Rebuild the table with a given number of slots, dropping all the
+     * tombstones.
+     */
+    void
+    rehash(size_t num_slots)
+    {
+        std::vector<value_type> old_slots(num_slots);
+        std::vector<SlotState> old_states(num_slots, Empty);
+        old_slots.swap(slots);
+        old_states.swap(states);
+        bits = floorLog2(num_slots);
+        tombstones = 0;
+
+        for (size_t i = 0; i < old_slots.size(); i++) {
+            if (old_states[i] == Full) {
+                size_t idx = probe(old_slots[i].first).first;
+                slots[idx] = std::move(old_slots[i]);
+                states[idx] = Full;
+            }
+        }
+    }
+
+    /**
+     * Make room for one more entry, keeping the load (including the
+     * tombstones) at or below 3/4.
+     *
+     * @return whether the table was rehashed
+     */
+    bool
+    reserveOne()
+    {
+        if ((entries + tombstones + 1) * 4 <= slots.size() * 3)
+            return false;
+        // only grow if the live entries need it, otherwise a rehash at
+        // the same size is enough to get rid of the tombstones
+        rehash((entries + 1) * 2 > slots.size() ?
+               slots.size() * 2 : slots.size());
+        return true;
+    }
+
+  public:
+    /**
+     * @param initial_capacity Initial number of slots, rounded up to a
+     *                         power of two
+     */
+    FlatAddrMap(size_t initial_capacity = 16)
+        : slots(size_t(1) << std::max(ceilLog2(initial_capacity), 2)),
+          states(slots.size(), Empty), entries(0), tombstones(0),
+          bits(floorLog2(slots.size()))
+    {}
+
+    iterator end() { return nullptr; }
+    const_iterator end() const { return nullptr; }
+
+    size_t size() const { return entries; }
+    bool empty() const { return entries == 0; }
+
+    /** Number of slots currently allocated */
+    size_t capacity() const { return slots.size(); }
+
+    iterator
+    find(Addr key)
+    {
+        auto [idx, found] = probe(key);
+        return found ? &slots[idx] : end();
+    }
+
+    const_iterator
+    find(Addr key) const
+    {
+        auto [idx, found] = probe(key);
+        return found ? &slots[idx] : end();
+    }
+
+    /**
+     * Insert a new entry unless the key is already present.
+     *
+     * @return an iterator to the entry with the key and whether it was
+     *         inserted
+     */
+    std::pair<iterator, bool>
+    emplace(Addr key, const V &value)
+    {
+        auto [idx, found] = probe(key);
+        if (found)
+            return std::make_pair(&slots[idx], false);
+
+        // Only an actual insertion may rehash, so that looking up an
+        // existing key keeps the iterators to other entries valid
+        if (reserveOne())
+            idx = probe(key).first;
+
+        if (states[idx] == Deleted)
+            --tombstones;
+        slots[idx] = value_type(key, value);
+        states[idx] = Full;
+        ++entries;
+        return std::make_pair(&slots[idx], true);
+    }
+
+    V &
+    operator[](Addr key)
+    {
+        return emplace(key, V()).first->second;
+    }
+
+    void
+    erase(iterator it)
+    {
+        size_t idx = it - slots.data();
+        assert(idx < slots.size() && states[idx] == Full);
+        states[idx] = Deleted;
+        slots[idx].second = V();
+        --entries;
+        ++tombstones;
+    }
+
+    void
+    clear()
+    {
+        std::fill(states.begin(), states.end(), Empty);
+        entries = 0;
+        tombstones = 0;
+    }
+
+    /**
+     * Call a function on every entry, in no particular order.
+     */
+    template <typename F>
+    void
+    forEach(F f)
+    {
+        for (size_t i = 0; i < slots.size(); i++) {
+            if (states[i] == Full)
+                f(slots[i]);
+        }
+    }
+};
+
+} // namespace gem5
+
+#endif // __BASE_FLAT_ADDR_MAP_HH__
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+#include "base/flat_addr_map.hh"
+
+using namespace gem5;
+
+/** A newly created map is empty and has a power of two capacity */
+TEST(FlatAddrMapTest, Empty)
+{
+    FlatAddrMap<int> map(100);
+
+    ASSERT_EQ(map.size(), 0);
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.capacity(), 128);
+    ASSERT_EQ(map.find(0x40), map.end());
+}
+
+/** Inserted entries can be found, and duplicates are not inserted */
+TEST(FlatAddrMapTest, EmplaceFind)
+{
+    FlatAddrMap<int> map;
+
+    auto [it, inserted] = map.emplace(0x40, 1);
+    ASSERT_TRUE(inserted);
+    ASSERT_EQ(it->first, 0x40);
+    ASSERT_EQ(it->second, 1);
+
+    auto [it2, inserted2] = map.emplace(0x40, 2);
+    ASSERT_FALSE(inserted2);
+    ASSERT_EQ(it2, it);
+    ASSERT_EQ(it2->second, 1);
+
+    map[0x80] = 3;
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.find(0x40)->second, 1);
+    ASSERT_EQ(map.find(0x80)->second, 3);
+    ASSERT_EQ(map.find(0xc0), map.end());
+}
+
+/** Erased entries are no longer found, and their slots are reused */
+TEST(FlatAddrMapTest, Erase)
+{
+    FlatAddrMap<int> map(16);
+
+    for (Addr a = 0; a < 8; a++)
+        map[a * 64] = a;
+    for (Addr a = 0; a < 8; a += 2)
+        map.erase(map.find(a * 64));
+
+    ASSERT_EQ(map.size(), 4);
+    for (Addr a = 0; a < 8; a++) {
+        if (a % 2) {
+            ASSERT_EQ(map.find(a * 64)->second, a);
+        } else {
+            ASSERT_EQ(map.find(a * 64), map.end());
+        }
+    }
+
+    // Insert and erase repeatedly, the tombstones must not make the
+    // table grow
+    for (Addr a = 100; a < 1000; a++) {
+        map[a * 64] = a;
+        map.erase(map.find(a * 64));
+    }
+    ASSERT_EQ(map.size(), 4);
+    ASSERT_EQ(map.capacity(), 16);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.find(64), map.end());
+}
+
+/** The map behaves like std::map under a random mix of operations */
+TEST(FlatAddrMapTest, RandomOps)
+{
+    FlatAddrMap<uint64_t> map(4);
+    std::map<Addr, uint64_t> ref;
+    std::mt19937_64 rng(1234);
+
+    for (int i = 0; i < 100000; i++) {
+        Addr key = (rng() % 4096) * 64;
+        switch (rng() % 3) {
+          case 0:
+            map[key] = i;
+            ref[key] = i;
+            break;
+          case 1: {
+            auto it = map.find(key);
+            ASSERT_EQ(it != map.end(), ref.count(key) == 1);
+            if (it != map.end()) {
+                map.erase(it);
+                ref.erase(key);
+            }
+            break;
+          }
+          default: {
+            auto it = map.find(key);
+            auto ref_it = ref.find(key);
+            ASSERT_EQ(it != map.end(), ref_it != ref.end());
+            if (it != map.end()) {
+                ASSERT_EQ(it->second, ref_it->second);
+            }
+          }
+        }
+        ASSERT_EQ(map.size(), ref.size());
+    }
+
+    size_t count = 0;
+    map.forEach([&](const std::pair<Addr, uint64_t> &e) {
+        ASSERT_EQ(ref.at(e.first), e.second);
+        ++count;
+    });
+    ASSERT_EQ(count, ref.size());
+}
+
+/**
+ * Looking up a key that is already present never rehashes, so
+ * references to the entries stay valid even when the table is full
+ */
+TEST(FlatAddrMapTest, ExistingKeyKeepsReferences)
+{
+    FlatAddrMap<int> map(16);
+
+    // Fill the table right up to the load limit, the next insertion of
+    // a new key has to rehash
+    for (Addr a = 0; a < 12; a++)
+        map[a * 64] = a;
+    ASSERT_EQ(map.capacity(), 16);
+
+    int &ref = map[0];
+    for (Addr a = 0; a < 12; a++) {
+        map[a * 64] += 100;
+        auto [it, inserted] = map.emplace(a * 64, -1);
+        ASSERT_FALSE(inserted);
+        ASSERT_EQ(it->second, a + 100);
+    }
+    ASSERT_EQ(map.capacity(), 16);
+    ASSERT_EQ(&ref, &map.find(0)->second);
+    ASSERT_EQ(ref, 100);
+
+    // A new key does grow the table
+    map[12 * 64] = 12;
+    ASSERT_EQ(map.capacity(), 32);
+    for (Addr a = 0; a < 13; a++)
+        ASSERT_EQ(map.find(a * 64)->second, a < 12 ? a + 100 : a);
+}
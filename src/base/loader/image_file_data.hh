@@ -48,12 +48,20 @@ class ImageFileData
     std::string _filename;
     uint8_t *_data;
     size_t _len;
+    int _fd;
 
   public:
     const std::string &filename() const { return _filename; }
     uint8_t const *data() const { return _data; }
     size_t len() const { return _len; }
 
+    /**
+     * Descriptor of the (decompressed) image file. It is kept open to
+     * allow users to map parts of the file directly, e.g., into the
+     * backing store of simulated memory.
+     */
+    int fd() const { return _fd; }
+
     ImageFileData(const std::string &f_name);
     virtual ~ImageFileData();
 };
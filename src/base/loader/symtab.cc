@@ -43,10 +43,54 @@ namespace loader
 
 SymbolTable debugSymbolTable;
 
+SymbolTable::SymbolTable(const SymbolTable &other)
+    : symbols(other.symbols), nameMap(other.nameMap),
+      addrVector(other.sortedAddrs()), addrVectorValid(true)
+{
+}
+
+SymbolTable &
+SymbolTable::operator=(const SymbolTable &other)
+{
+    if (this != &other) {
+        symbols = other.symbols;
+        nameMap = other.nameMap;
+        addrVector = other.sortedAddrs();
+        addrVectorValid = true;
+    }
+    return *this;
+}
+
+const SymbolTable::AddrVector &
+SymbolTable::sortedAddrs() const
+{
+    if (!addrVectorValid.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(addrVectorMutex);
+        if (!addrVectorValid.load(std::memory_order_relaxed)) {
+            addrVector.clear();
+            addrVector.reserve(symbols.size());
+            for (size_t i = 0; i < symbols.size(); ++i)
+                addrVector.push_back({ symbols[i].address, (int)i });
+
+            // A stable sort keeps symbols with the same address in
+            // insertion order.
+            std::stable_sort(addrVector.begin(), addrVector.end(),
+                [](const AddrEntry &a, const AddrEntry &b) {
+                    return a.address < b.address;
+                });
+
+            addrVectorValid.store(true, std::memory_order_release);
+        }
+    }
+
+    return addrVector;
+}
+
 void
 SymbolTable::clear()
 {
-    addrMap.clear();
+    addrVector.clear();
+    addrVectorValid = true;
     nameMap.clear();
     symbols.clear();
 }
@@ -63,8 +107,15 @@ SymbolTable::insert(const Symbol &symbol)
         return false;
 
     // There can be multiple symbols for the same address, so always
-    // update the addrTable multimap when we see a new symbol name.
-    addrMap.insert({ symbol.address, idx });
+    // update the address index when we see a new symbol name. Symbols
+    // are typically inserted in address order, in which case the index
+    // stays sorted and doesn't need to be rebuilt.
+    if (addrVectorValid && (addrVector.empty() ||
+                addrVector.back().address <= symbol.address)) {
+        addrVector.push_back({ symbol.address, idx });
+    } else {
+        addrVectorValid = false;
+    }
 
     symbols.emplace_back(symbol);
 
@@ -75,14 +126,12 @@ bool
 SymbolTable::insert(const SymbolTable &other)
 {
     // Check if any symbol in other already exists in our table.
-    NameMap intersection;
-    std::set_intersection(other.nameMap.begin(), other.nameMap.end(),
-                          nameMap.begin(), nameMap.end(),
-                          std::inserter(intersection, intersection.begin()),
-                          nameMap.value_comp());
-    if (!intersection.empty())
-        return false;
+    for (const Symbol &symbol: other) {
+        if (nameMap.find(symbol.name) != nameMap.end())
+            return false;
+    }
 
+    symbols.reserve(symbols.size() + other.symbols.size());
     for (const Symbol &symbol: other)
         insert(symbol);
 
@@ -30,11 +30,14 @@
 #ifndef __BASE_LOADER_SYMTAB_HH__
 #define __BASE_LOADER_SYMTAB_HH__
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iosfwd>
-#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/compiler.hh"
@@ -70,15 +73,36 @@ class SymbolTable
   private:
     /** Vector containing all the symbols in the table. */
     typedef std::vector<Symbol> SymbolVector;
-    /** Map addresses to an index into the symbol vector. */
-    typedef std::multimap<Addr, int> AddrMap;
     /** Map a symbol name to an index into the symbol vector. */
-    typedef std::map<std::string, int> NameMap;
+    typedef std::unordered_map<std::string, int> NameMap;
+
+    /** An address and the index of its symbol in the symbol vector. */
+    struct AddrEntry
+    {
+        Addr address;
+        int index;
+    };
+    /** Symbol indices sorted by address. */
+    typedef std::vector<AddrEntry> AddrVector;
 
     SymbolVector symbols;
-    AddrMap addrMap;
     NameMap nameMap;
 
+    /**
+     * Address index of the symbols. Symbols with the same address are
+     * kept in insertion order. The index is extended in place while
+     * symbols are inserted in address order and is otherwise re-sorted
+     * on the first lookup after the table has been modified, so that
+     * building a large table stays linear and lookups are binary
+     * searches in a contiguous array.
+     */
+    mutable AddrVector addrVector;
+    mutable std::atomic<bool> addrVectorValid;
+    mutable std::mutex addrVectorMutex;
+
+    /** Get the address index, sorting it first if needed. */
+    const AddrVector &sortedAddrs() const;
+
     /**
      * Get the first address larger than the given address, if any.
      *
@@ -87,13 +111,18 @@ class SymbolTable
      * @return True if successful; false if no larger addresses exist.
      */
     bool
-    upperBound(Addr addr, AddrMap::const_iterator &iter) const
+    upperBound(Addr addr, AddrVector::const_iterator &iter) const
     {
+        const AddrVector &addrs = sortedAddrs();
+
         // find first key *larger* than desired address
-        iter = addrMap.upper_bound(addr);
+        iter = std::upper_bound(addrs.begin(), addrs.end(), addr,
+            [](Addr a, const AddrEntry &entry) {
+                return a < entry.address;
+            });
 
         // if very first key is larger, we're out of luck
-        if (iter == addrMap.begin())
+        if (iter == addrs.begin())
             return false;
 
         return true;
@@ -169,6 +198,10 @@ class SymbolTable
     typedef SymbolVector::iterator iterator;
     typedef SymbolVector::const_iterator const_iterator;
 
+    SymbolTable() : addrVectorValid(true) {}
+    SymbolTable(const SymbolTable &other);
+    SymbolTable &operator=(const SymbolTable &other);
+
     /** @return An iterator to the beginning of the symbol vector. */
     const_iterator begin() const { return symbols.begin(); }
 
@@ -321,13 +354,17 @@ class SymbolTable
     const_iterator
     find(Addr address) const
     {
-        AddrMap::const_iterator i = addrMap.find(address);
-        if (i == addrMap.end())
+        const AddrVector &addrs = sortedAddrs();
+        auto i = std::lower_bound(addrs.begin(), addrs.end(), address,
+            [](const AddrEntry &entry, Addr a) {
+                return entry.address < a;
+            });
+        if (i == addrs.end() || i->address != address)
             return end();
 
         // There are potentially multiple symbols that map to the same
         // address. For simplicity, just return the first one.
-        return symbols.begin() + i->second;
+        return symbols.begin() + i->index;
     }
 
     /**
@@ -360,19 +397,19 @@ class SymbolTable
     const_iterator
     findNearest(Addr addr, Addr &next_addr) const
     {
-        AddrMap::const_iterator i = addrMap.end();
+        AddrVector::const_iterator i;
         if (!upperBound(addr, i))
             return end();
 
         // If there is no next address, make it 0 since 0 is not larger than
         // any other address, so it is clear that next is not valid
-        if (i == addrMap.end()) {
+        if (i == addrVector.end()) {
             next_addr = 0;
         } else {
-            next_addr = i->first;
+            next_addr = i->address;
         }
         --i;
-        return symbols.begin() + i->second;
+        return symbols.begin() + i->index;
     }
 
     /**
@@ -382,12 +419,12 @@ class SymbolTable
     const_iterator
     findNearest(Addr addr) const
     {
-        AddrMap::const_iterator i = addrMap.end();
+        AddrVector::const_iterator i;
         if (!upperBound(addr, i))
             return end();
 
         --i;
-        return symbols.begin() + i->second;
+        return symbols.begin() + i->index;
     }
 };
 
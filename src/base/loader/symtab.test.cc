@@ -640,6 +640,66 @@ TEST(LoaderSymtabTest, FindNearestNonExistent)
     ASSERT_EQ(it, symtab.end());
 }
 
+/**
+ * Test that address lookups work when the symbols are not inserted in
+ * address order, including after lookups have already been performed.
+ */
+TEST(LoaderSymtabTest, FindNearestUnordered)
+{
+    Loader::SymbolTable symtab;
+
+    Loader::Symbol symbols[] = {
+        {Loader::Symbol::Binding::Local, "symbol", 0x30},
+        {Loader::Symbol::Binding::Local, "symbol2", 0x10},
+        {Loader::Symbol::Binding::Local, "symbol3", 0x20},
+    };
+    EXPECT_TRUE(symtab.insert(symbols[0]));
+    EXPECT_TRUE(symtab.insert(symbols[1]));
+
+    Addr next_addr;
+    auto it = symtab.findNearest(symbols[1].address + 0x18, next_addr);
+    ASSERT_NE(it, symtab.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[1]);
+    ASSERT_EQ(next_addr, symbols[0].address);
+
+    EXPECT_TRUE(symtab.insert(symbols[2]));
+
+    it = symtab.findNearest(symbols[1].address + 0x18, next_addr);
+    ASSERT_NE(it, symtab.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[2]);
+    ASSERT_EQ(next_addr, symbols[0].address);
+
+    it = symtab.find(symbols[2].address);
+    ASSERT_NE(it, symtab.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[2]);
+}
+
+/** Test that copies of a table can be searched independently. */
+TEST(LoaderSymtabTest, Copy)
+{
+    Loader::SymbolTable symtab;
+
+    Loader::Symbol symbols[] = {
+        {Loader::Symbol::Binding::Local, "symbol", 0x20},
+        {Loader::Symbol::Binding::Local, "symbol2", 0x10},
+    };
+    EXPECT_TRUE(symtab.insert(symbols[0]));
+
+    Loader::SymbolTable copy(symtab);
+    EXPECT_TRUE(copy.insert(symbols[1]));
+    ASSERT_TRUE(checkTable(symtab, {symbols[0]}));
+    ASSERT_TRUE(checkTable(copy, {symbols[0], symbols[1]}));
+
+    ASSERT_EQ(symtab.findNearest(symbols[1].address), symtab.end());
+    const auto it = copy.findNearest(symbols[1].address);
+    ASSERT_NE(it, copy.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[1]);
+
+    symtab = copy;
+    ASSERT_TRUE(checkTable(symtab, {symbols[0], symbols[1]}));
+    ASSERT_EQ(symtab.find(symbols[1].name)->address, symbols[1].address);
+}
+
 /**
  * Test that the insertion of a symbol table's symbols in another table works
  * when any symbol name conflicts.
@@ -113,6 +113,7 @@ class InfoProxy : public Base
         visitor.visit(*static_cast<Base *>(this));
     }
     bool zero() const { return s.zero(); }
+    Version version() const { return s.version(); }
 };
 
 template <class Stat>
@@ -216,6 +217,12 @@ class InfoAccess
      */
     bool zero() const { return true; }
 
+    /**
+     * @return The version of the stats in which this stat was last
+     * modified, the current version if it can't be tracked.
+     */
+    Version version() const { return currentVersion(); }
+
     /**
      * Check that this stat has been set up properly and is ready for
      * use
@@ -627,6 +634,8 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
 
     bool zero() const { return result() == 0.0; }
 
+    Version version() const { return data()->version(); }
+
     void reset() { data()->reset(this->info()->getStorageParams()); }
     void prepare() { data()->prepare(this->info()->getStorageParams()); }
 };
@@ -1010,6 +1019,15 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
         return true;
     }
 
+    Version
+    version() const
+    {
+        Version v = 0;
+        for (off_type i = 0; i < size(); ++i)
+            v = std::max(v, data(i)->version());
+        return v;
+    }
+
     bool
     check() const
     {
@@ -1214,6 +1232,15 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
         return data(0)->zero();
     }
 
+    Version
+    version() const
+    {
+        Version v = 0;
+        for (off_type i = 0; i < size(); ++i)
+            v = std::max(v, data(i)->version());
+        return v;
+    }
+
     /**
      * Return a total of all entries in this vector.
      * @return The total of all vector entries.
@@ -1327,6 +1354,15 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
     template <typename U>
     void sample(const U &v, int n = 1) { data()->sample(v, n); }
 
+    /**
+     * Add each of an array of values to the distribution once. Cheaper
+     * than sampling them one at a time when values are gathered in bulk.
+     * @param v The values to add.
+     * @param n The number of values.
+     */
+    template <typename U>
+    void sampleBatch(const U *v, size_type n) { data()->sampleBatch(v, n); }
+
     /**
      * Return the number of entries in this stat.
      * @return The number of entries.
@@ -1338,6 +1374,8 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
      */
     bool zero() const { return data()->zero(); }
 
+    Version version() const { return data()->version(); }
+
     void
     prepare()
     {
@@ -1439,6 +1477,15 @@ class VectorDistBase : public DataWrapVec<Derived, VectorDistInfoProxy>
         return true;
     }
 
+    Version
+    version() const
+    {
+        Version v = 0;
+        for (off_type i = 0; i < size(); ++i)
+            v = std::max(v, data(i)->version());
+        return v;
+    }
+
     void
     prepare()
     {
@@ -1492,6 +1539,13 @@ class DistProxy
         data()->sample(v, n);
     }
 
+    template <typename U>
+    void
+    sampleBatch(const U *v, size_type n)
+    {
+        data()->sampleBatch(v, n);
+    }
+
     size_type
     size() const
     {
@@ -1924,29 +1978,30 @@ class SumNode : public Node
  */
 
 /**
- * This is a simple scalar statistic, like a counter.
- * @sa Stat, ScalarBase, StatStor
+ * This is a simple scalar statistic, like a counter. Its storage is
+ * sharded across the simulation threads.
+ * @sa Stat, ScalarBase, StatStor, ShardedStor
  */
-class Scalar : public ScalarBase<Scalar, StatStor>
+class Scalar : public ScalarBase<Scalar, ShardedStor<StatStor>>
 {
   public:
-    using ScalarBase<Scalar, StatStor>::operator=;
+    using ScalarBase<Scalar, ShardedStor<StatStor>>::operator=;
 
     Scalar(Group *parent = nullptr)
-        : ScalarBase<Scalar, StatStor>(
+        : ScalarBase<Scalar, ShardedStor<StatStor>>(
                 parent, nullptr, units::Unspecified::get(), nullptr)
     {
     }
 
     Scalar(Group *parent, const char *name, const char *desc = nullptr)
-        : ScalarBase<Scalar, StatStor>(
+        : ScalarBase<Scalar, ShardedStor<StatStor>>(
                 parent, name, units::Unspecified::get(), desc)
     {
     }
 
     Scalar(Group *parent, const char *name, const units::Base *unit,
            const char *desc = nullptr)
-        : ScalarBase<Scalar, StatStor>(parent, name, unit, desc)
+        : ScalarBase<Scalar, ShardedStor<StatStor>>(parent, name, unit, desc)
     {
     }
 };
@@ -2000,27 +2055,27 @@ class Value : public ValueBase<Value>
 };
 
 /**
- * A vector of scalar stats.
- * @sa Stat, VectorBase, StatStor
+ * A vector of scalar stats, sharded across the simulation threads.
+ * @sa Stat, VectorBase, StatStor, ShardedStor
  */
-class Vector : public VectorBase<Vector, StatStor>
+class Vector : public VectorBase<Vector, ShardedStor<StatStor>>
 {
   public:
     Vector(Group *parent = nullptr)
-        : VectorBase<Vector, StatStor>(
+        : VectorBase<Vector, ShardedStor<StatStor>>(
                 parent, nullptr, units::Unspecified::get(), nullptr)
     {
     }
 
     Vector(Group *parent, const char *name, const char *desc = nullptr)
-        : VectorBase<Vector, StatStor>(
+        : VectorBase<Vector, ShardedStor<StatStor>>(
                 parent, name, units::Unspecified::get(), desc)
     {
     }
 
     Vector(Group *parent, const char *name, const units::Base *unit,
            const char *desc = nullptr)
-        : VectorBase<Vector, StatStor>(parent, name, unit, desc)
+        : VectorBase<Vector, ShardedStor<StatStor>>(parent, name, unit, desc)
     {
     }
 };
@@ -2078,27 +2133,28 @@ class Vector2d : public Vector2dBase<Vector2d, StatStor>
 };
 
 /**
- * A simple distribution stat.
- * @sa Stat, DistBase, DistStor
+ * A simple distribution stat, sharded across the simulation threads.
+ * @sa Stat, DistBase, DistStor, ShardedStor
  */
-class Distribution : public DistBase<Distribution, DistStor>
+class Distribution : public DistBase<Distribution, ShardedStor<DistStor>>
 {
   public:
     Distribution(Group *parent = nullptr)
-        : DistBase<Distribution, DistStor>(
+        : DistBase<Distribution, ShardedStor<DistStor>>(
                 parent, nullptr, units::Unspecified::get(), nullptr)
     {
     }
 
     Distribution(Group *parent, const char *name, const char *desc = nullptr)
-        : DistBase<Distribution, DistStor>(
+        : DistBase<Distribution, ShardedStor<DistStor>>(
                 parent, name, units::Unspecified::get(), desc)
     {
     }
 
     Distribution(Group *parent, const char *name, const units::Base *unit,
                  const char *desc = nullptr)
-        : DistBase<Distribution, DistStor>(parent, name, unit, desc)
+        : DistBase<Distribution, ShardedStor<DistStor>>(
+                parent, name, unit, desc)
     {
     }
 
@@ -2475,6 +2531,8 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
      */
     bool zero() const { return data()->zero(); }
 
+    Version version() const { return data()->version(); }
+
     void
     prepare()
     {
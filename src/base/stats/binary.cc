@@ -0,0 +1,385 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/binary.hh"
+
+#include <cmath>
+#include <cstring>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+#include "base/stats/units.hh"
+#include "base/trace.hh"
+#include "debug/Stats.hh"
+#include "sim/byteswap.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+/** Magic number at the start of the file */
+const char binaryMagic[8] = { 'g', 'e', 'm', '5', 's', 't', 'a', 't' };
+
+/** Flags in the file header */
+const uint8_t compressedFlag = 0x1;
+
+/**
+ * Largest magnitude for which every integer is exactly representable
+ * as a double.
+ */
+const double maxExactInt = 9007199254740992.0; // 2^53
+
+bool
+isExactInt(double value)
+{
+    return std::fabs(value) < maxExactInt && std::trunc(value) == value;
+}
+
+} // anonymous namespace
+
+Binary::Binary(const std::string &file, bool desc, bool formulas,
+               bool _compress)
+    : fname(file), enableDescriptions(desc), enableFormula(formulas),
+      compress(_compress), nextColumn(0), schemaChanged(false)
+{
+    stream.open(fname, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!stream)
+        fatal("Unable to open binary stats file '%s'\n", fname);
+
+    buffer.insert(buffer.end(), binaryMagic, binaryMagic + 8);
+    const uint32_t le_version = htole(version);
+    const uint8_t *v = reinterpret_cast<const uint8_t *>(&le_version);
+    buffer.insert(buffer.end(), v, v + sizeof(le_version));
+    buffer.push_back(compress ? compressedFlag : 0);
+    stream.write(reinterpret_cast<const char *>(buffer.data()),
+                 buffer.size());
+    buffer.clear();
+}
+
+void
+Binary::begin()
+{
+    assert(path.empty());
+    nextColumn = 0;
+    schemaChanged = false;
+    values.clear();
+}
+
+void
+Binary::end()
+{
+    assert(valid());
+    assert(path.empty());
+
+    // Stats at the end of the previous schema that were not visited
+    if (nextColumn != schema.size()) {
+        schemaChanged = true;
+        schema.resize(nextColumn);
+    }
+
+    if (schemaChanged)
+        writeSchema();
+    writeData();
+
+    // Keep the file usable by readers while the simulation runs
+    stream.flush();
+}
+
+bool
+Binary::valid() const
+{
+    return stream.good();
+}
+
+void
+Binary::beginGroup(const char *name)
+{
+    path.emplace_back(name);
+}
+
+void
+Binary::endGroup()
+{
+    assert(!path.empty());
+    path.pop_back();
+}
+
+void
+Binary::addColumn(const Info &info, Kind kind, size_type x, size_type y)
+{
+    if (!schemaChanged && nextColumn < schema.size()) {
+        const Column &col = schema[nextColumn];
+        if (col.info == &info && col.kind == kind &&
+            col.x == x && col.y == y) {
+            nextColumn++;
+            return;
+        }
+    }
+
+    // The stats visited so far match the schema, the rest of it is
+    // replaced by the stats of this dump.
+    if (!schemaChanged) {
+        schemaChanged = true;
+        schema.resize(nextColumn);
+    }
+
+    std::string name;
+    for (const auto &group : path) {
+        name += group;
+        name += '.';
+    }
+    name += info.name;
+
+    schema.push_back(Column{&info, kind, x, y, std::move(name)});
+    nextColumn++;
+}
+
+void
+Binary::addDist(const DistData &data)
+{
+    values.push_back(data.min);
+    values.push_back(data.bucket_size);
+    values.push_back(data.samples);
+    values.push_back(data.sum);
+    values.push_back(data.squares);
+    values.push_back(data.logs);
+    values.push_back(data.min_val);
+    values.push_back(data.max_val);
+    values.push_back(data.underflow);
+    values.push_back(data.overflow);
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    addColumn(info, ScalarKind, 1, 1);
+    values.push_back(info.result());
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    const VResult &vr = info.result();
+    addColumn(info, VectorKind, vr.size(), 1);
+    values.insert(values.end(), vr.begin(), vr.end());
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    addColumn(info, DistKind, 1, distFields + info.data.cvec.size());
+    addDist(info.data);
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    const size_type width = info.data.empty() ?
+        distFields : distFields + info.data[0].cvec.size();
+    addColumn(info, VectorDistKind, info.data.size(), width);
+    for (const auto &data : info.data) {
+        panic_if(distFields + data.cvec.size() != width,
+                 "Distributions of %s have different sizes.", info.name);
+        addDist(data);
+    }
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    addColumn(info, Vector2dKind, info.x, info.y);
+    values.insert(values.end(), info.cvec.begin(), info.cvec.end());
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    if (!enableFormula)
+        return;
+
+    const VResult &vr = info.result();
+    addColumn(info, FormulaKind, vr.size(), 1);
+    values.insert(values.end(), vr.begin(), vr.end());
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    warn_once("Binary stat files don't support sparse histograms.\n");
+}
+
+void
+Binary::writeSchema()
+{
+    DPRINTF(Stats, "Writing binary stats schema with %d stats\n",
+            schema.size());
+
+    putVarint(schema.size());
+    for (const auto &col : schema) {
+        const Info &info = *col.info;
+        putString(col.name);
+        buffer.push_back(col.kind);
+        putVarint(col.x);
+        putVarint(col.y);
+        putString(info.unit->getUnitString());
+        putString(enableDescriptions ? info.desc : "");
+
+        const std::vector<std::string> *subnames = nullptr;
+        const std::vector<std::string> *y_subnames = nullptr;
+        switch (col.kind) {
+          case VectorKind:
+          case FormulaKind:
+            subnames = &static_cast<const VectorInfo &>(info).subnames;
+            break;
+          case VectorDistKind:
+            subnames = &static_cast<const VectorDistInfo &>(info).subnames;
+            break;
+          case Vector2dKind:
+            subnames = &static_cast<const Vector2dInfo &>(info).subnames;
+            y_subnames = &static_cast<const Vector2dInfo &>(info).y_subnames;
+            break;
+          default:
+            break;
+        }
+
+        putVarint(subnames ? subnames->size() : 0);
+        if (subnames) {
+            for (const auto &s : *subnames)
+                putString(s);
+        }
+        putVarint(y_subnames ? y_subnames->size() : 0);
+        if (y_subnames) {
+            for (const auto &s : *y_subnames)
+                putString(s);
+        }
+    }
+    writeRecord(SchemaRecord);
+
+    // Deltas restart from zero with every schema
+    lastValues.assign(values.size(), 0.0);
+}
+
+void
+Binary::writeData()
+{
+    assert(lastValues.size() == values.size());
+
+    putVarint(curTick());
+    if (!compress) {
+        for (double value : values)
+            putDouble(value);
+    } else {
+        // Counters are integral and mostly change by small amounts
+        // between dumps, so store them as zigzag encoded deltas with
+        // the low bit clear. Anything else is stored verbatim behind a
+        // single set bit.
+        for (size_t i = 0; i < values.size(); ++i) {
+            const double value = values[i];
+            const double last = lastValues[i];
+            if (isExactInt(value) && isExactInt(last)) {
+                const int64_t delta =
+                    static_cast<int64_t>(value) - static_cast<int64_t>(last);
+                const uint64_t zigzag = (static_cast<uint64_t>(delta) << 1) ^
+                    static_cast<uint64_t>(delta >> 63);
+                putVarint(zigzag << 1);
+            } else {
+                putVarint(1);
+                putDouble(value);
+            }
+        }
+    }
+    writeRecord(DataRecord);
+
+    values.swap(lastValues);
+}
+
+void
+Binary::writeRecord(Record type)
+{
+    uint8_t header[1 + 10];
+    size_t header_size = 0;
+    header[header_size++] = type;
+    for (uint64_t size = buffer.size(); ; size >>= 7) {
+        if (size < 0x80) {
+            header[header_size++] = static_cast<uint8_t>(size);
+            break;
+        }
+        header[header_size++] = static_cast<uint8_t>(size) | 0x80;
+    }
+
+    stream.write(reinterpret_cast<const char *>(header), header_size);
+    stream.write(reinterpret_cast<const char *>(buffer.data()),
+                 buffer.size());
+    buffer.clear();
+}
+
+void
+Binary::putVarint(uint64_t value)
+{
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void
+Binary::putString(const std::string &value)
+{
+    putVarint(value.size());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+void
+Binary::putDouble(double value)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bits = htole(bits);
+    const uint8_t *p = reinterpret_cast<const uint8_t *>(&bits);
+    buffer.insert(buffer.end(), p, p + sizeof(bits));
+}
+
+std::unique_ptr<Output>
+initBinary(const std::string &filename, bool desc, bool formulas,
+           bool compress)
+{
+    return std::unique_ptr<Output>(
+        new Binary(simout.resolve(filename), desc, formulas, compress));
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+/**
+ * Columnar binary stats output for fine-grained time series.
+ *
+ * The file is a sequence of length-prefixed records following a small
+ * file header. A schema record describing every visited stat (name,
+ * kind, unit and the shape of its value array) is written on the first
+ * dump and again only when the set of visited stats changes. Every dump
+ * then appends a data record holding the current tick and the flat
+ * array of stat values in schema order, so no per-stat formatting
+ * happens on the dump path. Data records are either raw little-endian
+ * doubles or, when compression is enabled, per-column deltas against
+ * the previous dump encoded as zigzag varints, with a raw fallback for
+ * non-integral values.
+ *
+ * The format is read by m5.stats.binary.
+ */
+class Binary : public Output
+{
+  public:
+    /** Kinds of stats, as stored in the schema */
+    enum Kind : uint8_t
+    {
+        ScalarKind = 0,
+        VectorKind,
+        Vector2dKind,
+        FormulaKind,
+        DistKind,
+        VectorDistKind,
+    };
+
+    /** Record types */
+    enum Record : uint8_t
+    {
+        SchemaRecord = 'S',
+        DataRecord = 'D',
+    };
+
+    /** Values stored per distribution, ahead of its buckets */
+    static constexpr size_type distFields = 10;
+
+    static constexpr uint32_t version = 1;
+
+    Binary(const std::string &file, bool desc, bool formulas, bool compress);
+
+    Binary() = delete;
+    Binary(const Binary &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /** A stat of the current schema and the shape of its values */
+    struct Column
+    {
+        const Info *info;
+        Kind kind;
+        size_type x;
+        size_type y;
+        /** Full name, only filled in when the schema is (re)written */
+        std::string name;
+    };
+
+    /**
+     * Check the next stat against the current schema, starting a new
+     * schema from this point on if it differs.
+     */
+    void addColumn(const Info &info, Kind kind, size_type x, size_type y);
+
+    /** Append the values of a distribution */
+    void addDist(const DistData &data);
+
+    void writeSchema();
+    void writeData();
+
+    /** Write a record with the contents of the scratch buffer */
+    void writeRecord(Record type);
+
+    void putVarint(uint64_t value);
+    void putString(const std::string &value);
+    void putDouble(double value);
+
+  protected:
+    const std::string fname;
+    const bool enableDescriptions;
+    const bool enableFormula;
+    const bool compress;
+
+    std::ofstream stream;
+
+    /** Group names leading to the stats being visited */
+    std::vector<std::string> path;
+
+    std::vector<Column> schema;
+    /** Next schema entry expected in the current dump */
+    size_t nextColumn;
+    /** Whether the current dump diverged from the schema */
+    bool schemaChanged;
+
+    /** Values of the current and the previous dump */
+    std::vector<double> values;
+    std::vector<double> lastValues;
+
+    /** Scratch buffer a record is built in before being written */
+    std::vector<uint8_t> buffer;
+};
+
+std::unique_ptr<Output> initBinary(const std::string &filename,
+                                   bool desc = false, bool formulas = true,
+                                   bool compress = true);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_BINARY_HH__
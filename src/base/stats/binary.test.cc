@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "base/stats/binary.hh"
+#include "base/stats/info.hh"
+#include "base/stats/units.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+// Instantiate the fake class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+/** Common implementation of the test stats, holding plain values */
+template <class Base>
+class TestInfo : public Base
+{
+  public:
+    TestInfo(const std::string &name)
+    {
+        this->setName(name, false);
+        this->unit = statistics::units::Count::get();
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return false; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+};
+
+class TestScalar : public TestInfo<statistics::ScalarInfo>
+{
+  public:
+    using TestInfo::TestInfo;
+
+    double val = 0;
+
+    statistics::Counter value() const override { return val; }
+    statistics::Result result() const override { return val; }
+    statistics::Result total() const override { return val; }
+};
+
+class TestVector : public TestInfo<statistics::VectorInfo>
+{
+  public:
+    using TestInfo::TestInfo;
+
+    statistics::VResult vals;
+
+    statistics::size_type size() const override { return vals.size(); }
+    const statistics::VCounter &value() const override { return vals; }
+    const statistics::VResult &result() const override { return vals; }
+    statistics::Result total() const override { return 0; }
+};
+
+class TestDist : public TestInfo<statistics::DistInfo>
+{
+  public:
+    using TestInfo::TestInfo;
+};
+
+/** The standalone reader of the format, m5.stats.binary */
+std::filesystem::path
+readerPath()
+{
+    return std::filesystem::path(__FILE__).parent_path() /
+        "../../python/m5/stats/binary.py";
+}
+
+/** Print a binary stats file with the Python reader */
+std::string
+readWithPython(const std::string &file)
+{
+    const std::string cmd = "python3 " + readerPath().string() + " " +
+        file + " 2>&1";
+    std::unique_ptr<FILE, int (*)(FILE *)> pipe(
+        popen(cmd.c_str(), "r"), pclose);
+    if (!pipe)
+        return "";
+
+    std::string output;
+    std::array<char, 256> chunk;
+    while (fgets(chunk.data(), chunk.size(), pipe.get()))
+        output += chunk.data();
+    return output;
+}
+
+class StatsBinaryRoundTrip : public testing::TestWithParam<bool>
+{
+  protected:
+    void
+    SetUp() override
+    {
+        if (!std::filesystem::exists(readerPath()))
+            GTEST_SKIP() << "Python reader not found";
+        if (std::system("python3 -c '' > /dev/null 2>&1") != 0)
+            GTEST_SKIP() << "python3 not available";
+
+        file = testing::TempDir() + "stats_binary_" +
+            (GetParam() ? "compressed" : "raw") + ".bin";
+    }
+
+    void TearDown() override { std::remove(file.c_str()); }
+
+    std::string file;
+};
+
+} // anonymous namespace
+
+/**
+ * Stats written by the C++ writer are read back with the same values by
+ * the Python reader, across dumps, negative and non-integral changes,
+ * and a change of the set of stats.
+ */
+TEST_P(StatsBinaryRoundTrip, WriteRead)
+{
+    TestScalar count("count");
+    TestScalar ratio("ratio");
+    TestVector vec("vec");
+    vec.subnames = {"a", "b"};
+    TestDist dist("dist");
+    dist.data.type = statistics::Dist;
+    dist.data.min = 0;
+    dist.data.max = 3;
+    dist.data.bucket_size = 2;
+    dist.data.logs = 0;
+    dist.data.underflow = 0;
+    dist.data.overflow = 0;
+    TestScalar late("late");
+
+    auto dump = [&](statistics::Binary &out, bool with_late) {
+        out.begin();
+        out.beginGroup("sys");
+        count.visit(out);
+        ratio.visit(out);
+        vec.visit(out);
+        dist.visit(out);
+        out.endGroup();
+        if (with_late) {
+            out.beginGroup("extra");
+            late.visit(out);
+            out.endGroup();
+        }
+        out.end();
+    };
+
+    {
+        statistics::Binary out(file, false, true, GetParam());
+
+        tickHandler.setCurTick(1000);
+        count.val = 5;
+        ratio.val = 0.5;
+        vec.vals = {1, 2};
+        dist.data.cvec = {1, 3};
+        dist.data.samples = 4;
+        dist.data.sum = 7;
+        dist.data.squares = 13;
+        dist.data.min_val = 1;
+        dist.data.max_val = 2;
+        dump(out, false);
+
+        // Counters going both ways, and a non-integral value
+        tickHandler.setCurTick(2000);
+        count.val = 3;
+        ratio.val = 0.25;
+        vec.vals = {1e15, -7};
+        dist.data.samples = 5;
+        dist.data.sum = 12;
+        dist.data.squares = 38;
+        dist.data.max_val = 5;
+        dist.data.overflow = 1;
+        dump(out, false);
+
+        // A new stat changes the schema
+        tickHandler.setCurTick(3000);
+        count.val = 4;
+        late.val = 42;
+        dump(out, true);
+
+        ASSERT_TRUE(out.valid());
+    }
+
+    const std::string dist_first =
+        "sys.dist {'min': 0.0, 'bucket_size': 2.0, 'samples': 4.0, "
+        "'sum': 7.0, 'squares': 13.0, 'logs': 0.0, 'min_val': 1.0, "
+        "'max_val': 2.0, 'underflow': 0.0, 'overflow': 0.0, "
+        "'buckets': [1.0, 3.0]}\n";
+    const std::string dist_next =
+        "sys.dist {'min': 0.0, 'bucket_size': 2.0, 'samples': 5.0, "
+        "'sum': 12.0, 'squares': 38.0, 'logs': 0.0, 'min_val': 1.0, "
+        "'max_val': 5.0, 'underflow': 0.0, 'overflow': 1.0, "
+        "'buckets': [1.0, 3.0]}\n";
+    const std::string expected =
+        "---------- Tick 1000 ----------\n"
+        "sys.count 5.0\n"
+        "sys.ratio 0.5\n"
+        "sys.vec [1.0, 2.0]\n" + dist_first +
+        "---------- Tick 2000 ----------\n"
+        "sys.count 3.0\n"
+        "sys.ratio 0.25\n"
+        "sys.vec [1000000000000000.0, -7.0]\n" + dist_next +
+        "---------- Tick 3000 ----------\n"
+        "sys.count 4.0\n"
+        "sys.ratio 0.25\n"
+        "sys.vec [1000000000000000.0, -7.0]\n" + dist_next +
+        "extra.late 42.0\n";
+
+    ASSERT_EQ(readWithPython(file), expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(Compression, StatsBinaryRoundTrip,
+                         testing::Values(false, true));
@@ -41,6 +41,7 @@
 #include "base/logging.hh"
 #include "base/named.hh"
 #include "base/stats/info.hh"
+#include "base/stats/output.hh"
 #include "base/trace.hh"
 #include "debug/Stats.hh"
 
@@ -156,6 +157,42 @@ Group::resolveStat(std::string name) const
     return nullptr;
 }
 
+size_t
+Group::visitChanged(Output &visitor, Version since) const
+{
+    std::vector<const char *> path;
+    size_t opened = 0;
+    return visitChanged(visitor, since, path, opened);
+}
+
+size_t
+Group::visitChanged(Output &visitor, Version since,
+                    std::vector<const char *> &path, size_t &opened) const
+{
+    size_t visited = 0;
+    for (auto *info : stats) {
+        if (info->version() <= since)
+            continue;
+
+        for (; opened < path.size(); ++opened)
+            visitor.beginGroup(path[opened]);
+        info->visit(visitor);
+        visited++;
+    }
+
+    for (const auto &g : statGroups) {
+        path.push_back(g.first.c_str());
+        visited += g.second->visitChanged(visitor, since, path, opened);
+        if (opened == path.size()) {
+            visitor.endGroup();
+            opened--;
+        }
+        path.pop_back();
+    }
+
+    return visited;
+}
+
 void
 Group::mergeStatGroup(Group *block)
 {
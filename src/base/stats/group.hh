@@ -43,6 +43,7 @@
 #include <vector>
 
 #include "base/compiler.hh"
+#include "base/stats/types.hh"
 #include "base/stats/units.hh"
 
 namespace gem5
@@ -79,6 +80,7 @@ namespace statistics
 {
 
 class Info;
+struct Output;
 
 /**
  * Statistics container.
@@ -204,6 +206,19 @@ class Group
      */
     const Info * resolveStat(std::string name) const;
 
+    /**
+     * Visit the stats in this group and its sub-groups that were
+     * modified after a given version of the stats. Sub-groups without
+     * any such stats are skipped entirely, including their beginGroup()
+     * and endGroup() calls to the visitor.
+     *
+     * @param visitor Output to visit the stats with
+     * @param since Version of the stats after which stats must have been
+     * modified to be visited
+     * @return Number of stats visited
+     */
+    size_t visitChanged(Output &visitor, Version since) const;
+
     /**
      * Merge the contents (stats & children) of a block to this block.
      *
@@ -213,6 +228,14 @@ class Group
     void mergeStatGroup(Group *block);
 
   private:
+    /**
+     * Helper for visitChanged() opening the groups in path, from index
+     * opened onwards, only once a stat is visited in them.
+     */
+    size_t visitChanged(Output &visitor, Version since,
+                        std::vector<const char *> &path,
+                        size_t &opened) const;
+
     /** Parent pointer if merged into parent */
     Group *mergedParent;
 
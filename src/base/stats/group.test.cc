@@ -29,6 +29,9 @@
 #include <gtest/gtest-spi.h>
 #include <gtest/gtest.h>
 
+#include <string>
+#include <vector>
+
 #include "base/stats/group.hh"
 #include "base/stats/info.hh"
 #include "base/stats/output.hh"
@@ -657,3 +660,96 @@ TEST(StatsGroupTest, ResolveStatMergedSubGroup)
     ASSERT_NE(info_found, nullptr);
     ASSERT_EQ(info_found->name, "InfoResolveStatMergedSubGroup");
 }
+
+/** Output recording the groups and stats visited */
+class RecordingOutput : public statistics::Output
+{
+  public:
+    std::vector<std::string> log;
+
+    void begin() override {}
+    void end() override {}
+    bool valid() const override { return true; }
+
+    void
+    beginGroup(const char *name) override
+    {
+        log.push_back(std::string("begin ") + name);
+    }
+
+    void endGroup() override { log.push_back("end"); }
+
+    void visit(const statistics::ScalarInfo &info) override {}
+    void visit(const statistics::VectorInfo &info) override {}
+    void visit(const statistics::DistInfo &info) override {}
+    void visit(const statistics::VectorDistInfo &info) override {}
+    void visit(const statistics::Vector2dInfo &info) override {}
+    void visit(const statistics::FormulaInfo &info) override {}
+    void visit(const statistics::SparseHistInfo &info) override {}
+};
+
+class VersionedDummyInfo : public DummyInfo
+{
+  public:
+    statistics::Version modified = 0;
+
+    statistics::Version version() const override { return modified; }
+
+    void
+    visit(statistics::Output &visitor) override
+    {
+        static_cast<RecordingOutput &>(visitor).log.push_back(name);
+    }
+};
+
+/**
+ * Test that only the stats modified after a given version are visited,
+ * and that groups without such stats are skipped.
+ */
+TEST(StatsGroupTest, VisitChanged)
+{
+    statistics::Group root(nullptr);
+    statistics::Group node1(nullptr);
+    statistics::Group node1_1(nullptr);
+    statistics::Group node2(nullptr);
+    root.addStatGroup("Node1", &node1);
+    node1.addStatGroup("Node1_1", &node1_1);
+    root.addStatGroup("Node2", &node2);
+
+    VersionedDummyInfo info_root, info1, info1_1, info2;
+    info_root.setName("InfoRoot");
+    info1.setName("Info1");
+    info1_1.setName("Info1_1");
+    info2.setName("Info2");
+    root.addStat(&info_root);
+    node1.addStat(&info1);
+    node1_1.addStat(&info1_1);
+    node2.addStat(&info2);
+
+    info_root.modified = 1;
+    info1.modified = 1;
+    info1_1.modified = 2;
+    info2.modified = 1;
+
+    RecordingOutput all;
+    ASSERT_EQ(root.visitChanged(all, 0), 4);
+    std::vector<std::string> expected_all = {
+        "InfoRoot",
+        "begin Node1", "Info1",
+        "begin Node1_1", "Info1_1", "end",
+        "end",
+        "begin Node2", "Info2", "end",
+    };
+    ASSERT_EQ(all.log, expected_all);
+
+    RecordingOutput changed;
+    ASSERT_EQ(root.visitChanged(changed, 1), 1);
+    std::vector<std::string> expected_changed = {
+        "begin Node1", "begin Node1_1", "Info1_1", "end", "end",
+    };
+    ASSERT_EQ(changed.log, expected_changed);
+
+    RecordingOutput none;
+    ASSERT_EQ(root.visitChanged(none, 2), 0);
+    ASSERT_TRUE(none.log.empty());
+}
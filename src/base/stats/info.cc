@@ -196,6 +196,12 @@ Info::enable()
 {
 }
 
+Version
+Info::version() const
+{
+    return currentVersion();
+}
+
 void
 VectorInfo::enable()
 {
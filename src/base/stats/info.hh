@@ -157,6 +157,13 @@ class Info
      */
     virtual bool zero() const = 0;
 
+    /**
+     * @return The version of the stats in which this stat was last
+     * modified. Stats that can't tell when their value changes (e.g.,
+     * formulas) report the current version.
+     */
+    virtual Version version() const;
+
     /**
      * Visitor entry for outputing statistics data
      */
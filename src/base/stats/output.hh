@@ -45,6 +45,7 @@
 #include <string>
 
 #include "base/compiler.hh"
+#include "base/stats/types.hh"
 
 namespace gem5
 {
@@ -70,6 +71,16 @@ struct Output
     virtual void end() = 0;
     virtual bool valid() const = 0;
 
+    /**
+     * Outputs may only want the stats that changed since they were last
+     * dumped. Stats (and groups without any such stats) that weren't
+     * modified after the returned version are then not visited.
+     *
+     * @return Version of the stats after which stats must have been
+     * modified to be dumped, 0 to dump all stats.
+     */
+    virtual Version changedSince() const { return 0; }
+
     virtual void beginGroup(const char *name) = 0;
     virtual void endGroup() = 0;
 
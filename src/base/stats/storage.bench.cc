@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Microbenchmark of the distribution storages, comparing sampling values
+ * one at a time with sampling them in batches, and of the scalar storage,
+ * comparing it with a bare counter to measure the cost of tracking the
+ * version of the stats. The results of both are checked to match, and the
+ * timings are printed and recorded as test properties.
+ *
+ * The benchmarks are disabled so that they do not slow down the unit tests.
+ * Run them with --gtest_also_run_disabled_tests.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "base/stats/storage.hh"
+
+using namespace gem5;
+
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+/** Number of values sampled in every run */
+const size_t numValues = 1 << 22;
+
+/** Number of values sampled per batch */
+const size_t batchSize = 64;
+
+/** Latency-like values, mostly small with a long tail */
+std::vector<uint64_t>
+makeValues()
+{
+    std::mt19937_64 gen(0x5eed);
+    std::geometric_distribution<uint64_t> dist(0.01);
+    std::vector<uint64_t> values(numValues);
+    for (auto &value : values)
+        value = dist(gen);
+    return values;
+}
+
+/** Time a function in ns per value */
+template <typename F>
+double
+timeNs(F &&f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() /
+        numValues;
+}
+
+/**
+ * Sample the same values one by one and in batches into two storages,
+ * report the time taken and check the results match.
+ */
+template <typename Stor, typename Params>
+void
+benchmark(const std::string &name, const Params &params)
+{
+    const std::vector<uint64_t> values = makeValues();
+    Stor single(&params);
+    Stor batch(&params);
+
+    double single_ns = timeNs([&]() {
+        for (auto value : values)
+            single.sample(value, 1);
+    });
+    double batch_ns = timeNs([&]() {
+        for (size_t i = 0; i < values.size(); i += batchSize)
+            batch.sampleBatch(&values[i], batchSize);
+    });
+
+    std::cout << name << ": " << single_ns << " ns/sample, "
+              << batch_ns << " ns/sample batched" << std::endl;
+    testing::Test::RecordProperty(name + "_ns", std::to_string(single_ns));
+    testing::Test::RecordProperty(name + "_batch_ns",
+                                  std::to_string(batch_ns));
+
+    statistics::DistData single_data{};
+    statistics::DistData batch_data{};
+    single.prepare(&params, single_data);
+    batch.prepare(&params, batch_data);
+    ASSERT_EQ(single_data.samples, batch_data.samples);
+    ASSERT_EQ(single_data.sum, batch_data.sum);
+    ASSERT_EQ(single_data.bucket_size, batch_data.bucket_size);
+    ASSERT_EQ(single_data.cvec, batch_data.cvec);
+}
+
+/**
+ * Increment scalar storages and bare counters with the same values, in
+ * the same order, without and then with version tracking, report the time
+ * taken and check the results match.
+ */
+void
+benchmarkScalar(const std::string &name, size_t num_stats)
+{
+    const std::vector<uint64_t> values = makeValues();
+    statistics::StatStor::Params params;
+    std::vector<statistics::StatStor> stors(num_stats, &params);
+    std::vector<statistics::Counter> counters(num_stats);
+
+    // Spread the updates over the stats like a simulated system would
+    auto index = [&](size_t i) { return (i * 2654435761u) % num_stats; };
+    auto inc_stors = [&]() {
+        for (size_t i = 0; i < values.size(); ++i)
+            stors[index(i)].inc(values[i]);
+    };
+
+    double counter_ns = timeNs([&]() {
+        for (size_t i = 0; i < values.size(); ++i)
+            counters[index(i)] += values[i];
+    });
+    double stor_ns = timeNs(inc_stors);
+    statistics::trackVersions();
+    double tracked_ns = timeNs(inc_stors);
+
+    std::cout << name << ": " << counter_ns << " ns/inc bare counter, "
+              << stor_ns << " ns/inc, " << tracked_ns
+              << " ns/inc tracking versions" << std::endl;
+    testing::Test::RecordProperty(name + "_counter_ns",
+                                  std::to_string(counter_ns));
+    testing::Test::RecordProperty(name + "_ns", std::to_string(stor_ns));
+    testing::Test::RecordProperty(name + "_tracked_ns",
+                                  std::to_string(tracked_ns));
+
+    for (size_t i = 0; i < num_stats; ++i)
+        ASSERT_EQ(stors[i].value(), 2 * counters[i]);
+}
+
+} // anonymous namespace
+
+TEST(StatsStorageBench, DISABLED_DistPowerOf2)
+{
+    benchmark<statistics::DistStor>("dist_pow2",
+        statistics::DistStor::Params(0, 1023, 16));
+}
+
+TEST(StatsStorageBench, DISABLED_DistNonPowerOf2)
+{
+    benchmark<statistics::DistStor>("dist",
+        statistics::DistStor::Params(0, 999, 10));
+}
+
+TEST(StatsStorageBench, DISABLED_Hist)
+{
+    benchmark<statistics::HistStor>("hist",
+        statistics::HistStor::Params(32));
+}
+
+TEST(StatsStorageBench, DISABLED_Sample)
+{
+    benchmark<statistics::SampleStor>("sample",
+        statistics::SampleStor::Params());
+}
+
+TEST(StatsStorageBench, DISABLED_Scalar)
+{
+    benchmarkScalar("scalar", 4096);
+}
@@ -41,6 +41,7 @@
 
 #include "base/stats/storage.hh"
 
+#include <algorithm>
 #include <cmath>
 
 namespace gem5
@@ -59,7 +60,7 @@ DistStor::sample(Counter val, int number)
     else if (val > max_track)
         overflow += number;
     else {
-        cvec[std::floor((val - min_track) / bucket_size)] += number;
+        cvec[bucketIndex(val)] += number;
     }
 
     if (val < min_val)
@@ -71,6 +72,27 @@ DistStor::sample(Counter val, int number)
     sum += val * number;
     squares += val * val * number;
     samples += number;
+    touch();
+}
+
+void
+DistStor::add(DistStor *other)
+{
+    assert(size() == other->size());
+    assert(min_track == other->min_track);
+    assert(bucket_size == other->bucket_size);
+
+    min_val = std::min(min_val, other->min_val);
+    max_val = std::max(max_val, other->max_val);
+    underflow += other->underflow;
+    overflow += other->overflow;
+    for (size_type i = 0; i < size(); i++)
+        cvec[i] += other->cvec[i];
+
+    sum += other->sum;
+    squares += other->squares;
+    samples += other->samples;
+    touch();
 }
 
 void
@@ -110,6 +132,7 @@ HistStor::growOut()
     max_bucket *= 2;
     min_bucket *= 2;
     bucket_size *= 2;
+    bucket_shift++;
 }
 
 void
@@ -149,6 +172,7 @@ HistStor::growDown()
 
     // Only update the bucket size once the range has been updated
     bucket_size *= 2;
+    bucket_shift++;
 }
 
 void
@@ -171,12 +195,12 @@ HistStor::growUp()
 
     max_bucket *= 2;
     bucket_size *= 2;
+    bucket_shift++;
 }
 
 void
-HistStor::sample(Counter val, int number)
+HistStor::grow(Counter val)
 {
-    assert(min_bucket < max_bucket);
     if (val < min_bucket) {
         if (min_bucket == 0)
             growDown();
@@ -192,10 +216,17 @@ HistStor::sample(Counter val, int number)
                 growOut();
         }
     }
+}
+
+void
+HistStor::sample(Counter val, int number)
+{
+    assert(min_bucket < max_bucket);
+    if (outOfRange(val))
+        grow(val);
 
     assert(bucket_size > 0);
-    size_type index =
-        (int64_t)std::floor((val - min_bucket) / bucket_size);
+    size_type index = bucketIndex(val);
 
     assert(index < size());
     cvec[index] += number;
@@ -204,6 +235,7 @@ HistStor::sample(Counter val, int number)
     squares += val * val * number;
     logs += std::log(val) * number;
     samples += number;
+    touch();
 }
 
 void
@@ -225,6 +257,7 @@ HistStor::add(HistStor *hs)
 
     for (uint32_t i = 0; i < b_size; i++)
         cvec[i] += hs->cvec[i];
+    touch();
 }
 
 } // namespace statistics
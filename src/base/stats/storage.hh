@@ -30,11 +30,16 @@
 #ifndef __BASE_STATS_STORAGE_HH__
 #define __BASE_STATS_STORAGE_HH__
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <memory>
 
 #include "base/cast.hh"
 #include "base/compiler.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/stats/types.hh"
 #include "sim/cur_tick.hh"
@@ -51,10 +56,103 @@ struct StorageParams
     virtual ~StorageParams() = default;
 };
 
+/**
+ * The current version of the stats. Starts at 1 so that version 0
+ * predates any change to the stats.
+ *
+ * The version only advances after a stats dump, while the simulation
+ * threads are stopped at a barrier, so relaxed accesses are enough:
+ * the barrier orders the increment with the updates of the stats.
+ */
+inline std::atomic<Version> _currentVersion = 1;
+
+inline Version
+currentVersion()
+{
+    return _currentVersion.load(std::memory_order_relaxed);
+}
+
+/**
+ * Advance the version of the stats, called after every stats dump.
+ */
+inline void
+advanceVersion()
+{
+    _currentVersion.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Whether the storages record the version in which they were last
+ * modified. Only outputs dumping the changed stats need it, so it is
+ * off by default to keep the updates of the stats to a single store.
+ */
+inline bool _trackVersions = false;
+
+inline bool trackingVersions() { return _trackVersions; }
+
+/**
+ * Make the storages record the version in which they were last
+ * modified. Must be called before the simulation starts.
+ */
+inline void trackVersions() { _trackVersions = true; }
+
+/**
+ * The number of shards of the sharded storages, one per simulation
+ * thread. It must be set before the stats are created, stats created
+ * earlier are not sharded.
+ */
+inline unsigned _numShards = 1;
+
+/** The shard updated by the current thread, 0 for the main thread. */
+inline thread_local unsigned _shard = 0;
+
+inline unsigned numShards() { return _numShards; }
+inline void setNumShards(unsigned num_shards) { _numShards = num_shards; }
+
+/**
+ * Set the shard updated by the calling thread.
+ */
+inline void setShard(unsigned shard) { _shard = shard; }
+
+/**
+ * Common storage base recording the version of the stats in which the
+ * storage was last modified.
+ */
+class VersionedStor
+{
+  private:
+    /** The version of the stats at the last modification. */
+    Version modified;
+
+  protected:
+    VersionedStor() : modified(currentVersion()) { }
+
+    /**
+     * Record a modification of the stat value.
+     */
+    void
+    touch()
+    {
+        if (trackingVersions())
+            modified = currentVersion();
+    }
+
+  public:
+    /**
+     * @return The version of the stats the value was last modified in,
+     * or the current version if versions are not tracked.
+     */
+    Version
+    version() const
+    {
+        return trackingVersions() ? modified : currentVersion();
+    }
+};
+
 /**
  * Templatized storage and interface for a simple scalar stat.
  */
-class StatStor
+class StatStor : public VersionedStor
 {
   private:
     /** The statistic value. */
@@ -75,19 +173,25 @@ class StatStor
      * The the stat to the given value.
      * @param val The new value.
      */
-    void set(Counter val) { data = val; }
+    void set(Counter val) { data = val; touch(); }
 
     /**
      * Increment the stat by the given value.
      * @param val The new value.
      */
-    void inc(Counter val) { data += val; }
+    void inc(Counter val) { data += val; touch(); }
 
     /**
      * Decrement the stat by the given value.
      * @param val The new value.
      */
-    void dec(Counter val) { data -= val; }
+    void dec(Counter val) { data -= val; touch(); }
+
+    /**
+     * Adds the value of the given storage to this storage.
+     * @param other The other storage to be added.
+     */
+    void add(StatStor *other) { data += other->data; touch(); }
 
     /**
      * Return the value of this stat as its base type.
@@ -109,7 +213,12 @@ class StatStor
     /**
      * Reset stat value to default
      */
-    void reset(const StorageParams* const storage_params) { data = Counter(); }
+    void
+    reset(const StorageParams* const storage_params)
+    {
+        data = Counter();
+        touch();
+    }
 
     /**
      * @return true if zero value
@@ -124,7 +233,7 @@ class StatStor
  * being watched. This is good for keeping track of residencies in structures
  * among other things.
  */
-class AvgStor
+class AvgStor : public VersionedStor
 {
   private:
     /** The current count. */
@@ -157,6 +266,7 @@ class AvgStor
         total += current * (curTick() - last);
         last = curTick();
         current = val;
+        touch();
     }
 
     /**
@@ -193,6 +303,19 @@ class AvgStor
      */
     bool zero() const { return total == 0.0; }
 
+    /**
+     * The average changes with time once anything has been counted, so
+     * the storage is only unmodified as long as it stays zero.
+     * @return The version of the stats the value was last modified in.
+     */
+    Version
+    version() const
+    {
+        if (total == 0.0 && current == 0)
+            return VersionedStor::version();
+        return currentVersion();
+    }
+
     /**
      * Prepare stat data for dumping or serialization
      */
@@ -212,6 +335,7 @@ class AvgStor
         total = 0.0;
         last = curTick();
         lastReset = curTick();
+        touch();
     }
 
 };
@@ -230,7 +354,7 @@ struct DistParams : public StorageParams
  * in buckets themselves; two special counters, underflow and overflow store
  * the number of occurrences of such values.
  */
-class DistStor
+class DistStor : public VersionedStor
 {
   private:
     /** The minimum value to track. */
@@ -239,6 +363,11 @@ class DistStor
     Counter max_track;
     /** The number of entries in each bucket. */
     Counter bucket_size;
+    /**
+     * log2 of the bucket size when it is an integral power of two, in
+     * which case buckets are found with a shift, or -1.
+     */
+    int bucket_shift;
 
     /** The smallest value sampled. */
     Counter min_val;
@@ -257,6 +386,19 @@ class DistStor
     /** Counter for each bucket. */
     VCounter cvec;
 
+    /**
+     * Index of the bucket of a value within [min_track, max_track].
+     * Values are non-negative once offset by min_track, so truncating
+     * them and shifting gives the same bucket as the floored division.
+     */
+    size_type
+    bucketIndex(Counter val) const
+    {
+        if (bucket_shift >= 0)
+            return (uint64_t)(val - min_track) >> bucket_shift;
+        return std::floor((val - min_track) / bucket_size);
+    }
+
   public:
     /** The parameters for a distribution stat. */
     struct Params : public DistParams
@@ -298,6 +440,46 @@ class DistStor
      */
     void sample(Counter val, int number);
 
+    /**
+     * Adds the contents of the given storage to this storage.
+     * @param other The other storage to be added.
+     */
+    void add(DistStor *other);
+
+    /**
+     * Add each of an array of values to the distribution once. This is
+     * equivalent to sampling them one by one, but keeps the running
+     * totals in registers and only marks the storage modified once.
+     * @param vals The values to add.
+     * @param count The number of values.
+     */
+    template <typename U>
+    void
+    sampleBatch(const U *vals, size_type count)
+    {
+        Counter lo = min_val, hi = max_val;
+        Counter s = sum, sq = squares;
+        for (size_type i = 0; i < count; ++i) {
+            const Counter val = vals[i];
+            if (val < min_track)
+                ++underflow;
+            else if (val > max_track)
+                ++overflow;
+            else
+                ++cvec[bucketIndex(val)];
+            lo = std::min(lo, val);
+            hi = std::max(hi, val);
+            s += val;
+            sq += val * val;
+        }
+        min_val = lo;
+        max_val = hi;
+        sum = s;
+        squares = sq;
+        samples += count;
+        touch();
+    }
+
     /**
      * Return the number of buckets in this distribution.
      * @return the number of buckets.
@@ -349,6 +531,12 @@ class DistStor
         min_track = params->min;
         max_track = params->max;
         bucket_size = params->bucket_size;
+        bucket_shift = -1;
+        if (bucket_size >= 1 && bucket_size < 0x1p63 &&
+                bucket_size == std::floor(bucket_size) &&
+                isPowerOf2((uint64_t)bucket_size)) {
+            bucket_shift = floorLog2((uint64_t)bucket_size);
+        }
 
         min_val = CounterLimits::max();
         max_val = CounterLimits::min();
@@ -362,6 +550,7 @@ class DistStor
         sum = Counter();
         squares = Counter();
         samples = Counter();
+        touch();
     }
 };
 
@@ -396,7 +585,7 @@ class DistStor
  * buckets are grown, the zero bucket would grow its range to [-4,4[, which
  * cannot be easily extracted from the neighor buckets.
  */
-class HistStor
+class HistStor : public VersionedStor
 {
   private:
     /** Lower bound of the first bucket's range. */
@@ -405,6 +594,8 @@ class HistStor
     Counter max_bucket;
     /** The number of entries in each bucket. */
     Counter bucket_size;
+    /** log2 of the bucket size, which is always a power of two. */
+    int bucket_shift;
 
     /** The current sum. */
     Counter sum;
@@ -455,6 +646,32 @@ class HistStor
      */
     void growDown();
 
+    /**
+     * Grow the buckets until they cover a value.
+     * @param val The value to cover.
+     */
+    void grow(Counter val);
+
+    /**
+     * Index of the bucket of a value the buckets cover. The bucket size
+     * being a power of two, the floored division is a shift of the
+     * truncated, non-negative, offset from the first bucket.
+     */
+    size_type
+    bucketIndex(Counter val) const
+    {
+        return (uint64_t)(val - min_bucket) >> bucket_shift;
+    }
+
+    /**
+     * Whether a value falls outside of the buckets.
+     */
+    bool
+    outOfRange(Counter val) const
+    {
+        return val < min_bucket || val >= max_bucket + bucket_size;
+    }
+
   public:
     /** The parameters for a distribution stat. */
     struct Params : public DistParams
@@ -490,6 +707,35 @@ class HistStor
      */
     void sample(Counter val, int number);
 
+    /**
+     * Add each of an array of values to the histogram once, with the same
+     * result as sampling them one by one.
+     * @param vals The values to add.
+     * @param count The number of values.
+     */
+    template <typename U>
+    void
+    sampleBatch(const U *vals, size_type count)
+    {
+        Counter s = sum, sq = squares, lg = logs;
+        for (size_type i = 0; i < count; ++i) {
+            const Counter val = vals[i];
+            if (outOfRange(val))
+                grow(val);
+            const size_type index = bucketIndex(val);
+            assert(index < size());
+            ++cvec[index];
+            s += val;
+            sq += val * val;
+            lg += std::log(val);
+        }
+        sum = s;
+        squares = sq;
+        logs = lg;
+        samples += count;
+        touch();
+    }
+
     /**
      * Return the number of buckets in this distribution.
      * @return the number of buckets.
@@ -541,6 +787,7 @@ class HistStor
         min_bucket = 0;
         max_bucket = params->buckets - 1;
         bucket_size = 1;
+        bucket_shift = 0;
 
         size_type size = cvec.size();
         for (off_type i = 0; i < size; ++i)
@@ -550,6 +797,7 @@ class HistStor
         squares = Counter();
         samples = Counter();
         logs = Counter();
+        touch();
     }
 };
 
@@ -557,7 +805,7 @@ class HistStor
  * Templatized storage and interface for a distribution that calculates mean
  * and variance.
  */
-class SampleStor
+class SampleStor : public VersionedStor
 {
   private:
     /** The current sum. */
@@ -593,6 +841,28 @@ class SampleStor
         sum += val * number;
         squares += val * val * number;
         samples += number;
+        touch();
+    }
+
+    /**
+     * Add each of an array of values once.
+     * @param vals The values to add.
+     * @param count The number of values.
+     */
+    template <typename U>
+    void
+    sampleBatch(const U *vals, size_type count)
+    {
+        Counter s = sum, sq = squares;
+        for (size_type i = 0; i < count; ++i) {
+            const Counter val = vals[i];
+            s += val;
+            sq += val * val;
+        }
+        sum = s;
+        squares = sq;
+        samples += count;
+        touch();
     }
 
     /**
@@ -628,6 +898,7 @@ class SampleStor
         sum = Counter();
         squares = Counter();
         samples = Counter();
+        touch();
     }
 };
 
@@ -635,7 +906,7 @@ class SampleStor
  * Templatized storage for distribution that calculates per tick mean and
  * variance.
  */
-class AvgSampleStor
+class AvgSampleStor : public VersionedStor
 {
   private:
     /** Current total. */
@@ -667,6 +938,27 @@ class AvgSampleStor
     {
         sum += val * number;
         squares += val * val * number;
+        touch();
+    }
+
+    /**
+     * Add each of an array of values once.
+     * @param vals The values to add.
+     * @param count The number of values.
+     */
+    template <typename U>
+    void
+    sampleBatch(const U *vals, size_type count)
+    {
+        Counter s = sum, sq = squares;
+        for (size_type i = 0; i < count; ++i) {
+            const Counter val = vals[i];
+            s += val;
+            sq += val * val;
+        }
+        sum = s;
+        squares = sq;
+        touch();
     }
 
     /**
@@ -681,6 +973,18 @@ class AvgSampleStor
      */
     bool zero() const { return sum == Counter(); }
 
+    /**
+     * The per tick mean changes with time once anything has been
+     * sampled, so the storage is only unmodified as long as it stays
+     * zero.
+     * @return The version of the stats the value was last modified in.
+     */
+    Version
+    version() const
+    {
+        return zero() ? VersionedStor::version() : currentVersion();
+    }
+
     void
     prepare(const StorageParams* const storage_params, DistData &data)
     {
@@ -701,6 +1005,7 @@ class AvgSampleStor
     {
         sum = Counter();
         squares = Counter();
+        touch();
     }
 };
 
@@ -711,7 +1016,7 @@ class AvgSampleStor
  * need to keep track of the samples that occur in between two distant
  * sampled values.
  */
-class SparseHistStor
+class SparseHistStor : public VersionedStor
 {
   private:
     /** Counter for number of samples */
@@ -741,6 +1046,7 @@ class SparseHistStor
     {
         cmap[val] += number;
         samples += number;
+        touch();
     }
 
     /**
@@ -779,6 +1085,248 @@ class SparseHistStor
     {
         cmap.clear();
         samples = 0;
+        touch();
+    }
+};
+
+/**
+ * Storage split in one shard per simulation thread, so that a stat of
+ * an object shared between event queues can be updated from several
+ * threads without synchronization. Every thread updates its own shard,
+ * the main thread using the wrapped storage itself, and the other
+ * shards are folded into it when the stat is prepared for a dump, at
+ * which point the simulation threads are synchronized. The value of the
+ * stat, too, is only exact when the threads are synchronized. The
+ * shards of the other threads are only allocated when they first update
+ * the stat, so that stats only updated by the main thread cost nothing.
+ *
+ * Values are the sum over the shards, except that the value set at the
+ * latest tick replaces the updates of all the threads since the previous
+ * dump. Values set at the same tick by different threads are not
+ * ordered, the one of the last shard is used.
+ */
+template <class Stor>
+class ShardedStor : public Stor
+{
+  private:
+    /** A shard, on its own cache lines to avoid false sharing. */
+    struct alignas(64) Shard
+    {
+        Stor stor;
+        /** Tick of the last set of the shard, MaxTick if not set */
+        Tick lastSet = MaxTick;
+
+        Shard(const StorageParams* const storage_params)
+            : stor(storage_params)
+        {}
+    };
+
+    const StorageParams* const storageParams;
+    /** Number of shards other than the wrapped storage. */
+    const unsigned numOthers;
+    /**
+     * Shards 1 to numShards() - 1, nullptr until a thread other than
+     * the main one updates the stat. Each of them is nullptr until its
+     * thread updates the stat.
+     */
+    std::atomic<Shard **> shards;
+    /** Tick of the last set of the wrapped storage, MaxTick if not set */
+    Tick lastSet;
+
+    /**
+     * The shard of the current thread, allocated on its first update.
+     *
+     * @return The shard, nullptr for the wrapped storage
+     */
+    Shard *
+    localShard()
+    {
+        const unsigned shard = _shard;
+        if (GEM5_LIKELY(!shard || !numOthers))
+            return nullptr;
+        assert(shard <= numOthers);
+
+        Shard **table = shards.load(std::memory_order_acquire);
+        if (GEM5_UNLIKELY(!table)) {
+            // Threads race to allocate the table, but only the slot of
+            // their own shard is written afterwards
+            Shard **fresh = new Shard *[numOthers]();
+            if (shards.compare_exchange_strong(table, fresh,
+                                               std::memory_order_acq_rel)) {
+                table = fresh;
+            } else {
+                delete [] fresh;
+            }
+        }
+
+        Shard *&local = table[shard - 1];
+        if (GEM5_UNLIKELY(!local))
+            local = new Shard(storageParams);
+        return local;
+    }
+
+    /** The storage updated by the current thread. */
+    Stor &
+    local()
+    {
+        Shard *shard = localShard();
+        return shard ? shard->stor : *this;
+    }
+
+    /** Call f on every shard allocated so far. */
+    template <typename F>
+    void
+    forEachShard(F f) const
+    {
+        Shard **table = shards.load(std::memory_order_acquire);
+        if (!table)
+            return;
+        for (unsigned i = 0; i < numOthers; ++i) {
+            if (table[i])
+                f(*table[i]);
+        }
+    }
+
+    /**
+     * The storage holding the last value set since the previous dump.
+     *
+     * @return The storage, nullptr if the stat was not set
+     */
+    const Stor *
+    lastSetStor() const
+    {
+        const Stor *stor = lastSet != MaxTick ? this : nullptr;
+        Tick last = lastSet;
+        forEachShard([&stor, &last](const Shard &shard) {
+            if (shard.lastSet != MaxTick && (!stor || shard.lastSet >= last)) {
+                last = shard.lastSet;
+                stor = &shard.stor;
+            }
+        });
+        return stor;
+    }
+
+    /** Fold the contents of the other shards into the wrapped storage. */
+    void
+    fold(const StorageParams* const storage_params)
+    {
+        const Stor *set_stor = lastSetStor();
+        if (set_stor && set_stor != this) {
+            Stor::reset(storage_params);
+            Stor::add(const_cast<Stor *>(set_stor));
+        }
+        forEachShard([this, set_stor, storage_params](Shard &shard) {
+            if (!set_stor && !shard.stor.zero())
+                Stor::add(&shard.stor);
+            if (!shard.stor.zero())
+                shard.stor.reset(storage_params);
+            shard.lastSet = MaxTick;
+        });
+        lastSet = MaxTick;
+    }
+
+  public:
+    ShardedStor(const StorageParams* const storage_params)
+        : Stor(storage_params), storageParams(storage_params),
+          numOthers(numShards() > 1 ? numShards() - 1 : 0), shards(nullptr),
+          lastSet(MaxTick)
+    {}
+
+    ShardedStor(const ShardedStor &) = delete;
+    ShardedStor &operator=(const ShardedStor &) = delete;
+
+    ~ShardedStor()
+    {
+        Shard **table = shards.load(std::memory_order_acquire);
+        if (!table)
+            return;
+        for (unsigned i = 0; i < numOthers; ++i)
+            delete table[i];
+        delete [] table;
+    }
+
+    void
+    set(Counter val)
+    {
+        Shard *shard = localShard();
+        if (shard) {
+            shard->stor.set(val);
+            shard->lastSet = curTick();
+        } else {
+            Stor::set(val);
+            if (numOthers)
+                lastSet = curTick();
+        }
+    }
+
+    void inc(Counter val) { local().inc(val); }
+    void dec(Counter val) { local().dec(val); }
+    void sample(Counter val, int number) { local().sample(val, number); }
+
+    template <typename U>
+    void
+    sampleBatch(const U *vals, size_type count)
+    {
+        local().sampleBatch(vals, count);
+    }
+
+    /**
+     * The sum of the values of the shards, or the last value set. Meant to
+     * be called when the simulation threads are synchronized.
+     */
+    Counter
+    value() const
+    {
+        if (const Stor *set_stor = lastSetStor())
+            return set_stor->value();
+        Counter val = Stor::value();
+        forEachShard([&val](const Shard &shard) {
+            val += shard.stor.value();
+        });
+        return val;
+    }
+
+    Result result() const { return (Result)value(); }
+
+    bool
+    zero() const
+    {
+        if (const Stor *set_stor = lastSetStor())
+            return set_stor->zero();
+        bool zero = Stor::zero();
+        forEachShard([&zero](const Shard &shard) {
+            zero = zero && shard.stor.zero();
+        });
+        return zero;
+    }
+
+    Version
+    version() const
+    {
+        Version ver = Stor::version();
+        forEachShard([&ver](const Shard &shard) {
+            ver = std::max(ver, shard.stor.version());
+        });
+        return ver;
+    }
+
+    template <typename... Data>
+    void
+    prepare(const StorageParams* const storage_params, Data &...data)
+    {
+        fold(storage_params);
+        Stor::prepare(storage_params, data...);
+    }
+
+    void
+    reset(const StorageParams* const storage_params)
+    {
+        forEachShard([storage_params](Shard &shard) {
+            shard.stor.reset(storage_params);
+            shard.lastSet = MaxTick;
+        });
+        lastSet = MaxTick;
+        Stor::reset(storage_params);
     }
 };
 
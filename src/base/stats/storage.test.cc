@@ -30,6 +30,9 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include "base/gtest/cur_tick_fake.hh"
 #include "base/gtest/logging.hh"
@@ -129,6 +132,31 @@ TEST(StatsStatStorTest, ZeroReset)
     ASSERT_FALSE(stor.zero());
 }
 
+/**
+ * Test that the storage records the version of the stats in which it was
+ * last modified.
+ */
+TEST(StatsStatStorTest, Version)
+{
+    statistics::trackVersions();
+    statistics::StatStor stor(nullptr);
+    const statistics::Version created = statistics::currentVersion();
+    ASSERT_EQ(stor.version(), created);
+
+    // Reading or preparing the stat doesn't modify it
+    statistics::advanceVersion();
+    stor.value();
+    stor.prepare(nullptr);
+    ASSERT_EQ(stor.version(), created);
+
+    stor.inc(1);
+    ASSERT_EQ(stor.version(), created + 1);
+
+    statistics::advanceVersion();
+    stor.reset(nullptr);
+    ASSERT_EQ(stor.version(), created + 2);
+}
+
 /** Test setting and getting a value to the storage. */
 TEST(StatsAvgStorTest, SetValueResult)
 {
@@ -471,6 +499,55 @@ TEST(StatsDistStorTest, Reset)
     checkExpectedDistData(data, expected_data, true);
 }
 
+/**
+ * Test that sampling a batch of values gives the same result as sampling
+ * them one by one, both with a power of two bucket size, where buckets are
+ * found with a shift, and without.
+ */
+TEST(StatsDistStorTest, SampleBatch)
+{
+    const statistics::Counter values[] = {10, 1234, 12345678, -10, 17, 52,
+        18, 0, 99, -1, 100, 3.5, 63.9, 64};
+    const int num_values = sizeof(values) / sizeof(values[0]);
+
+    for (statistics::Counter bucket_size : {1.0, 4.0, 5.0, 2.5}) {
+        statistics::DistStor::Params params(-4, 99, bucket_size);
+        statistics::DistStor stor(&params);
+        statistics::DistStor batch_stor(&params);
+
+        for (int i = 0; i < num_values; i++)
+            stor.sample(values[i], 1);
+        batch_stor.sampleBatch(values, num_values);
+
+        statistics::DistData data;
+        statistics::DistData batch_data;
+        stor.prepare(&params, data);
+        batch_stor.prepare(&params, batch_data);
+        checkExpectedDistData(batch_data, data, true);
+        ASSERT_EQ(batch_data.underflow, data.underflow);
+        ASSERT_EQ(batch_data.overflow, data.overflow);
+    }
+}
+
+/** Test the bucket of values with a power of two bucket size. */
+TEST(StatsDistStorTest, SamplePowerOf2BucketSize)
+{
+    statistics::DistStor::Params params(3, 66, 16);
+    statistics::DistStor stor(&params);
+
+    // The buckets are [3,19[, [19,35[, [35,51[ and [51,67[.
+    const statistics::Counter values[] = {3, 18.9, 19, 34, 50.5, 51, 66};
+    stor.sampleBatch(values, sizeof(values) / sizeof(values[0]));
+
+    statistics::DistData data;
+    stor.prepare(&params, data);
+    ASSERT_EQ(data.cvec.size(), 4);
+    ASSERT_EQ(data.cvec[0], 2);
+    ASSERT_EQ(data.cvec[1], 2);
+    ASSERT_EQ(data.cvec[2], 1);
+    ASSERT_EQ(data.cvec[3], 2);
+}
+
 #if TRACING_ON
 /** Test that an assertion is thrown when not enough buckets are provided. */
 TEST(StatsHistStorDeathTest, NotEnoughBuckets0)
@@ -970,6 +1047,33 @@ TEST(StatsHistStorTest, Add)
     checkExpectedDistData(merge_data, expected_data, false);
 }
 
+/**
+ * Test that sampling a batch of values, growing the buckets on the way,
+ * gives the same result as sampling them one by one.
+ */
+TEST(StatsHistStorTest, SampleBatch)
+{
+    const statistics::Counter values[] = {1, 2.5, 7, 33, 0, 129, -3, 18,
+        -70.5, 1000, 5, -1};
+    const int num_values = sizeof(values) / sizeof(values[0]);
+
+    for (int num_buckets : {4, 5}) {
+        statistics::HistStor::Params params(num_buckets);
+        statistics::HistStor stor(&params);
+        statistics::HistStor batch_stor(&params);
+
+        for (int i = 0; i < num_values; i++)
+            stor.sample(values[i], 1);
+        batch_stor.sampleBatch(values, num_values);
+
+        statistics::DistData data;
+        statistics::DistData batch_data;
+        stor.prepare(&params, data);
+        batch_stor.prepare(&params, batch_data);
+        checkExpectedDistData(batch_data, data, true);
+    }
+}
+
 /**
  * Test whether zero is correctly set as the reset value. The test order is
  * to check if it is initially zero on creation, then it is made non zero,
@@ -1042,6 +1146,28 @@ TEST(StatsSampleStorTest, SamplePrepare)
     ASSERT_EQ(data.samples, expected_data.samples);
 }
 
+/** Test that sampling a batch of values adds each of them once. */
+TEST(StatsSampleStorTest, SampleBatch)
+{
+    const statistics::Counter values[] = {10, 1234, 0xFFFFFFFF, 7};
+    const int num_values = sizeof(values) / sizeof(values[0]);
+    statistics::SampleStor stor(nullptr);
+    statistics::SampleStor batch_stor(nullptr);
+    statistics::SampleStor::Params params;
+
+    for (int i = 0; i < num_values; i++)
+        stor.sample(values[i], 1);
+    batch_stor.sampleBatch(values, num_values);
+
+    statistics::DistData data;
+    statistics::DistData batch_data;
+    stor.prepare(&params, data);
+    batch_stor.prepare(&params, batch_data);
+    ASSERT_EQ(batch_data.sum, data.sum);
+    ASSERT_EQ(batch_data.squares, data.squares);
+    ASSERT_EQ(batch_data.samples, num_values);
+}
+
 /** The size is always 1, no matter which functions have been called. */
 TEST(StatsSampleStorTest, Size)
 {
@@ -1176,6 +1302,39 @@ TEST(StatsSparseHistStorTest, ZeroReset)
     ASSERT_TRUE(stor.zero());
 }
 
+/**
+ * Test that an average is only considered unmodified while it is zero, as
+ * it otherwise changes with time.
+ */
+TEST(StatsAvgStorTest, Version)
+{
+    statistics::trackVersions();
+    statistics::AvgStor stor(nullptr);
+    const statistics::Version created = statistics::currentVersion();
+
+    statistics::advanceVersion();
+    ASSERT_EQ(stor.version(), created);
+
+    stor.set(1);
+    statistics::advanceVersion();
+    ASSERT_EQ(stor.version(), statistics::currentVersion());
+}
+
+/** Test that sampling a distribution updates its version. */
+TEST(StatsDistStorTest, Version)
+{
+    statistics::trackVersions();
+    statistics::DistStor::Params params(0, 99, 10);
+    statistics::DistStor stor(&params);
+    const statistics::Version created = statistics::currentVersion();
+
+    statistics::advanceVersion();
+    ASSERT_EQ(stor.version(), created);
+
+    stor.sample(10, 1);
+    ASSERT_EQ(stor.version(), created + 1);
+}
+
 /** Test setting and getting value from storage. */
 TEST(StatsSparseHistStorTest, SamplePrepare)
 {
@@ -1214,3 +1373,221 @@ TEST(StatsSparseHistStorTest, SamplePrepare)
     }
     ASSERT_EQ(data.samples, total_samples);
 }
+
+/**
+ * Run a function concurrently on the given number of threads, each of
+ * them updating its own shard, at the current tick of the main thread.
+ */
+template <typename F>
+void
+runOnShards(unsigned num_shards, F f)
+{
+    std::vector<std::thread> threads;
+    for (unsigned shard = 0; shard < num_shards; shard++) {
+        threads.emplace_back([shard, f, tick = curTick()]() mutable {
+            Gem5Internal::_curTickPtr = &tick;
+            statistics::setShard(shard);
+            f(shard);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+}
+
+/** Restores a single shard at the end of the sharded storage tests. */
+class StatsShardedStorTest : public testing::Test
+{
+  protected:
+    void TearDown() override { statistics::setNumShards(1); }
+};
+
+/**
+ * Test that concurrent updates to the shards of a scalar storage are all
+ * accounted for, and that the value is shared by all shards.
+ */
+TEST_F(StatsShardedStorTest, ScalarValueReset)
+{
+    const unsigned num_shards = 4;
+    const int num_incs = 100000;
+
+    statistics::setNumShards(num_shards);
+    statistics::ShardedStor<statistics::StatStor> stor(nullptr);
+
+    ASSERT_TRUE(stor.zero());
+    runOnShards(num_shards, [&stor](unsigned shard) {
+        for (int i = 0; i < num_incs; i++)
+            stor.inc(shard + 1);
+    });
+    ASSERT_FALSE(stor.zero());
+    ASSERT_EQ(stor.value(), num_incs * (1 + 2 + 3 + 4));
+    ASSERT_EQ(stor.result(), statistics::Result(stor.value()));
+
+    // Preparing the storage folds the shards, which does not change the
+    // value
+    stor.prepare(nullptr);
+    ASSERT_EQ(stor.value(), num_incs * (1 + 2 + 3 + 4));
+
+    stor.reset(nullptr);
+    ASSERT_TRUE(stor.zero());
+    ASSERT_EQ(stor.value(), 0);
+}
+
+
+/**
+ * Test that the shards of a distribution storage are merged when it is
+ * prepared.
+ */
+TEST_F(StatsShardedStorTest, DistPrepare)
+{
+    const unsigned num_shards = 3;
+    statistics::DistStor::Params params(0, 99, 5);
+
+    statistics::setNumShards(num_shards);
+    statistics::ShardedStor<statistics::DistStor> stor(&params);
+    statistics::DistStor expected_stor(&params);
+
+    // Every shard samples a different set of values
+    ValueSamples values[] = {{10, 5}, {1234, 2}, {-10, 4}, {17, 17},
+        {52, 63}, {99, 15}};
+    const int num_values = sizeof(values) / sizeof(ValueSamples);
+    for (int i = 0; i < num_values; i++)
+        expected_stor.sample(values[i].value, values[i].numSamples);
+
+    runOnShards(num_shards, [&](unsigned shard) {
+        for (int i = shard; i < num_values; i += num_shards)
+            stor.sample(values[i].value, values[i].numSamples);
+    });
+    ASSERT_FALSE(stor.zero());
+
+    statistics::DistData data;
+    statistics::DistData expected_data;
+    stor.prepare(&params, data);
+    expected_stor.prepare(&params, expected_data);
+    checkExpectedDistData(data, expected_data, true);
+    ASSERT_EQ(data.underflow, expected_data.underflow);
+    ASSERT_EQ(data.overflow, expected_data.overflow);
+
+    stor.reset(&params);
+    ASSERT_TRUE(stor.zero());
+}
+
+/**
+ * Test that a value set by a thread other than the main one is the value
+ * of the stat, and that it is not accumulated across dumps.
+ */
+TEST_F(StatsShardedStorTest, SetAcrossDumps)
+{
+    statistics::setNumShards(2);
+    statistics::ShardedStor<statistics::StatStor> stor(nullptr);
+
+    for (int dump = 0; dump < 2; dump++) {
+        runOnShards(2, [&stor](unsigned shard) {
+            if (shard == 1)
+                stor.set(5);
+        });
+        ASSERT_EQ(stor.value(), 5);
+        stor.prepare(nullptr);
+        ASSERT_EQ(stor.value(), 5);
+    }
+
+    // Updates of the following interval add up to the value set
+    runOnShards(2, [&stor](unsigned shard) { stor.inc(shard + 1); });
+    stor.prepare(nullptr);
+    ASSERT_EQ(stor.value(), 8);
+}
+
+/**
+ * Test that the last value set wins over the values set and the updates
+ * of the other threads.
+ */
+TEST_F(StatsShardedStorTest, SetLastWins)
+{
+    const unsigned num_shards = 3;
+
+    statistics::setNumShards(num_shards);
+    statistics::ShardedStor<statistics::StatStor> stor(nullptr);
+
+    stor.inc(10);
+    runOnShards(num_shards, [&stor](unsigned shard) {
+        if (shard == 1)
+            stor.set(3);
+        else if (shard == 2)
+            stor.inc(4);
+    });
+    increaseTick();
+    runOnShards(num_shards, [&stor](unsigned shard) {
+        if (shard == 2)
+            stor.set(7);
+    });
+    ASSERT_EQ(stor.value(), 7);
+
+    stor.prepare(nullptr);
+    ASSERT_EQ(stor.value(), 7);
+
+    // The main thread setting the stat wins too
+    runOnShards(num_shards, [&stor](unsigned shard) {
+        if (shard == 1)
+            stor.set(3);
+    });
+    increaseTick();
+    stor.set(1);
+    ASSERT_EQ(stor.value(), 1);
+    stor.prepare(nullptr);
+    ASSERT_EQ(stor.value(), 1);
+}
+
+/**
+ * Test that the value set at the latest tick wins, whichever thread set
+ * its value last.
+ */
+TEST_F(StatsShardedStorTest, SetLatestTickWins)
+{
+    statistics::setNumShards(2);
+    statistics::ShardedStor<statistics::StatStor> stor(nullptr);
+
+    const Tick tick = curTick();
+    runOnShards(2, [&stor, tick](unsigned shard) {
+        if (shard == 1) {
+            tickHandler.setCurTick(tick + 10);
+            stor.set(3);
+        }
+    });
+    tickHandler.setCurTick(tick + 5);
+    stor.set(1);
+    ASSERT_EQ(stor.value(), 3);
+    stor.prepare(nullptr);
+    ASSERT_EQ(stor.value(), 3);
+}
+
+/**
+ * Test that a storage keeps the shards it was created with when the
+ * number of shards changes afterwards.
+ */
+TEST_F(StatsShardedStorTest, NumShardsChanged)
+{
+    statistics::setNumShards(2);
+    auto stor =
+        std::make_unique<statistics::ShardedStor<statistics::StatStor>>(
+            nullptr);
+
+    statistics::setNumShards(4);
+    runOnShards(2, [&stor](unsigned shard) { stor->inc(shard + 1); });
+    ASSERT_EQ(stor->value(), 3);
+
+    // The storage is freed with the number of shards it was allocated
+    // with
+    stor.reset();
+}
+
+/** Test that storages created with a single shard are not sharded. */
+TEST_F(StatsShardedStorTest, SingleShard)
+{
+    statistics::ShardedStor<statistics::StatStor> stor(nullptr);
+
+    runOnShards(2, [&stor](unsigned shard) {
+        if (shard == 1)
+            stor.inc(3);
+    });
+    stor.inc(2);
+    ASSERT_EQ(stor.value(), 5);
+}
@@ -55,6 +55,7 @@
 #include "base/cast.hh"
 #include "base/logging.hh"
 #include "base/stats/info.hh"
+#include "base/stats/storage.hh"
 #include "base/str.hh"
 
 namespace gem5
@@ -74,7 +75,8 @@ namespace statistics
 std::list<Info *> &statsList();
 
 Text::Text()
-    : mystream(false), stream(NULL), descriptions(false), spaces(false)
+    : mystream(false), stream(NULL), descriptions(false), spaces(false),
+      changedOnly(false), lastDump(0)
 {
 }
 
@@ -127,6 +129,12 @@ Text::valid() const
     return stream != NULL && stream->good();
 }
 
+Version
+Text::changedSince() const
+{
+    return changedOnly ? lastDump : 0;
+}
+
 void
 Text::begin()
 {
@@ -138,6 +146,7 @@ Text::end()
 {
     ccprintf(*stream, "\n---------- End Simulation Statistics   ----------\n");
     stream->flush();
+    lastDump = currentVersion();
 }
 
 std::string
@@ -802,7 +811,8 @@ Text::visit(const SparseHistInfo &info)
 }
 
 Output *
-initText(const std::string &filename, bool desc, bool spaces)
+initText(const std::string &filename, bool desc, bool spaces,
+         bool changed_only)
 {
     static Text text;
     static bool connected = false;
@@ -812,6 +822,9 @@ initText(const std::string &filename, bool desc, bool spaces)
         text.descriptions = desc;
         text.enableUnits = desc; // the units are printed if descs are
         text.spaces = spaces;
+        text.changedOnly = changed_only;
+        if (changed_only)
+            trackVersions();
         connected = true;
     }
 
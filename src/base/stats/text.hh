@@ -73,6 +73,12 @@ class Text : public Output
     bool enableUnits;
     bool descriptions;
     bool spaces;
+    /** Only output the stats that changed since the last dump */
+    bool changedOnly;
+
+  protected:
+    /** Version of the stats at the last dump */
+    Version lastDump;
 
   public:
     Text();
@@ -99,13 +105,15 @@ class Text : public Output
 
     // Implement Output
     bool valid() const override;
+    Version changedSince() const override;
     void begin() override;
     void end() override;
 };
 
 std::string ValueToString(Result value, int precision);
 
-Output *initText(const std::string &filename, bool desc, bool spaces);
+Output *initText(const std::string &filename, bool desc, bool spaces,
+                 bool changed_only = false);
 
 } // namespace statistics
 } // namespace gem5
@@ -60,6 +60,13 @@ typedef std::vector<Result> VResult;
 typedef unsigned int size_type;
 typedef unsigned int off_type;
 
+/**
+ * Version of the stats. The version is advanced after every stats dump
+ * and stat storage records the version it was last modified in, so that
+ * outputs can tell which stats changed since they were last dumped.
+ */
+typedef uint64_t Version;
+
 enum DistType { Deviation, Dist, Hist };
 
 /** General container for distribution data. */
@@ -37,6 +37,7 @@
 #include <sstream>
 
 #include "base/atomicio.hh"
+#include "base/binary_trace.hh"
 #include "base/logging.hh"
 #include "base/output.hh"
 #include "base/str.hh"
@@ -105,6 +106,30 @@ disable()
 ObjectMatch ignore;
 
 
+void
+Logger::record(Tick when, const std::string &name, const std::string &flag,
+               const char *fmt, std::initializer_list<RecordedArg> args)
+{
+    binary->record(when, name, flag, fmt, args);
+}
+
+void
+Logger::filterLike(const Logger &other)
+{
+    ignore = other.ignore;
+    samplePeriod = other.samplePeriod;
+    sampleWindow = other.sampleWindow;
+}
+
+void
+Logger::sample(Tick period, Tick window)
+{
+    fatal_if(period && (!window || window > period),
+             "The sampling window must be within the sampling period.\n");
+    samplePeriod = period;
+    sampleWindow = window;
+}
+
 void
 Logger::dump(Tick when, const std::string &name,
          const void *d, int len, const std::string &flag)
@@ -170,5 +195,100 @@ OstreamLogger::logMessage(Tick when, const std::string &name,
     }
 }
 
+RingLogger::RingLogger(Logger *target_, size_t size_)
+    : target(target_), ring(size_), next(0), size(0), recording(true)
+{
+    panic_if(!target, "A ring logger needs a logger to output to.\n");
+    panic_if(ring.empty(), "A ring logger needs room for a message.\n");
+    filterLike(*target);
+}
+
+void
+RingLogger::logMessage(Tick when, const std::string &name,
+        const std::string &flag, const std::string &message)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    if (!recording) {
+        target->logMessage(when, name, flag, message);
+        return;
+    }
+
+    // Reuse the oldest message, and its string buffers
+    Message &msg = ring[next];
+    msg.when = when;
+    msg.name = name;
+    msg.flag = flag;
+    msg.message = message;
+
+    next = (next + 1) % ring.size();
+    if (size < ring.size())
+        size++;
+}
+
+void
+RingLogger::record()
+{
+    recording = true;
+    next = 0;
+    size = 0;
+}
+
+void
+RingLogger::release()
+{
+    if (!recording)
+        return;
+
+    size_t idx = (next + ring.size() - size) % ring.size();
+    for (; size > 0; --size) {
+        const Message &msg = ring[idx];
+        target->logMessage(msg.when, msg.name, msg.flag, msg.message);
+        idx = (idx + 1) % ring.size();
+    }
+    next = 0;
+    recording = false;
+}
+
+BinaryLogger::BinaryLogger(const std::string &filename)
+    : trace(new BinaryTrace(filename)), lineBuf(*trace), stream(&lineBuf)
+{
+    binary = trace.get();
+}
+
+BinaryLogger::~BinaryLogger()
+{
+    stream.flush();
+}
+
+void
+BinaryLogger::logMessage(Tick when, const std::string &name,
+        const std::string &flag, const std::string &message)
+{
+    if (!name.empty() && ignore.match(name))
+        return;
+
+    trace->record(when, name, flag, "%s", message);
+}
+
+void
+BinaryLogger::flush()
+{
+    stream.flush();
+    trace->flush();
+}
+
+int
+BinaryLogger::LineBuf::sync()
+{
+    const std::string line = str();
+    if (!line.empty()) {
+        trace.record(MaxTick, "", "", "%s", line);
+        str("");
+    }
+    return 0;
+}
+
 } // namespace Trace
 } // namespace gem5
@@ -32,9 +32,14 @@
 #ifndef __BASE_TRACE_HH__
 #define __BASE_TRACE_HH__
 
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <sstream>
+#include <type_traits>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/cprintf.hh"
@@ -53,6 +58,149 @@ namespace gem5
 
 namespace Trace {
 
+class BinaryTrace;
+
+/**
+ * An argument of a debug message recorded to a binary trace, with its
+ * type so that it is formatted the same way when the trace is decoded.
+ * Strings and other objects are referred to rather than copied, so it
+ * must not outlive the argument.
+ */
+struct RecordedArg
+{
+    enum Type : uint8_t
+    {
+        CharArg = 0,
+        SignedCharArg,
+        UnsignedCharArg,
+        BoolArg,
+        Int16Arg,
+        Int32Arg,
+        Int64Arg,
+        Uint16Arg,
+        Uint32Arg,
+        Uint64Arg,
+        FloatArg,
+        DoubleArg,
+        StringArg,
+        PointerArg,
+        /**
+         * Any other type, recorded as the text it is formatted to with
+         * its conversion specification
+         */
+        ObjectArg,
+    };
+
+    Type type;
+    union
+    {
+        int64_t i;
+        uint64_t u;
+        float f;
+        double d;
+        const void *ptr;
+    };
+    /** Size of a string argument */
+    size_t size = 0;
+    /** Formats an object argument with a conversion specification */
+    void (*format)(std::ostream &os, const char *spec,
+                   const void *obj) = nullptr;
+
+  private:
+    /**
+     * Overloads picking the integral type a class converts to, as its
+     * stream operator would, e.g., for Cycles or BitUnions. They are only
+     * used in unevaluated contexts.
+     */
+    static char integralOf(char);
+    static signed char integralOf(signed char);
+    static unsigned char integralOf(unsigned char);
+    static short integralOf(short);
+    static unsigned short integralOf(unsigned short);
+    static int integralOf(int);
+    static unsigned integralOf(unsigned);
+    static long integralOf(long);
+    static unsigned long integralOf(unsigned long);
+    static long long integralOf(long long);
+    static unsigned long long integralOf(unsigned long long);
+
+    template <typename T>
+    using IntegralOf = decltype(integralOf(std::declval<const T &>()));
+
+    template <typename T, typename = void>
+    struct ConvertsToIntegral : std::false_type {};
+
+    template <typename T>
+    struct ConvertsToIntegral<T, std::void_t<IntegralOf<T>>> :
+        std::is_class<T> {};
+
+  public:
+    template <typename T>
+    RecordedArg(const T &arg)
+    {
+        typedef std::decay_t<T> D;
+        if constexpr (std::is_same_v<D, char>) {
+            type = CharArg;
+            u = static_cast<uint8_t>(arg);
+        } else if constexpr (std::is_same_v<D, signed char>) {
+            type = SignedCharArg;
+            u = static_cast<uint8_t>(arg);
+        } else if constexpr (std::is_same_v<D, unsigned char>) {
+            type = UnsignedCharArg;
+            u = arg;
+        } else if constexpr (std::is_same_v<D, bool>) {
+            type = BoolArg;
+            u = arg;
+        } else if constexpr (std::is_integral_v<D> && std::is_signed_v<D>) {
+            static_assert(sizeof(D) <= 8);
+            type = sizeof(D) == 2 ? Int16Arg :
+                   sizeof(D) == 4 ? Int32Arg : Int64Arg;
+            i = arg;
+        } else if constexpr (std::is_integral_v<D>) {
+            static_assert(sizeof(D) <= 8);
+            type = sizeof(D) == 2 ? Uint16Arg :
+                   sizeof(D) == 4 ? Uint32Arg : Uint64Arg;
+            u = arg;
+        } else if constexpr (std::is_same_v<D, float>) {
+            type = FloatArg;
+            f = arg;
+        } else if constexpr (std::is_same_v<D, double>) {
+            type = DoubleArg;
+            d = arg;
+        } else if constexpr (std::is_same_v<D, const char *> ||
+                             std::is_same_v<D, char *>) {
+            // Arrays decay here, so that only actual pointers are checked
+            const char *str = arg;
+            if (!str)
+                str = "";
+            type = StringArg;
+            ptr = str;
+            size = std::char_traits<char>::length(str);
+        } else if constexpr (std::is_same_v<D, std::string>) {
+            type = StringArg;
+            ptr = arg.data();
+            size = arg.size();
+        } else if constexpr (std::is_pointer_v<D>) {
+            type = PointerArg;
+            ptr = reinterpret_cast<const void *>(arg);
+        } else if constexpr (std::is_enum_v<D> &&
+                             std::is_convertible_v<D, int>) {
+            *this = RecordedArg(static_cast<std::underlying_type_t<D>>(arg));
+        } else if constexpr (ConvertsToIntegral<D>::value) {
+            // Recorded as the integer they print as, so that the decoder
+            // applies their flags, width and precision
+            *this = RecordedArg(static_cast<IntegralOf<D>>(arg));
+        } else {
+            // Anything else is formatted when recorded
+            type = ObjectArg;
+            ptr = &arg;
+            format = [](std::ostream &os, const char *spec, const void *obj) {
+                ccprintf(os, spec, *static_cast<const T *>(obj));
+            };
+        }
+    }
+};
+
 /** Debug logging base class.  Handles formatting and outputting
  *  time/name/message messages */
 class Logger
@@ -61,6 +209,26 @@ class Logger
     /** Name match for objects to ignore */
     ObjectMatch ignore;
 
+    /**
+     * Binary trace messages are recorded to instead of being formatted,
+     * if any.
+     */
+    BinaryTrace *binary = nullptr;
+
+    /**
+     * When sampling, messages are only logged during the first
+     * sampleWindow ticks of every samplePeriod ticks.
+     */
+    Tick samplePeriod = 0;
+    Tick sampleWindow = 0;
+
+    /** Record a message to the binary trace */
+    void record(Tick when, const std::string &name, const std::string &flag,
+                const char *fmt, std::initializer_list<RecordedArg> args);
+
+    /** Ignore the same objects and sample like another logger */
+    void filterLike(const Logger &other);
+
   public:
     /** Log a single message */
     template <typename ...Args>
@@ -76,8 +244,16 @@ class Logger
             const std::string &flag,
             const char *fmt, const Args &...args)
     {
+        if (samplePeriod && when != MaxTick &&
+            when % samplePeriod >= sampleWindow) {
+            return;
+        }
         if (!name.empty() && ignore.match(name))
             return;
+        if (binary) {
+            record(when, name, flag, fmt, { RecordedArg(args)... });
+            return;
+        }
         std::ostringstream line;
         ccprintf(line, fmt, args...);
         logMessage(when, name, flag, line.str());
@@ -104,6 +280,13 @@ class Logger
     /** Add objects to ignore */
     void addIgnore(const ObjectMatch &ignore_) { ignore.add(ignore_); }
 
+    /**
+     * Only log the messages of the first window ticks of every period
+     * ticks. Messages without a tick, e.g., from DPRINTFR, are always
+     * logged.
+     */
+    void sample(Tick period, Tick window);
+
     virtual ~Logger() { }
 };
 
@@ -124,6 +307,93 @@ class OstreamLogger : public Logger
     std::ostream &getOstream() override { return stream; }
 };
 
+/**
+ * Logger recording messages to a binary trace, which is formatted
+ * offline by decodeBinaryTrace(). Messages written to its ostream are
+ * recorded one line at a time, as if logged with DPRINTFR.
+ */
+class BinaryLogger : public Logger
+{
+  protected:
+    /** Records the lines written to the ostream */
+    class LineBuf : public std::stringbuf
+    {
+      protected:
+        BinaryTrace &trace;
+
+        int sync() override;
+
+      public:
+        LineBuf(BinaryTrace &trace_) : trace(trace_) {}
+    };
+
+    std::unique_ptr<BinaryTrace> trace;
+    LineBuf lineBuf;
+    std::ostream stream;
+
+  public:
+    BinaryLogger(const std::string &filename);
+    ~BinaryLogger();
+
+    void logMessage(Tick when, const std::string &name,
+            const std::string &flag, const std::string &message) override;
+
+    std::ostream &getOstream() override { return stream; }
+
+    /** Write all the messages recorded so far to the file */
+    void flush();
+};
+
+/**
+ * Flight recorder logger. While recording, it keeps the last messages
+ * logged to it in a ring buffer instead of outputting them, so that the
+ * messages leading to an event of interest can be output once it
+ * happens. When released, the recorded messages are passed to the
+ * target logger, as well as all the messages logged afterwards. The
+ * ignored objects and sampling of the target apply to it as well.
+ */
+class RingLogger : public Logger
+{
+  protected:
+    struct Message
+    {
+        Tick when;
+        std::string name;
+        std::string flag;
+        std::string message;
+    };
+
+    /** Logger messages are eventually output to */
+    Logger *target;
+
+    /** Recorded messages, the oldest one at next once full */
+    std::vector<Message> ring;
+    size_t next;
+    size_t size;
+
+    bool recording;
+
+  public:
+    /**
+     * @param target_ Logger to output to
+     * @param size_ Number of messages to keep while recording
+     */
+    RingLogger(Logger *target_, size_t size_);
+
+    void logMessage(Tick when, const std::string &name,
+            const std::string &flag, const std::string &message) override;
+
+    std::ostream &getOstream() override { return target->getOstream(); }
+
+    /** Start recording, dropping the messages recorded so far */
+    void record();
+
+    /** Output the recorded messages and stop recording */
+    void release();
+
+    bool isRecording() const { return recording; }
+};
+
 /** Get the current global debug logger.  This takes ownership of the given
  *  logger which should be allocated using 'new' */
 Logger *getDebugLogger();
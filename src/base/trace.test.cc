@@ -395,6 +395,26 @@ TEST(TraceTest, DprintfFlagEnabled)
     Trace::disable();
 }
 
+/** Test that only the messages in the sampling windows are logged. */
+TEST(TraceTest, DprintfFlagSample)
+{
+    std::stringstream ss;
+    Trace::OstreamLogger logger(ss);
+
+    logger.sample(100, 10);
+    for (Tick when : { 0, 9, 10, 99, 100, 105, 110, 250 })
+        logger.dprintf_flag(when, "Foo", "", "%d\n", when);
+    logger.dprintf_flag(MaxTick, "", "", "raw\n");
+    ASSERT_EQ(getString(&logger),
+        "      0: Foo: 0\n      9: Foo: 9\n    100: Foo: 100\n"
+        "    105: Foo: 105\nraw\n");
+
+    // Sampling can be turned off again
+    logger.sample(0, 0);
+    logger.dprintf_flag(50, "Foo", "", "%d\n", 50);
+    ASSERT_EQ(getString(&logger), "     50: Foo: 50\n");
+}
+
 /** Test dprintf with ignored name. */
 TEST(TraceTest, DprintfIgnore)
 {
@@ -608,3 +628,96 @@ TEST(TraceTest, GlobalName)
     DPRINTF(TraceTestDebugFlag, "Test message");
     ASSERT_EQ(getString(Trace::output()), "");
 }
+
+/** Test that a ring logger only outputs messages once released. */
+TEST(TraceTest, RingLoggerRelease)
+{
+    std::stringstream ss;
+    Trace::OstreamLogger target(ss);
+    Trace::RingLogger logger(&target, 4);
+
+    ASSERT_TRUE(logger.isRecording());
+    logger.logMessage(1, "Foo", "", "Message 1\n");
+    logger.logMessage(MaxTick, "", "", "Message 2\n");
+    ASSERT_EQ(getString(ss), "");
+
+    logger.release();
+    ASSERT_FALSE(logger.isRecording());
+    ASSERT_EQ(getString(ss), "      1: Foo: Message 1\nMessage 2\n");
+
+    // Messages are passed through once released
+    logger.logMessage(3, "Bar", "", "Message 3\n");
+    ASSERT_EQ(getString(ss), "      3: Bar: Message 3\n");
+}
+
+/** Test that a ring logger only keeps the last messages. */
+TEST(TraceTest, RingLoggerOverflow)
+{
+    std::stringstream ss;
+    Trace::OstreamLogger target(ss);
+    Trace::RingLogger logger(&target, 3);
+
+    for (int i = 0; i < 10; i++)
+        logger.dprintf(i, "Foo", "Message %d\n", i);
+    logger.release();
+    ASSERT_EQ(getString(ss),
+        "      7: Foo: Message 7\n"
+        "      8: Foo: Message 8\n"
+        "      9: Foo: Message 9\n");
+}
+
+/** Test that recording again drops the messages output so far. */
+TEST(TraceTest, RingLoggerRecordAgain)
+{
+    std::stringstream ss;
+    Trace::OstreamLogger target(ss);
+    Trace::RingLogger logger(&target, 3);
+
+    logger.logMessage(1, "Foo", "", "Message 1\n");
+    logger.release();
+    logger.logMessage(2, "Foo", "", "Message 2\n");
+    ASSERT_EQ(getString(ss),
+        "      1: Foo: Message 1\n      2: Foo: Message 2\n");
+
+    logger.record();
+    ASSERT_TRUE(logger.isRecording());
+    logger.logMessage(3, "Foo", "", "Message 3\n");
+    logger.release();
+    logger.release();
+    ASSERT_EQ(getString(ss), "      3: Foo: Message 3\n");
+}
+
+/** Test that a ring logger ignores the objects it is told to. */
+TEST(TraceTest, RingLoggerIgnore)
+{
+    std::stringstream ss;
+    Trace::OstreamLogger target(ss);
+    Trace::RingLogger logger(&target, 3);
+
+    logger.addIgnore(ObjectMatch("Foo"));
+    logger.logMessage(1, "Foo", "", "Ignored\n");
+    logger.logMessage(2, "Bar", "", "Kept\n");
+    logger.release();
+    ASSERT_EQ(getString(ss), "      2: Bar: Kept\n");
+}
+
+/** Test that a ring logger ignores and samples like its target. */
+TEST(TraceTest, RingLoggerFiltersLikeTarget)
+{
+    std::stringstream ss;
+    Trace::OstreamLogger target(ss);
+    target.addIgnore(ObjectMatch("Foo"));
+    target.sample(10, 2);
+    Trace::RingLogger logger(&target, 8);
+
+    logger.dprintf(1, "Foo", "Ignored\n");
+    for (Tick when = 0; when < 30; when += 5)
+        logger.dprintf(when, "Bar", "Message %d\n", when);
+    logger.dprintf(MaxTick, "Bar", "Not sampled\n");
+    logger.release();
+    ASSERT_EQ(getString(ss),
+        "      0: Bar: Message 0\n"
+        "     10: Bar: Message 10\n"
+        "     20: Bar: Message 20\n"
+        "Bar: Not sampled\n");
+}
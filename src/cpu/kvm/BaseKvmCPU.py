@@ -64,9 +64,18 @@ class BaseKvmCPU(BaseCPU):
         return True
 
     useCoalescedMMIO = Param.Bool(False, "Use coalesced MMIO (EXPERIMENTAL)")
+    fastMMIO = VectorParam.AddrRange([],
+        "MMIO ranges (e.g., timers and interrupt controllers) whose "
+        "accesses are completed without waiting for the device latency")
     usePerfOverflow = Param.Bool(False, "Use perf event overflow counters (EXPERIMENTAL)")
     alwaysSyncTC = Param.Bool(False,
                               "Always sync thread contexts on entry/exit")
+    warmupLimit = Param.MemorySize("0",
+        "Maximum amount of memory this CPU reads into the caches when "
+        "switching out after a KvmVM warmup window (0 for no limit)")
+    instStopMargin = Param.UInt64(0,
+        "Stop this many instructions ahead of an instruction event and "
+        "single-step to it (0 to rely on perf counter overflows only)")
 
     hostFreq = Param.Clock("2GHz", "Host clock frequency")
     hostFactor = Param.Float(1.0, "Cycle scale factor")
@@ -36,7 +36,7 @@
 from m5.params import *
 from m5.proxy import *
 
-from m5.SimObject import SimObject
+from m5.SimObject import SimObject, cxxMethod
 
 class KvmVM(SimObject):
     type = 'KvmVM'
@@ -47,3 +47,10 @@ class KvmVM(SimObject):
       VectorParam.AddrRange([], "memory ranges for coalesced MMIO")
 
     system = Param.System(Parent.any, "system this VM belongs to")
+
+    @cxxMethod
+    def beginWarmupWindow(self):
+        """Start recording the pages written by the guest. The pages
+        written until the KVM CPUs are switched out are used to warm
+        the caches of the system."""
+        pass
@@ -42,11 +42,14 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <csignal>
+#include <cstring>
 #include <ostream>
 
 #include "base/compiler.hh"
+#include "base/intmath.hh"
 #include "debug/Checkpoint.hh"
 #include "debug/Drain.hh"
 #include "debug/Kvm.hh"
@@ -76,9 +79,13 @@ BaseKvmCPU::BaseKvmCPU(const BaseKvmCPUParams &params)
       pageSize(sysconf(_SC_PAGE_SIZE)),
       tickEvent([this]{ tick(); }, "BaseKvmCPU tick",
                 false, Event::CPU_Tick_Pri),
+      instStopMargin(params.instStopMargin),
+      singleStepping(false),
       activeInstPeriod(0),
       perfControlledByTimer(params.usePerfOverflow),
-      hostFactor(params.hostFactor), stats(this),
+      hostFactor(params.hostFactor), warmupLimit(params.warmupLimit),
+      fastMMIO(params.fastMMIO.begin(), params.fastMMIO.end()),
+      stats(this),
       ctrInsts(0)
 {
     if (pageSize == -1)
@@ -156,6 +163,12 @@ BaseKvmCPU::startup()
         inform("KVM: Coalesced not supported by host OS\n");
     }
 
+    if (instStopMargin && !kvm.capGuestDebug()) {
+        warn("KVM: Single-stepping not supported by host OS, "
+             "instruction stops will not be exact.\n");
+        instStopMargin = 0;
+    }
+
     schedule(new EventFunctionWrapper([this]{
                 restartEqThread();
             }, name(), true), curTick());
@@ -273,13 +286,25 @@ BaseKvmCPU::StatGroup::StatGroup(statistics::Group *parent)
              "number of VM exits due to memory mapped IO"),
     ADD_STAT(numCoalescedMMIO, statistics::units::Count::get(),
              "number of coalesced memory mapped IO requests"),
+    ADD_STAT(numFastMMIO, statistics::units::Count::get(),
+             "number of memory mapped IO requests completed without "
+             "leaving tick()"),
     ADD_STAT(numIO, statistics::units::Count::get(),
              "number of VM exits due to legacy IO"),
     ADD_STAT(numHalt, statistics::units::Count::get(),
              "number of VM exits due to wait for interrupt instructions"),
     ADD_STAT(numInterrupts, statistics::units::Count::get(),
              "number of interrupts delivered"),
-    ADD_STAT(numHypercalls, statistics::units::Count::get(), "number of hypercalls")
+    ADD_STAT(numHypercalls, statistics::units::Count::get(), "number of hypercalls"),
+    ADD_STAT(numWarmupLines, statistics::units::Count::get(),
+             "number of cache lines read to warm caches on switch out"),
+    ADD_STAT(numInstStops, statistics::units::Count::get(),
+             "number of stops for instruction events"),
+    ADD_STAT(numInstStopSteps, statistics::units::Count::get(),
+             "number of single-step KVM entries to reach instruction events"),
+    ADD_STAT(instStopOvershoot, statistics::units::Count::get(),
+             "instructions executed past instruction events before "
+             "they were serviced")
 {
 }
 
@@ -443,6 +468,53 @@ BaseKvmCPU::switchOut()
     // idle.
     assert(!tickEvent.scheduled());
     assert(_status == Idle);
+
+    warmupCaches();
+}
+
+void
+BaseKvmCPU::warmupCaches()
+{
+    const std::vector<Addr> &pages(vm->warmupPages());
+    if (pages.empty())
+        return;
+
+    const unsigned line_size(cacheLineSize());
+    const uint64_t max_lines(warmupLimit ? divCeil(warmupLimit, line_size)
+                                         : 0);
+    uint64_t lines(0);
+    std::vector<uint8_t> data(line_size);
+
+    // The dirty log doesn't tell which vCPU wrote a page, so the CPUs
+    // of the VM split the pages instead of each of them reading all of
+    // them through its own port.
+    const size_t stride(vm->numVCPUs());
+    DPRINTF(Kvm, "Warming caches with every %ith of %i pages\n",
+            stride, pages.size());
+
+    // The KVM CPU normally runs with caches bypassed. Temporarily
+    // switch to the atomic mode to make the caches allocate the lines
+    // we read. The system is drained, so this is safe.
+    const enums::MemoryMode mode(system->getMemoryMode());
+    system->setMemoryMode(enums::atomic);
+
+    for (size_t i = vcpuID;
+         i < pages.size() && (!max_lines || lines < max_lines);
+         i += stride) {
+        const Addr page(pages[i]);
+        for (Addr addr = page; addr < page + pageSize &&
+                 (!max_lines || lines < max_lines); addr += line_size) {
+            RequestPtr req = std::make_shared<Request>(
+                addr, line_size, 0, dataRequestorId());
+            Packet pkt(req, MemCmd::ReadReq);
+            pkt.dataStatic(data.data());
+            dataPort.sendAtomic(&pkt);
+            ++lines;
+        }
+    }
+
+    system->setMemoryMode(mode);
+    stats.numWarmupLines += lines;
 }
 
 void
@@ -590,9 +662,19 @@ BaseKvmCPU::tick()
         // handleKvmExit() will determine the next state of the CPU
         delay = handleKvmExit();
 
-        if (tryDrain())
+        if (tryDrain()) {
             _status = Idle;
-        break;
+            break;
+        }
+
+        // Accesses to fast MMIO devices are completed right away
+        // instead of waiting for the device latency in the event
+        // loop, similar to devices emulated by the kernel.
+        if (!isFastMMIOExit())
+            break;
+
+        ++stats.numFastMMIO;
+        [[fallthrough]];
 
       case RunningServiceCompletion:
       case Running: {
@@ -643,17 +725,27 @@ BaseKvmCPU::tick()
               syncThreadContext();
 
           // Enter into the RunningService state unless the
-          // simulation was stopped by a timer.
-          if (_kvmRun->exit_reason !=  KVM_EXIT_INTR) {
-              _status = RunningService;
-          } else {
+          // simulation was stopped by a timer or a single-step.
+          if (_kvmRun->exit_reason == KVM_EXIT_INTR) {
               ++stats.numExitSignal;
               _status = Running;
+          } else if (_kvmRun->exit_reason == KVM_EXIT_DEBUG &&
+                     singleStepping) {
+              // Make sure that we don't get rescheduled on the same
+              // tick if the step didn't take any measurable time.
+              delay = std::max(delay, clockPeriod());
+              _status = Running;
+          } else {
+              _status = RunningService;
           }
 
           // Service any pending instruction events. The vCPU should
           // have exited in time for the event using the instruction
           // counter configured by setupInstStop().
+          if (!queue.empty() && queue.nextTick() <= ctrInsts) {
+              ++stats.numInstStops;
+              stats.instStopOvershoot += ctrInsts - queue.nextTick();
+          }
           queue.serviceEvents(ctrInsts);
 
           if (tryDrain())
@@ -1033,6 +1125,23 @@ BaseKvmCPU::handleKvmExit()
     }
 }
 
+bool
+BaseKvmCPU::isFastMMIOExit() const
+{
+    if (_status != RunningServiceCompletion ||
+        _kvmRun->exit_reason != KVM_EXIT_MMIO) {
+        return false;
+    }
+
+    const Addr addr(_kvmRun->mmio.phys_addr);
+    for (const auto &range : fastMMIO) {
+        if (range.contains(addr))
+            return true;
+    }
+
+    return false;
+}
+
 Tick
 BaseKvmCPU::handleKvmExitIO()
 {
@@ -1335,13 +1444,48 @@ BaseKvmCPU::setupInstStop()
 {
     if (thread->comInstEventQueue.empty()) {
         setupInstCounter(0);
+        setSingleStep(false);
+        return;
+    }
+
+    Tick next = thread->comInstEventQueue.nextTick();
+    assert(next > ctrInsts);
+    const uint64_t remaining(next - ctrInsts);
+
+    if (remaining > instStopMargin) {
+        // Request a signal early enough for the skid of the overflow
+        // interrupt to stay within the margin.
+        setupInstCounter(remaining - instStopMargin);
+        setSingleStep(false);
     } else {
-        Tick next = thread->comInstEventQueue.nextTick();
-        assert(next > ctrInsts);
-        setupInstCounter(next - ctrInsts);
+        // We are close to the event, step the last few instructions
+        // instead of trying to hit it with the counter.
+        DPRINTF(KvmRun, "KVM: Single-stepping, %i instructions to go\n",
+                remaining);
+        ++stats.numInstStopSteps;
+        setupInstCounter(0);
+        setSingleStep(true);
     }
 }
 
+void
+BaseKvmCPU::setSingleStep(bool enable)
+{
+    if (enable == singleStepping)
+        return;
+
+    struct kvm_guest_debug dbg;
+    std::memset(&dbg, 0, sizeof(dbg));
+    if (enable)
+        dbg.control = KVM_GUESTDBG_ENABLE | KVM_GUESTDBG_SINGLESTEP;
+
+    if (ioctl(KVM_SET_GUEST_DEBUG, &dbg) == -1)
+        panic("KVM: Failed to %s single-stepping (errno: %i)\n",
+              enable ? "enable" : "disable", errno);
+
+    singleStepping = enable;
+}
+
 void
 BaseKvmCPU::setupInstCounter(uint64_t period)
 {
@@ -522,6 +522,13 @@ class BaseKvmCPU : public BaseCPU
     virtual Tick handleKvmExitFailEntry();
     /** @} */
 
+    /**
+     * Was the last exit an MMIO access to one of the fast MMIO ranges
+     * that has been completed and can be followed by an immediate
+     * re-entry into KVM?
+     */
+    bool isFastMMIOExit() const;
+
     /**
      * Is the architecture specific code in a state that prevents
      * draining?
@@ -592,6 +599,20 @@ class BaseKvmCPU : public BaseCPU
     /** Execute the KVM_RUN ioctl */
     virtual void ioctlRun();
 
+    /**
+     * Warm the caches below this CPU with its share of the pages
+     * written during the VM's last warmup window. Each page is read by
+     * a single CPU of the VM, which is picked by its vCPU ID.
+     *
+     * The lines are read using atomic accesses with the memory system
+     * temporarily switched into the atomic mode, which lets classic
+     * caches allocate them. Ruby doesn't support atomic accesses to
+     * caches, so this must not be used with Ruby.
+     *
+     * @see KvmVM::beginWarmupWindow()
+     */
+    void warmupCaches();
+
     /**
      * KVM memory port.  Uses default RequestPort behavior and provides an
      * interface for KVM to transparently submit atomic or timing requests.
@@ -729,13 +750,36 @@ class BaseKvmCPU : public BaseCPU
      *
      * Check if there are pending instruction breaks in the CPU's
      * instruction event queue and schedule an instruction break using
-     * PerfEvent.
+     * PerfEvent. If an instruction stop margin has been configured,
+     * the counter overflow is requested instStopMargin instructions
+     * early to absorb the skid of the overflow signal and the vCPU is
+     * single-stepped for the rest of the way.
      *
      * @note This method doesn't currently handle the main system
      * instruction event queue.
      */
     void setupInstStop();
 
+    /**
+     * Enable or disable single-stepping of the vCPU.
+     *
+     * When enabled, every entry into KVM executes at most one guest
+     * instruction before exiting with KVM_EXIT_DEBUG.
+     *
+     * @note The presence of this call depends on Kvm::capGuestDebug().
+     */
+    void setSingleStep(bool enable);
+
+    /**
+     * Number of instructions to stop ahead of an instruction event
+     * before single-stepping to it, 0 if the overflow of the
+     * instruction counter should be used directly.
+     */
+    uint64_t instStopMargin;
+
+    /** Is the vCPU currently being single-stepped? */
+    bool singleStepping;
+
     /** @{ */
     /** Setup hardware performance counters */
     void setupCounters();
@@ -799,6 +843,15 @@ class BaseKvmCPU : public BaseCPU
     /** Host factor as specified in the configuration */
     float hostFactor;
 
+    /** Maximum number of bytes read by warmupCaches(), 0 if unlimited */
+    const uint64_t warmupLimit;
+
+    /**
+     * MMIO ranges whose accesses are completed by re-entering KVM in
+     * the same tick instead of going through the event loop.
+     */
+    const AddrRangeList fastMMIO;
+
   public:
     /* @{ */
     struct StatGroup : public statistics::Group
@@ -810,10 +863,15 @@ class BaseKvmCPU : public BaseCPU
         statistics::Scalar numExitSignal;
         statistics::Scalar numMMIO;
         statistics::Scalar numCoalescedMMIO;
+        statistics::Scalar numFastMMIO;
         statistics::Scalar numIO;
         statistics::Scalar numHalt;
         statistics::Scalar numInterrupts;
         statistics::Scalar numHypercalls;
+        statistics::Scalar numWarmupLines;
+        statistics::Scalar numInstStops;
+        statistics::Scalar numInstStopSteps;
+        statistics::Scalar instStopOvershoot;
     } stats;
     /* @} */
 
@@ -48,6 +48,8 @@
 #include <cerrno>
 #include <memory>
 
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
 #include "cpu/kvm/base.hh"
 #include "debug/Kvm.hh"
 #include "mem/physical.hh"
@@ -214,6 +216,16 @@ Kvm::capIRQLineLayout2() const
 #endif
 }
 
+bool
+Kvm::capGuestDebug() const
+{
+#ifdef KVM_CAP_SET_GUEST_DEBUG
+    return checkExtension(KVM_CAP_SET_GUEST_DEBUG) != 0;
+#else
+    return false;
+#endif
+}
+
 #if defined(__i386__) || defined(__x86_64__)
 bool
 Kvm::getSupportedCPUID(struct kvm_cpuid2 &cpuid) const
@@ -319,7 +331,8 @@ KvmVM::KvmVM(const KvmVMParams &params)
       vmFD(kvm->createVM()),
       started(false),
       _hasKernelIRQChip(false),
-      nextVCPUID(0)
+      nextVCPUID(0),
+      dirtyLogging(false), warmupPagesValid(false)
 {
     system->setKvmVM(this);
     maxMemorySlot = kvm->capNumMemSlots();
@@ -431,7 +444,12 @@ KvmVM::setupMemSlot(const KvmVM::MemSlot num, void *host_addr, Addr guest,
                     uint32_t flags)
 {
     MemorySlot &slot = memorySlots.at(num.num);
+    if (dirtyLogging)
+        flags |= KVM_MEM_LOG_DIRTY_PAGES;
     slot.active = true;
+    slot.hostAddr = host_addr;
+    slot.guestAddr = guest;
+    slot.flags = flags;
     setUserMemoryRegion(num.num, host_addr, guest, slot.size, flags);
 }
 
@@ -477,6 +495,93 @@ KvmVM::setUserMemoryRegion(uint32_t slot,
     }
 }
 
+void
+KvmVM::setDirtyLogging(bool enable)
+{
+    for (auto &slot : memorySlots) {
+        if (!slot.active)
+            continue;
+
+        const uint32_t flags(enable ?
+                slot.flags | KVM_MEM_LOG_DIRTY_PAGES :
+                slot.flags & ~KVM_MEM_LOG_DIRTY_PAGES);
+        if (flags == slot.flags)
+            continue;
+
+        slot.flags = flags;
+        setUserMemoryRegion(slot.slot, slot.hostAddr, slot.guestAddr,
+                            slot.size, flags);
+    }
+
+    dirtyLogging = enable;
+}
+
+std::vector<Addr>
+KvmVM::getDirtyPages()
+{
+    const long page_size(sysconf(_SC_PAGE_SIZE));
+    std::vector<Addr> pages;
+
+    for (const auto &slot : memorySlots) {
+        if (!slot.active || !(slot.flags & KVM_MEM_LOG_DIRTY_PAGES))
+            continue;
+
+        // KVM expects a bitmap with one bit per page, padded to a
+        // multiple of 64 bits.
+        std::vector<uint64_t> bitmap(
+            divCeil(divCeil(slot.size, page_size), 64));
+
+        struct kvm_dirty_log log;
+        memset(&log, 0, sizeof(log));
+        log.slot = slot.slot;
+        log.dirty_bitmap = bitmap.data();
+
+        if (ioctl(KVM_GET_DIRTY_LOG, (void *)&log) == -1)
+            panic("KVM: Failed to get dirty log of slot %i (errno: %i)\n",
+                  slot.slot, errno);
+
+        for (size_t i = 0; i < bitmap.size(); ++i) {
+            for (uint64_t word = bitmap[i]; word; word &= word - 1) {
+                const uint64_t page(i * 64 + ctz64(word));
+                pages.push_back(slot.guestAddr + page * page_size);
+            }
+        }
+    }
+
+    return pages;
+}
+
+void
+KvmVM::beginWarmupWindow()
+{
+    DPRINTF(Kvm, "Starting cache warmup window\n");
+
+    // Reading the log clears it, which is all we need if logging is
+    // already enabled.
+    if (dirtyLogging)
+        getDirtyPages();
+    else
+        setDirtyLogging(true);
+
+    _warmupPages.clear();
+    warmupPagesValid = false;
+}
+
+const std::vector<Addr> &
+KvmVM::warmupPages()
+{
+    if (dirtyLogging && !warmupPagesValid) {
+        _warmupPages = getDirtyPages();
+        warmupPagesValid = true;
+        setDirtyLogging(false);
+
+        DPRINTF(Kvm, "%i pages written during the warmup window\n",
+                _warmupPages.size());
+    }
+
+    return _warmupPages;
+}
+
 void
 KvmVM::coalesceMMIO(const AddrRange &range)
 {
@@ -149,6 +149,9 @@ class Kvm
     /** Support for ARM IRQ line layout 2 **/
     bool capIRQLineLayout2() const;
 
+    /** Support for BaseKvmCPU::setSingleStep(). */
+    bool capGuestDebug() const;
+
     /** @} */
 
 #if defined(__i386__) || defined(__x86_64__)
@@ -408,6 +411,31 @@ class KvmVM : public SimObject
      */
     void freeMemSlot(const MemSlot slot);
 
+    /** @{ */
+    /**
+     * Start a new cache warmup window.
+     *
+     * Enable dirty page logging in all memory slots (or clear the log
+     * if it is already enabled) and forget the pages recorded in the
+     * previous window. The pages written by the guest from this point
+     * on are returned by warmupPages().
+     */
+    void beginWarmupWindow();
+
+    /**
+     * Get the pages written by the guest since beginWarmupWindow().
+     *
+     * The first call after a window has been started collects the
+     * dirty log and disables dirty page logging again to avoid
+     * slowing down the guest. Subsequent calls return the same pages
+     * until the next window is started. The log does not tell which
+     * vCPU wrote a page, so the CPUs split the pages between them.
+     *
+     * @return Guest physical addresses of the written pages
+     */
+    const std::vector<Addr> &warmupPages();
+    /** @} */
+
     /**
      * Create an in-kernel device model.
      *
@@ -483,6 +511,19 @@ class KvmVM : public SimObject
     void setUserMemoryRegion(uint32_t slot,
                              void *host_addr, Addr guest_addr,
                              uint64_t len, uint32_t flags);
+
+    /**
+     * Enable or disable dirty page logging in all active memory slots.
+     */
+    void setDirtyLogging(bool enable);
+
+    /**
+     * Read and clear the dirty page log of all active memory slots.
+     *
+     * @return Guest physical addresses of the pages written since the
+     * log was last read.
+     */
+    std::vector<Addr> getDirtyPages();
     /** @} */
 
     /**
@@ -503,6 +544,9 @@ class KvmVM : public SimObject
      */
     long allocVCPUID();
 
+    /** Get the number of vCPU IDs allocated so far. */
+    long numVCPUs() const { return nextVCPUID; }
+
     /**
      * @addtogroup KvmIoctl
      * @{
@@ -554,9 +598,21 @@ class KvmVM : public SimObject
         uint64_t size;
         uint32_t slot;
         bool active;
+        void *hostAddr;
+        Addr guestAddr;
+        uint32_t flags;
     };
     std::vector<MemorySlot> memorySlots;
     uint32_t maxMemorySlot;
+
+    /** Is dirty page logging enabled for the current warmup window? */
+    bool dirtyLogging;
+
+    /** Have the pages of the current warmup window been collected? */
+    bool warmupPagesValid;
+
+    /** Pages written during the last warmup window */
+    std::vector<Addr> _warmupPages;
 };
 
 } // namespace gem5
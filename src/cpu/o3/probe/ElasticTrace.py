@@ -59,3 +59,7 @@ class ElasticTrace(ProbeListenerObject):
     # Whether to trace virtual addresses for memory accesses
     traceVirtAddr = Param.Bool(False, "Set to true if virtual addresses are " \
                                 "to be traced.")
+    # Shared by the probes of all the cores of a multi-threaded workload to
+    # record the order of their synchronization operations
+    sync = Param.TraceSync(NULL, "Domain in which to record the order of " \
+                           "synchronization operations across cores")
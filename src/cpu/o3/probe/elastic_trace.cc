@@ -62,6 +62,7 @@ ElasticTrace::ElasticTrace(const ElasticTraceParams &params)
        startTraceInst(params.startTraceInst),
        allProbesReg(false),
        traceVirtAddr(params.traceVirtAddr),
+       sync(params.sync),
        stats(this)
 {
     cpu = dynamic_cast<CPU *>(params.manager);
@@ -415,6 +416,15 @@ ElasticTrace::addDepTraceRecord(const DynInstConstPtr& head_inst,
     new_record->size = head_inst->effSize;
     new_record->pc = head_inst->pcState().instAddr();
 
+    // Give committed synchronization operations their position in the
+    // order across all the CPUs sharing the sync domain
+    new_record->syncOrder = -1;
+    if (sync && commit && head_inst->isMemRef() &&
+        TraceSync::isSyncOp(new_record->reqFlags)) {
+        new_record->syncOrder = sync->record(new_record->physAddr);
+        ++stats.numSyncOps;
+    }
+
     // Assign the timing information stored in the execution info object
     new_record->executeTick = exec_info_ptr->executeTick;
     new_record->toCommitTick = exec_info_ptr->toCommitTick;
@@ -838,6 +848,8 @@ ElasticTrace::writeDepTrace(uint32_t num_to_write)
                 if (traceVirtAddr)
                     dep_pkt.set_v_addr(temp_ptr->virtAddr);
                 dep_pkt.set_size(temp_ptr->size);
+                if (temp_ptr->syncOrder != -1)
+                    dep_pkt.set_sync_order(temp_ptr->syncOrder);
             }
             dep_pkt.set_comp_delay(temp_ptr->compDelay);
             if (temp_ptr->robDepList.empty()) {
@@ -905,7 +917,10 @@ ElasticTrace::ElasticTraceStats::ElasticTraceStats(statistics::Group *parent)
       ADD_STAT(maxTempStoreSize, statistics::units::Count::get(),
                "Maximum size of the temporary store during the run"),
       ADD_STAT(maxPhysRegDepMapSize, statistics::units::Count::get(),
-               "Maximum size of register dependency map")
+               "Maximum size of register dependency map"),
+      ADD_STAT(numSyncOps, statistics::units::Count::get(),
+               "Number of synchronization operations recorded in the "
+               "sync domain")
 {
 }
 
@@ -53,6 +53,7 @@
 #include "base/statistics.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/reg_class.hh"
+#include "cpu/trace/trace_sync.hh"
 #include "mem/request.hh"
 #include "params/ElasticTrace.hh"
 #include "proto/inst_dep_record.pb.h"
@@ -292,6 +293,11 @@ class ElasticTrace : public ProbeListenerObject
         Addr virtAddr;
         /* Request size in case of a load/store instruction */
         unsigned size;
+        /**
+         * Position among the synchronization operations on the same
+         * address, or -1 if the instruction is not one.
+         */
+        int64_t syncOrder;
         /** Default Constructor */
         TraceInfo()
           : type(Record::INVALID)
@@ -368,6 +374,9 @@ class ElasticTrace : public ProbeListenerObject
     /** Whether to trace virtual addresses for memory requests. */
     const bool traceVirtAddr;
 
+    /** Optional domain recording the order of synchronization operations */
+    TraceSync *sync;
+
     /** Pointer to the O3CPU that is this listener's parent a.k.a. manager */
     CPU *cpu;
 
@@ -556,6 +565,9 @@ class ElasticTrace : public ProbeListenerObject
          * register.
          */
         statistics::Scalar maxPhysRegDepMapSize;
+
+        /** Number of synchronization operations recorded */
+        statistics::Scalar numSyncOps;
     } stats;
 
 };
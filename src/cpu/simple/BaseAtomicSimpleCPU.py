@@ -60,6 +60,9 @@ class BaseAtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    warming_backdoor = Param.Bool(False,
+        "Do cache hits through the backdoors of warming caches, or "
+        "reads through memory backdoors when bypassing the caches")
 
     def addSimPointProbe(self, interval):
         simpoint = SimPoint()
@@ -79,10 +79,11 @@ AtomicSimpleCPU::AtomicSimpleCPU(const BaseAtomicSimpleCPUParams &p)
       width(p.width), locked(false),
       simulate_data_stalls(p.simulate_data_stalls),
       simulate_inst_stalls(p.simulate_inst_stalls),
+      warmingBackdoor(p.warming_backdoor),
       icachePort(name() + ".icache_port", this),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
-      ppCommit(nullptr)
+      ppCommit(nullptr), ppCommitAccess(nullptr)
 {
     _status = Idle;
     ifetch_req = std::make_shared<Request>();
@@ -272,7 +273,77 @@ AtomicSimpleCPU::suspendContext(ThreadID thread_num)
 Tick
 AtomicSimpleCPU::sendPacket(RequestPort &port, const PacketPtr &pkt)
 {
-    return port.sendAtomic(pkt);
+    if (!warmingBackdoor || pkt->req->isUncacheable())
+        return port.sendAtomic(pkt);
+
+    MemBackdoorPtr bd = nullptr;
+    Tick latency = port.sendAtomicBackdoor(pkt, bd);
+    if (bd)
+        addBackdoor(&port == &icachePort ? instBackdoors : dataBackdoors, bd);
+    return latency;
+}
+
+void
+AtomicSimpleCPU::addBackdoor(BackdoorMap &backdoors, MemBackdoorPtr bd)
+{
+    // A backdoor straight to memory would bypass the caches and the
+    // coherence of the system, so only use the ones of warming caches,
+    // unless the caches are bypassed anyway (e.g. atomic_noncaching
+    // mode with Ruby), in which case it is only used for reads.
+    if ((!bd->hasAccessCallback() && !system->bypassCaches()) ||
+        backdoors.insert(bd->range(), bd) == backdoors.end()) {
+        return;
+    }
+
+    // Install a callback to erase this backdoor if it goes away.
+    auto callback = [&backdoors](const MemBackdoor &backdoor) {
+            for (auto it = backdoors.begin(); it != backdoors.end(); it++) {
+                if (it->second == &backdoor) {
+                    backdoors.erase(it);
+                    return;
+                }
+            }
+            panic("Got invalidation for unknown memory backdoor.");
+        };
+    bd->addInvalidationCallback(callback);
+}
+
+bool
+AtomicSimpleCPU::accessBackdoor(BackdoorMap &backdoors, const RequestPtr &req,
+                                uint8_t *data, bool is_write)
+{
+    if (backdoors.empty() || req->isMasked())
+        return false;
+
+    const Addr paddr = req->getPaddr();
+    auto bd_it = backdoors.contains(RangeSize(paddr, req->getSize()));
+    if (bd_it == backdoors.end())
+        return false;
+
+    // A backdoor straight to memory can only do plain reads while the
+    // caches are bypassed. Writes have to go through the crossbar so
+    // that the other CPUs snoop them, clearing their reservations and
+    // waking up their monitors, and the memory has to see the other
+    // accesses to keep track of reservations.
+    MemBackdoorPtr bd = bd_it->second;
+    if (!bd->hasAccessCallback() &&
+        (is_write || !system->bypassCaches() || req->isLLSC() ||
+         req->isSwap() || req->isAtomic() || req->isLockedRMW() ||
+         req->isCacheMaintenance() || !bd->readable())) {
+        return false;
+    }
+
+    // Let the cache update its tags, it may turn the access down if
+    // it misses or needs anything but a plain hit.
+    if (!bd->access(req, is_write))
+        return false;
+
+    uint8_t *bd_data = bd->ptr() + (paddr - bd->range().start());
+    if (is_write)
+        memcpy(bd_data, data, req->getSize());
+    else
+        memcpy(data, bd_data, req->getSize());
+    return true;
 }
 
 Tick
@@ -374,6 +445,7 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
         traceData->setMem(addr, size, flags);
 
     dcache_latency = 0;
+    dataAccess.size = 0;
 
     req->taskId(taskId());
 
@@ -391,23 +463,32 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
         if (predicate) {
             fault = thread->mmu->translateAtomic(req, thread->getTC(),
                                                  BaseMMU::Read);
+            if (fault == NoFault)
+                recordDataAccess(req, addr, size);
         }
 
         // Now do the access.
         if (predicate && fault == NoFault &&
             !req->getFlags().isSet(Request::NO_ACCESS)) {
-            Packet pkt(req, Packet::makeReadCmd(req));
-            pkt.dataStatic(data);
-
-            if (req->isLocalAccess()) {
-                dcache_latency += req->localAccessor(thread->getTC(), &pkt);
+            if (!req->isLocalAccess() &&
+                accessBackdoor(dataBackdoors, req, data, false)) {
+                // Hit through the backdoor of a warming cache
+                dcache_access = true;
             } else {
-                dcache_latency += sendPacket(dcachePort, &pkt);
-            }
-            dcache_access = true;
+                Packet pkt(req, Packet::makeReadCmd(req));
+                pkt.dataStatic(data);
 
-            panic_if(pkt.isError(), "Data fetch (%s) failed: %s",
-                    pkt.getAddrRange().to_string(), pkt.print());
+                if (req->isLocalAccess()) {
+                    dcache_latency +=
+                        req->localAccessor(thread->getTC(), &pkt);
+                } else {
+                    dcache_latency += sendPacket(dcachePort, &pkt);
+                }
+                dcache_access = true;
+
+                panic_if(pkt.isError(), "Data fetch (%s) failed: %s",
+                        pkt.getAddrRange().to_string(), pkt.print());
+            }
 
             if (req->isLLSC()) {
                 thread->getIsaPtr()->handleLockedRead(req);
@@ -460,6 +541,7 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
         traceData->setMem(addr, size, flags);
 
     dcache_latency = 0;
+    dataAccess.size = 0;
 
     req->taskId(taskId());
 
@@ -475,9 +557,12 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
                                           byte_enable, frag_size, size_left);
 
         // translate to physical address
-        if (predicate)
+        if (predicate) {
             fault = thread->mmu->translateAtomic(req, thread->getTC(),
                                                  BaseMMU::Write);
+            if (fault == NoFault)
+                recordDataAccess(req, addr, size);
+        }
 
         // Now do the access.
         if (predicate && fault == NoFault) {
@@ -495,7 +580,19 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
                 }
             }
 
-            if (do_access && !req->getFlags().isSet(Request::NO_ACCESS)) {
+            if (do_access && !req->getFlags().isSet(Request::NO_ACCESS) &&
+                !req->isLocalAccess() &&
+                accessBackdoor(dataBackdoors, req, data, true)) {
+                // Hit through the backdoor of a warming cache
+                dcache_access = true;
+
+                // Notify other threads on this CPU of write
+                if (numThreads > 1) {
+                    Packet pkt(req, Packet::makeWriteCmd(req));
+                    threadSnoop(&pkt, curThread);
+                }
+            } else if (do_access &&
+                       !req->getFlags().isSet(Request::NO_ACCESS)) {
                 Packet pkt(req, Packet::makeWriteCmd(req));
                 pkt.dataStatic(data);
 
@@ -582,6 +679,9 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
     // translate to physical address
     Fault fault = thread->mmu->translateAtomic(
         req, thread->getTC(), BaseMMU::Write);
+    dataAccess.size = 0;
+    if (fault == NoFault)
+        recordDataAccess(req, addr, size);
 
     // Now do the access.
     if (fault == NoFault && !req->getFlags().isSet(Request::NO_ACCESS)) {
@@ -691,6 +791,8 @@ AtomicSimpleCPU::tick()
                 if (fault == NoFault) {
                     countInst();
                     ppCommit->notify(std::make_pair(thread, curStaticInst));
+                    if (ppCommitAccess->hasListeners())
+                        notifyCommitAccess(needToFetch);
                 } else if (traceData) {
                     traceFault();
                 }
@@ -747,6 +849,12 @@ AtomicSimpleCPU::fetchInstMem()
 {
     auto &decoder = threadInfo[curThread]->thread->decoder;
 
+    if (accessBackdoor(instBackdoors, ifetch_req,
+                       static_cast<uint8_t *>(decoder->moreBytesPtr()),
+                       false)) {
+        return 0;
+    }
+
     Packet pkt = Packet(ifetch_req, MemCmd::ReadReq);
 
     // ifetch_req is initialized to read the instruction
@@ -767,6 +875,22 @@ AtomicSimpleCPU::regProbePoints()
 
     ppCommit = new ProbePointArg<std::pair<SimpleThread*, const StaticInstPtr>>
                                 (getProbeManager(), "Commit");
+    ppCommitAccess = new ProbePointArg<CommitAccess>(getProbeManager(),
+                                                     "CommitAccess");
+}
+
+void
+AtomicSimpleCPU::notifyCommitAccess(bool fetched)
+{
+    CommitAccess access;
+    access.thread = threadInfo[curThread]->thread;
+    access.inst = curStaticInst;
+    access.fetchReq = fetched ? ifetch_req : nullptr;
+
+    if (dcache_access)
+        access.data = dataAccess;
+
+    ppCommitAccess->notify(access);
 }
 
 void
@@ -41,8 +41,10 @@
 #ifndef __CPU_SIMPLE_ATOMIC_HH__
 #define __CPU_SIMPLE_ATOMIC_HH__
 
+#include "base/addr_range_map.hh"
 #include "cpu/simple/base.hh"
 #include "cpu/simple/exec_context.hh"
+#include "mem/backdoor.hh"
 #include "mem/request.hh"
 #include "params/BaseAtomicSimpleCPU.hh"
 #include "sim/probe/probe.hh"
@@ -59,6 +61,38 @@ class AtomicSimpleCPU : public BaseSimpleCPU
 
     void init() override;
 
+    /**
+     * A committed instruction along with the requests it made, passed
+     * to the listeners of the "CommitAccess" probe point. The requests
+     * are reused by the CPU and are only valid during the notification.
+     */
+    struct CommitAccess
+    {
+        /**
+         * Data access of an instruction as a whole. An access split
+         * across cache lines is made with one request per fragment, so
+         * the request alone only describes the last fragment.
+         */
+        struct Data
+        {
+            /** Virtual address of the first byte */
+            Addr vaddr = 0;
+            /** Physical address of the first fragment accessed */
+            Addr paddr = 0;
+            /** Size of the whole access, 0 if there is none */
+            unsigned size = 0;
+            /** Flags of the first fragment after translation */
+            Request::Flags flags = 0;
+        };
+
+        SimpleThread *thread;
+        StaticInstPtr inst;
+        /** Fetch request if the instruction was fetched, or nullptr */
+        RequestPtr fetchReq;
+        /** Data access if the instruction accessed memory, or size 0 */
+        Data data;
+    };
+
   protected:
     EventFunctionWrapper tickEvent;
 
@@ -67,6 +101,40 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     const bool simulate_data_stalls;
     const bool simulate_inst_stalls;
 
+    /**
+     * Ask the caches for backdoors, and use them for the accesses they
+     * report as hits. Only caches warming in atomic mode hand out such
+     * backdoors, see the warming_backdoor cache parameter. When the
+     * caches are bypassed, as with Ruby in atomic_noncaching mode, the
+     * backdoors of the memory are used directly for reads, while writes
+     * are still sent to be snooped by the other CPUs.
+     */
+    const bool warmingBackdoor;
+
+    typedef AddrRangeMap<MemBackdoorPtr, 1> BackdoorMap;
+
+    /** Backdoors handed out by the instruction and data caches. */
+    BackdoorMap instBackdoors;
+    BackdoorMap dataBackdoors;
+
+    /**
+     * Record a backdoor given in response to a packet, if it reports
+     * accesses to its owner.
+     */
+    void addBackdoor(BackdoorMap &backdoors, MemBackdoorPtr bd);
+
+    /**
+     * Try to perform an access through a backdoor instead of a packet.
+     *
+     * @param backdoors The backdoors of the port the access targets.
+     * @param req The translated request.
+     * @param data Buffer to read into or write from.
+     * @param is_write Whether the access is a write.
+     * @return True if the access was performed.
+     */
+    bool accessBackdoor(BackdoorMap &backdoors, const RequestPtr &req,
+                        uint8_t *data, bool is_write);
+
     // main simulation loop (one cycle)
     void tick();
 
@@ -170,8 +238,39 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     bool dcache_access;
     Tick dcache_latency;
 
+    /** Data access of the current instruction, for CommitAccess */
+    CommitAccess::Data dataAccess;
+
+    /**
+     * Record the data access of the current instruction from its first
+     * translated fragment, unless already recorded.
+     *
+     * @param req Request of the fragment
+     * @param addr Virtual address of the whole access
+     * @param size Size of the whole access
+     */
+    void
+    recordDataAccess(const RequestPtr &req, Addr addr, unsigned size)
+    {
+        if (dataAccess.size)
+            return;
+        dataAccess.vaddr = addr;
+        dataAccess.paddr = req->getPaddr();
+        dataAccess.size = size;
+        dataAccess.flags = req->getFlags();
+    }
+
     /** Probe Points. */
     ProbePointArg<std::pair<SimpleThread *, const StaticInstPtr>> *ppCommit;
+    ProbePointArg<CommitAccess> *ppCommitAccess;
+
+    /**
+     * Notify the listeners of the CommitAccess probe point of the commit
+     * of the current instruction.
+     *
+     * @param fetched Whether the instruction was fetched from memory
+     */
+    void notifyCommitAccess(bool fetched);
 
   protected:
 
@@ -0,0 +1,58 @@
+# Copyright (c) 2026 The Regents of The University of Michigan
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.objects.FUPool import DefaultFUPool
+from m5.objects.Probe import ProbeListenerObject
+
+class AtomicElasticTrace(ProbeListenerObject):
+    """Generates elastic traces, to be replayed by the Trace CPU, from the
+    execution of an atomic CPU. The dependencies are computed from the
+    registers and memory locations accessed by the committed instructions,
+    and the computational delays from the latencies of a functional unit
+    pool, instead of being observed in an O3 CPU.
+    """
+    type = 'AtomicElasticTrace'
+    cxx_header = 'cpu/simple/probes/atomic_elastic_trace.hh'
+    cxx_class = 'gem5::AtomicElasticTrace'
+
+    # As for the ElasticTrace probe, the trace files are created in the
+    # output directory, prefixed with the name of the probe.
+    instFetchTraceFile = Param.String(desc="Protobuf trace file name for "
+                                      "instruction fetch tracing")
+    dataDepTraceFile = Param.String(desc="Protobuf trace file name for "
+                                    "data dependency tracing")
+    # Models the instruction window of the core the trace is replayed on:
+    # dependencies on instructions further back are considered complete.
+    # A typical value is 3 times the ROB size of the replaying Trace CPU.
+    depWindowSize = Param.Unsigned(desc="Instruction window size used for "
+                                   "recording data dependencies")
+    fuPool = Param.FUPool(DefaultFUPool(), "Functional units giving the "
+                          "latency of non load/store instructions")
+    traceVirtAddr = Param.Bool(False, "Set to true if virtual addresses are "
+                               "to be traced.")
+    sync = Param.TraceSync(NULL, "Domain in which to record the order of "
+                           "synchronization operations across cores")
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/simple/probes/atomic_elastic_trace.hh"
+
+#include <algorithm>
+
+#include "base/output.hh"
+#include "base/trace.hh"
+#include "cpu/simple_thread.hh"
+#include "debug/ElasticTrace.hh"
+#include "mem/packet.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+AtomicElasticTrace::AtomicElasticTrace(const AtomicElasticTraceParams &params)
+    : ProbeListenerObject(params),
+      fuPool(params.fuPool),
+      depWindowSize(params.depWindowSize),
+      traceVirtAddr(params.traceVirtAddr),
+      sync(params.sync),
+      instTraceStream(nullptr),
+      dataTraceStream(nullptr),
+      nextSeqNum(1),
+      lastMemRef(0),
+      lastFetchLine(MaxAddr),
+      numFiltered(0),
+      stats(this)
+{
+    cpu = dynamic_cast<AtomicSimpleCPU *>(params.manager);
+
+    fatal_if(!cpu, "Manager of %s is not of type AtomicSimpleCPU and "
+             "thus does not support dependency tracing.\n", name());
+
+    fatal_if(depWindowSize == 0, "depWindowSize parameter must be "
+             "non-zero. Recommended size is 3x ROB size of the Trace CPU.\n");
+
+    fatal_if(cpu->numThreads > 1, "numThreads = %i, %s supports tracing "
+             "for single-threaded workload only", cpu->numThreads, name());
+
+    fatal_if(params.instFetchTraceFile == "", "Assign instruction fetch "
+             "trace file path to instFetchTraceFile");
+    fatal_if(params.dataDepTraceFile == "", "Assign data dependency "
+             "trace file path to dataDepTraceFile");
+    std::string filename = simout.resolve(name() + "." +
+                                          params.instFetchTraceFile);
+    instTraceStream = new ProtoOutputStream(filename);
+    filename = simout.resolve(name() + "." + params.dataDepTraceFile);
+    dataTraceStream = new ProtoOutputStream(filename);
+
+    ProtoMessage::PacketHeader inst_pkt_header;
+    inst_pkt_header.set_obj_id(name());
+    inst_pkt_header.set_tick_freq(sim_clock::Frequency);
+    instTraceStream->write(inst_pkt_header);
+
+    ProtoMessage::InstDepRecordHeader data_rec_header;
+    data_rec_header.set_obj_id(name());
+    data_rec_header.set_tick_freq(sim_clock::Frequency);
+    data_rec_header.set_window_size(depWindowSize);
+    dataTraceStream->write(data_rec_header);
+
+    registerExitCallback([this]() { flushTraces(); });
+}
+
+void
+AtomicElasticTrace::regProbeListeners()
+{
+    typedef ProbeListenerArg<AtomicElasticTrace,
+                             AtomicSimpleCPU::CommitAccess>
+        CommitAccessListener;
+    listeners.push_back(new CommitAccessListener(this, "CommitAccess",
+                                                 &AtomicElasticTrace::commit));
+}
+
+AtomicElasticTrace::TraceInfo *
+AtomicElasticTrace::lookup(uint64_t seq_num)
+{
+    if (window.empty() || seq_num < window.front().seqNum)
+        return nullptr;
+    uint64_t idx = seq_num - window.front().seqNum;
+    return idx < window.size() ? &window[idx] : nullptr;
+}
+
+void
+AtomicElasticTrace::fetchTrace(const RequestPtr &req)
+{
+    // The Trace CPU fetches whole lines, so only the first instruction
+    // of a sequence in the same line is of interest.
+    Addr line = req->getPaddr() & ~Addr(cpu->cacheLineSize() - 1);
+    if (line == lastFetchLine)
+        return;
+    lastFetchLine = line;
+
+    ProtoMessage::Packet inst_fetch_pkt;
+    inst_fetch_pkt.set_tick(curTick());
+    inst_fetch_pkt.set_cmd(MemCmd::ReadReq);
+    inst_fetch_pkt.set_pc(req->getPC());
+    inst_fetch_pkt.set_flags(req->getFlags());
+    inst_fetch_pkt.set_addr(line);
+    inst_fetch_pkt.set_size(cpu->cacheLineSize());
+    instTraceStream->write(inst_fetch_pkt);
+    ++stats.numFetches;
+}
+
+void
+AtomicElasticTrace::commit(const AtomicSimpleCPU::CommitAccess &access)
+{
+    if (!dataTraceStream)
+        return;
+
+    if (access.fetchReq)
+        fetchTrace(access.fetchReq);
+
+    const StaticInstPtr &inst = access.inst;
+    if (inst->isNop())
+        return;
+
+    const AtomicSimpleCPU::CommitAccess::Data &data = access.data;
+    ThreadContext *tc = access.thread->getTC();
+
+    TraceInfo rec;
+    rec.seqNum = nextSeqNum++;
+    if (!data.size)
+        rec.type = Record::COMP;
+    else if (inst->isLoad())
+        rec.type = Record::LOAD;
+    else
+        rec.type = Record::STORE;
+    rec.pc = access.thread->pcState().instAddr();
+    rec.physAddr = data.paddr;
+    rec.virtAddr = data.vaddr;
+    rec.size = data.size;
+    rec.flags = (Request::FlagsType)data.flags;
+    rec.compDelay = 0;
+    rec.latency = 0;
+    rec.syncOrder = -1;
+    rec.numDepts = 0;
+
+    // Add a dependency on a record still in the window, returning it.
+    auto add_dep = [this](std::vector<uint64_t> &deps,
+                          uint64_t seq_num) -> TraceInfo * {
+        TraceInfo *parent = lookup(seq_num);
+        if (!parent ||
+            std::find(deps.begin(), deps.end(), seq_num) != deps.end()) {
+            return nullptr;
+        }
+        deps.push_back(seq_num);
+        ++parent->numDepts;
+        return parent;
+    };
+
+    for (int i = 0; i < inst->numSrcRegs(); i++) {
+        const RegId reg = tc->flattenRegId(inst->srcRegIdx(i));
+        if (!reg.isRenameable())
+            continue;
+        auto it = lastWriter.find(reg);
+        if (it == lastWriter.end())
+            continue;
+        TraceInfo *parent = add_dep(rec.regDeps, it->second);
+        if (parent) {
+            rec.compDelay = std::max(rec.compDelay, parent->latency);
+            ++stats.numRegDep;
+        }
+    }
+
+    Addr first_granule = rec.physAddr >> granuleShift;
+    Addr last_granule = rec.size ?
+        (rec.physAddr + rec.size - 1) >> granuleShift : first_granule;
+    if (rec.isLoad()) {
+        for (Addr g = first_granule; g <= last_granule; g++) {
+            auto it = lastStore.find(g);
+            if (it != lastStore.end() && add_dep(rec.robDeps, it->second))
+                ++stats.numMemOrderDep;
+        }
+    } else if (rec.isStore()) {
+        if (lastMemRef && add_dep(rec.robDeps, lastMemRef))
+            ++stats.numMemOrderDep;
+        for (Addr g = first_granule; g <= last_granule; g++)
+            lastStore[g] = rec.seqNum;
+    }
+
+    if (rec.robDeps.empty() && rec.regDeps.empty()) {
+        // Keep the issue order of dependency-free instructions, preferably
+        // on a load or store so that compute records can still be filtered.
+        uint64_t prev = lastMemRef && lookup(lastMemRef) ?
+            lastMemRef : rec.seqNum - 1;
+        if (prev && add_dep(rec.robDeps, prev))
+            ++stats.numIssueOrderDep;
+        else if (rec.seqNum == 1)
+            rec.compDelay = curTick();
+    }
+
+    if (rec.isComp()) {
+        rec.latency = cpu->cyclesToTicks(
+            fuPool->getOpLatency(inst->opClass()));
+    } else {
+        lastMemRef = rec.seqNum;
+    }
+
+    for (int i = 0; i < inst->numDestRegs(); i++) {
+        const RegId reg = tc->flattenRegId(inst->destRegIdx(i));
+        if (reg.isRenameable())
+            lastWriter[reg] = rec.seqNum;
+    }
+
+    if (sync && data.size && TraceSync::isSyncOp(data.flags))
+        rec.syncOrder = sync->record(rec.physAddr);
+
+    DPRINTF(ElasticTrace, "[sn:%lli] %s pc %#x, %d rob deps, %d reg deps, "
+            "comp delay %lli\n", rec.seqNum, Record::RecordType_Name(rec.type),
+            rec.pc, rec.robDeps.size(), rec.regDeps.size(), rec.compDelay);
+
+    window.push_back(std::move(rec));
+    while (window.size() > depWindowSize)
+        writeOldest();
+}
+
+void
+AtomicElasticTrace::writeOldest()
+{
+    const TraceInfo &rec = window.front();
+
+    if (rec.isComp() && rec.numDepts == 0) {
+        // Nothing depends on it, its execution only contributes to the
+        // weight of the next record written.
+        ++numFiltered;
+        ++stats.numFilteredNodes;
+    } else {
+        Record dep_pkt;
+        dep_pkt.set_seq_num(rec.seqNum);
+        dep_pkt.set_type(rec.type);
+        dep_pkt.set_pc(rec.pc);
+        if (!rec.isComp()) {
+            dep_pkt.set_flags(rec.flags);
+            dep_pkt.set_p_addr(rec.physAddr);
+            if (traceVirtAddr)
+                dep_pkt.set_v_addr(rec.virtAddr);
+            dep_pkt.set_size(rec.size);
+            if (rec.syncOrder >= 0)
+                dep_pkt.set_sync_order(rec.syncOrder);
+        }
+        dep_pkt.set_comp_delay(rec.compDelay);
+        for (auto seq_num : rec.robDeps)
+            dep_pkt.add_rob_dep(seq_num);
+        for (auto seq_num : rec.regDeps)
+            dep_pkt.add_reg_dep(seq_num);
+        if (numFiltered) {
+            dep_pkt.set_weight(numFiltered);
+            numFiltered = 0;
+        }
+        dataTraceStream->write(dep_pkt);
+        ++stats.numRecords;
+    }
+
+    if (rec.isStore()) {
+        Addr first_granule = rec.physAddr >> granuleShift;
+        Addr last_granule = rec.size ?
+            (rec.physAddr + rec.size - 1) >> granuleShift : first_granule;
+        for (Addr g = first_granule; g <= last_granule; g++) {
+            auto it = lastStore.find(g);
+            if (it != lastStore.end() && it->second == rec.seqNum)
+                lastStore.erase(it);
+        }
+    }
+
+    window.pop_front();
+}
+
+void
+AtomicElasticTrace::flushTraces()
+{
+    if (!dataTraceStream)
+        return;
+
+    while (!window.empty())
+        writeOldest();
+
+    delete dataTraceStream;
+    delete instTraceStream;
+    dataTraceStream = nullptr;
+    instTraceStream = nullptr;
+}
+
+AtomicElasticTrace::AtomicElasticTraceStats::AtomicElasticTraceStats(
+    statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(numRecords, statistics::units::Count::get(),
+               "Number of records written to the data dependency trace"),
+      ADD_STAT(numRegDep, statistics::units::Count::get(),
+               "Number of register dependencies recorded during tracing"),
+      ADD_STAT(numMemOrderDep, statistics::units::Count::get(),
+               "Number of order (rob) dependencies between loads and "
+               "stores recorded during tracing"),
+      ADD_STAT(numIssueOrderDep, statistics::units::Count::get(),
+               "Number of instructions that got assigned an issue order "
+               "dependency because they were dependency-free"),
+      ADD_STAT(numFilteredNodes, statistics::units::Count::get(),
+               "Number of compute records filtered out as nothing "
+               "depended on them"),
+      ADD_STAT(numFetches, statistics::units::Count::get(),
+               "Number of instruction fetches written to the trace")
+{
+}
+
+} // namespace gem5
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a probe listener generating elastic traces from the
+ * execution of an atomic CPU.
+ */
+
+#ifndef __CPU_SIMPLE_PROBES_ATOMIC_ELASTIC_TRACE_HH__
+#define __CPU_SIMPLE_PROBES_ATOMIC_ELASTIC_TRACE_HH__
+
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "cpu/o3/fu_pool.hh"
+#include "cpu/reg_class.hh"
+#include "cpu/simple/atomic.hh"
+#include "cpu/trace/trace_sync.hh"
+#include "mem/request.hh"
+#include "params/AtomicElasticTrace.hh"
+#include "proto/inst_dep_record.pb.h"
+#include "proto/packet.pb.h"
+#include "proto/protoio.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+/**
+ * The AtomicElasticTrace listens to the instructions committed by an
+ * AtomicSimpleCPU and writes the same instruction fetch and data
+ * dependency traces as the ElasticTrace probe of the O3 CPU, at the
+ * speed of the atomic CPU.
+ *
+ * As there is no out-of-order core to observe, the dependencies and
+ * delays are modelled:
+ * - a register dependency on the last writer of every source register;
+ * - an order dependency of a load on the last store to an overlapping
+ *   location, and of a store on the last load or store, as stores
+ *   commit in order;
+ * - an issue order dependency of an instruction with no other
+ *   dependencies on the instruction before it;
+ * - a computational delay equal to the largest latency, according to
+ *   a functional unit pool, of the non load/store instructions it has a
+ *   register dependency on.
+ * Only dependencies within the instruction window are kept, the older
+ * instructions being considered complete.
+ */
+class AtomicElasticTrace : public ProbeListenerObject
+{
+  public:
+    typedef ProtoMessage::InstDepRecord::RecordType RecordType;
+    typedef ProtoMessage::InstDepRecord Record;
+
+    AtomicElasticTrace(const AtomicElasticTraceParams &params);
+
+    void regProbeListeners() override;
+
+    /**
+     * Add the record of a committed instruction to the window, and
+     * write out the record leaving the window.
+     */
+    void commit(const AtomicSimpleCPU::CommitAccess &access);
+
+    /** Write out all the records and close the trace files. */
+    void flushTraces();
+
+  private:
+    /** A committed instruction in the window */
+    struct TraceInfo
+    {
+        uint64_t seqNum;
+        RecordType type;
+        Addr pc;
+        Addr physAddr;
+        Addr virtAddr;
+        unsigned size;
+        Request::FlagsType flags;
+        std::vector<uint64_t> robDeps;
+        std::vector<uint64_t> regDeps;
+        /** Delay after the last dependency completes */
+        Tick compDelay;
+        /** Latency of the instruction seen by its register dependents */
+        Tick latency;
+        /** Position among the synchronization operations, or -1 */
+        int64_t syncOrder;
+        /** Number of instructions depending on this one */
+        uint32_t numDepts;
+
+        bool isLoad() const { return type == Record::LOAD; }
+        bool isStore() const { return type == Record::STORE; }
+        bool isComp() const { return type == Record::COMP; }
+    };
+
+    /**
+     * Look up a record in the window.
+     *
+     * @param seq_num Sequence number of the record
+     * @return The record or nullptr if it has left the window
+     */
+    TraceInfo *lookup(uint64_t seq_num);
+
+    /** Record the fetch of an instruction if it starts a new line */
+    void fetchTrace(const RequestPtr &req);
+
+    /** Write out and remove the oldest record in the window */
+    void writeOldest();
+
+    /** Granule used to find memory dependencies */
+    static const unsigned granuleShift = 3;
+
+    AtomicSimpleCPU *cpu;
+    o3::FUPool *fuPool;
+
+    const uint32_t depWindowSize;
+    const bool traceVirtAddr;
+    TraceSync *sync;
+
+    ProtoOutputStream *instTraceStream;
+    ProtoOutputStream *dataTraceStream;
+
+    /** Records of the instructions in the window, oldest first */
+    std::deque<TraceInfo> window;
+
+    /** Sequence number of the next committed instruction */
+    uint64_t nextSeqNum;
+
+    /** Last instruction to write every register */
+    std::unordered_map<RegId, uint64_t> lastWriter;
+
+    /** Last store to every granule of memory in the window */
+    std::unordered_map<Addr, uint64_t> lastStore;
+
+    /** Last load or store */
+    uint64_t lastMemRef;
+
+    /** Line of the last fetch written to the trace */
+    Addr lastFetchLine;
+
+    /** Records filtered out since the last one written */
+    uint32_t numFiltered;
+
+    struct AtomicElasticTraceStats : public statistics::Group
+    {
+        AtomicElasticTraceStats(statistics::Group *parent);
+
+        /** Number of records written */
+        statistics::Scalar numRecords;
+
+        /** Number of register dependencies recorded */
+        statistics::Scalar numRegDep;
+
+        /** Number of order dependencies between memory accesses */
+        statistics::Scalar numMemOrderDep;
+
+        /** Number of issue order dependencies */
+        statistics::Scalar numIssueOrderDep;
+
+        /** Number of comp records filtered out as nothing depends on them */
+        statistics::Scalar numFilteredNodes;
+
+        /** Number of instruction fetches written */
+        statistics::Scalar numFetches;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_SIMPLE_PROBES_ATOMIC_ELASTIC_TRACE_HH__
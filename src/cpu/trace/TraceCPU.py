@@ -61,6 +61,13 @@ class TraceCPU(BaseCPU):
 
     instTraceFile = Param.String("", "Instruction trace file")
     dataTraceFile = Param.String("", "Data dependency trace file")
+
+    # Chunked (zstd compressed) traces can be replayed from the middle.
+    # Dependencies on the records before the start are considered met.
+    instTraceStartChunk = Param.Unsigned(0, "Chunk of the instruction "\
+                                         "trace to start replaying from")
+    dataTraceStartChunk = Param.Unsigned(0, "Chunk of the data dependency "\
+                                         "trace to start replaying from")
     sizeStoreBuffer = Param.Unsigned(16, "Number of entries in the store "\
         "buffer")
     sizeLoadBuffer = Param.Unsigned(16, "Number of entries in the load buffer")
@@ -84,3 +91,9 @@ class TraceCPU(BaseCPU):
     progressMsgInterval = Param.Unsigned(0, "Interval of committed "\
                                          "instructions at which to print a"\
                                          " progress msg")
+
+    # When replaying the traces of a multi-threaded workload, the Trace CPUs
+    # share the sync domain the traces were captured with so that their
+    # synchronization operations are replayed in the recorded order
+    sync = Param.TraceSync(NULL, "Domain in which to enforce the recorded "\
+                           "order of synchronization operations")
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/trace/sync_order.hh"
+
+#include <utility>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+uint64_t
+SyncOrder::record(Addr addr)
+{
+    return recorded[addr]++;
+}
+
+bool
+SyncOrder::isNext(Addr addr, uint64_t order) const
+{
+    auto itr = replayed.find(addr);
+    const uint64_t completed = itr == replayed.end() ? 0 :
+        itr->second.completed;
+    panic_if(order < completed, "Synchronization operation %d on %#x "
+             "replayed again.\n", order, addr);
+    return order == completed;
+}
+
+void
+SyncOrder::waitFor(Addr addr, uint64_t order, Callback cb)
+{
+    auto &state = replayed[addr];
+    panic_if(order <= state.completed, "Synchronization operation %d on "
+             "%#x waits for its own turn.\n", order, addr);
+    bool inserted = state.waiting.emplace(order, std::move(cb)).second;
+    panic_if(!inserted, "Synchronization operation %d on %#x is already "
+             "waiting.\n", order, addr);
+}
+
+void
+SyncOrder::complete(Addr addr)
+{
+    auto &state = replayed[addr];
+    state.completed++;
+
+    auto itr = state.waiting.find(state.completed);
+    if (itr != state.waiting.end()) {
+        Callback cb = std::move(itr->second);
+        state.waiting.erase(itr);
+        cb();
+    }
+}
+
+} // namespace gem5
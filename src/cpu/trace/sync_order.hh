@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_TRACE_SYNC_ORDER_HH__
+#define __CPU_TRACE_SYNC_ORDER_HH__
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <unordered_map>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * Order of the synchronization operations on every address. Operations
+ * are given their position among the operations on the same address
+ * when they are recorded, and are replayed in that same order.
+ * Operations on different addresses are not ordered with respect to
+ * each other.
+ */
+class SyncOrder
+{
+  public:
+    typedef std::function<void()> Callback;
+
+    /**
+     * Record the commit of a synchronization operation.
+     *
+     * @param addr Physical address of the operation
+     * @return Position of the operation among those on the address
+     */
+    uint64_t record(Addr addr);
+
+    /**
+     * Check if an operation may execute, i.e. if all the operations
+     * preceding it on the address have completed.
+     *
+     * @param addr Physical address of the operation
+     * @param order Recorded position of the operation
+     */
+    bool isNext(Addr addr, uint64_t order) const;
+
+    /**
+     * Wait for an operation to become the next one on its address.
+     *
+     * @param addr Physical address of the operation
+     * @param order Recorded position of the operation
+     * @param cb Called once the operation may execute
+     */
+    void waitFor(Addr addr, uint64_t order, Callback cb);
+
+    /**
+     * Notify the completion of the next operation on an address, and
+     * wake up the operation following it if it is waiting.
+     *
+     * @param addr Physical address of the operation
+     */
+    void complete(Addr addr);
+
+  private:
+    /** Number of operations recorded on every address */
+    std::unordered_map<Addr, uint64_t> recorded;
+
+    /** Replay state of an address */
+    struct AddrState
+    {
+        /** Number of operations completed */
+        uint64_t completed = 0;
+
+        /** Operations waiting for their turn, by position */
+        std::map<uint64_t, Callback> waiting;
+    };
+
+    std::unordered_map<Addr, AddrState> replayed;
+};
+
+} // namespace gem5
+
+#endif // __CPU_TRACE_SYNC_ORDER_HH__
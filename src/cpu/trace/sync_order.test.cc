@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest-spi.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "base/gtest/logging.hh"
+#include "cpu/trace/sync_order.hh"
+
+using namespace gem5;
+
+/** Recorded positions are counted per address */
+TEST(SyncOrderTest, Record)
+{
+    SyncOrder order;
+    ASSERT_EQ(order.record(0x100), 0u);
+    ASSERT_EQ(order.record(0x100), 1u);
+    ASSERT_EQ(order.record(0x200), 0u);
+    ASSERT_EQ(order.record(0x100), 2u);
+}
+
+/** Only the operation following the completed ones may execute */
+TEST(SyncOrderTest, IsNext)
+{
+    SyncOrder order;
+    ASSERT_TRUE(order.isNext(0x100, 0));
+    ASSERT_FALSE(order.isNext(0x100, 1));
+
+    order.complete(0x100);
+    ASSERT_TRUE(order.isNext(0x100, 1));
+    ASSERT_FALSE(order.isNext(0x100, 2));
+
+    // Other addresses are not affected
+    ASSERT_TRUE(order.isNext(0x200, 0));
+}
+
+/** Waiting operations are woken up one at a time, in order */
+TEST(SyncOrderTest, WaitInOrder)
+{
+    SyncOrder order;
+    std::vector<int> woken;
+    order.waitFor(0x100, 2, [&]() { woken.push_back(2); });
+    order.waitFor(0x100, 1, [&]() { woken.push_back(1); });
+    ASSERT_TRUE(woken.empty());
+
+    order.complete(0x100);
+    ASSERT_EQ(woken, std::vector<int>({1}));
+    ASSERT_TRUE(order.isNext(0x100, 1));
+
+    order.complete(0x100);
+    ASSERT_EQ(woken, std::vector<int>({1, 2}));
+
+    // Nothing is waiting for the next position
+    order.complete(0x100);
+    ASSERT_EQ(woken.size(), 2u);
+    ASSERT_TRUE(order.isNext(0x100, 3));
+}
+
+/** Completions on an address do not wake operations on another */
+TEST(SyncOrderTest, IndependentAddresses)
+{
+    SyncOrder order;
+    bool woken = false;
+    order.waitFor(0x200, 1, [&]() { woken = true; });
+
+    order.complete(0x100);
+    ASSERT_FALSE(woken);
+
+    order.complete(0x200);
+    ASSERT_TRUE(woken);
+}
+
+/** A callback may complete its own operation and wake the next one */
+TEST(SyncOrderTest, CompleteFromCallback)
+{
+    SyncOrder order;
+    bool last = false;
+    order.waitFor(0x100, 1, [&]() { order.complete(0x100); });
+    order.waitFor(0x100, 2, [&]() { last = true; });
+
+    order.complete(0x100);
+    ASSERT_TRUE(last);
+    ASSERT_TRUE(order.isNext(0x100, 2));
+}
+
+/** Replaying an operation that has already completed is an error */
+TEST(SyncOrderDeathTest, ReplayedAgain)
+{
+    SyncOrder order;
+    order.complete(0x100);
+
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW(order.isNext(0x100, 0));
+    ASSERT_NE(gtestLogOutput.str().find("replayed again"),
+              std::string::npos);
+}
+
+/** An operation may only wait once */
+TEST(SyncOrderDeathTest, WaitTwice)
+{
+    SyncOrder order;
+    order.waitFor(0x100, 1, []() {});
+
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW(order.waitFor(0x100, 1, []() {}));
+    ASSERT_NE(gtestLogOutput.str().find("already waiting"),
+              std::string::npos);
+}
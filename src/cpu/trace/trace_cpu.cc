@@ -46,6 +46,24 @@ namespace gem5
 // Declare and initialize the static counter for number of trace CPUs.
 int TraceCPU::numTraceCPUs = 0;
 
+/**
+ * Continue reading a trace from one of its chunks, once its header has
+ * been read.
+ */
+static void
+seekStartChunk(ProtoInputStream &trace, const std::string &filename,
+               size_t chunk)
+{
+    if (chunk == 0)
+        return;
+
+    fatal_if(chunk >= trace.numChunks(),
+             "Cannot start trace %s at chunk %d, it has %d chunks. Only "
+             "zstd compressed traces are chunked.\n",
+             filename, chunk, trace.numChunks());
+    trace.seekChunk(chunk);
+}
+
 TraceCPU::TraceCPU(const TraceCPUParams &params)
     :   BaseCPU(params),
         icachePort(this),
@@ -54,7 +72,8 @@ TraceCPU::TraceCPU(const TraceCPUParams &params)
         dataRequestorID(params.system->getRequestorId(this, "data")),
         instTraceFile(params.instTraceFile),
         dataTraceFile(params.dataTraceFile),
-        icacheGen(*this, ".iside", icachePort, instRequestorID, instTraceFile),
+        icacheGen(*this, ".iside", icachePort, instRequestorID, instTraceFile,
+                  params.instTraceStartChunk),
         dcacheGen(*this, ".dside", dcachePort, dataRequestorID, dataTraceFile,
                   params),
         icacheNextEvent([this]{ schedIcacheNext(); }, name()),
@@ -80,6 +99,12 @@ TraceCPU::TraceCPU(const TraceCPUParams &params)
     fatal_if(params.sizeLoadBuffer > UINT16_MAX,
              "Load buffer size set to %d exceeds the max. value of %d.",
                 params.sizeLoadBuffer, UINT16_MAX);
+    // The recorded order of the synchronization operations starts with
+    // the first ones in the traces
+    fatal_if(params.sync &&
+             (params.instTraceStartChunk || params.dataTraceStartChunk),
+             "%s: Traces replayed in a sync domain must start at chunk 0.",
+             name());
 }
 
 void
@@ -117,14 +142,24 @@ TraceCPU::init()
     // Get the send tick of the first data read/write request
     Tick first_dcache_tick = dcacheGen.init();
 
-    // Set the trace offset as the minimum of that in both traces
-    traceOffset = std::min(first_icache_tick, first_dcache_tick);
-    inform("%s: Time offset (tick) found as min of both traces is %lli.",
-            name(), traceOffset);
-
-    // Schedule next icache and dcache event by subtracting the offset
-    schedule(icacheNextEvent, first_icache_tick - traceOffset);
-    schedule(dcacheNextEvent, first_dcache_tick - traceOffset);
+    if (params().instTraceStartChunk || params().dataTraceStartChunk) {
+        // Traces started from a chunk no longer share a time origin, so
+        // both start right away
+        traceOffset = first_dcache_tick;
+        inform("%s: Starting the traces from chunks %d and %d.", name(),
+               params().instTraceStartChunk, params().dataTraceStartChunk);
+        schedule(icacheNextEvent, curTick());
+        schedule(dcacheNextEvent, curTick());
+    } else {
+        // Set the trace offset as the minimum of that in both traces
+        traceOffset = std::min(first_icache_tick, first_dcache_tick);
+        inform("%s: Time offset (tick) found as min of both traces is %lli.",
+                name(), traceOffset);
+
+        // Schedule next icache and dcache event by subtracting the offset
+        schedule(icacheNextEvent, first_icache_tick - traceOffset);
+        schedule(dcacheNextEvent, first_dcache_tick - traceOffset);
+    }
 
     // Adjust the trace offset for the dcache generator's ready nodes
     // We don't need to do this for the icache generator as it will
@@ -243,6 +278,11 @@ ElasticDataGenStatGroup::ElasticDataGenStatGroup(statistics::Group *parent,
              "Number of strictly ordered loads"),
     ADD_STAT(numSOStores, statistics::units::Count::get(),
              "Number of strictly ordered stores"),
+    ADD_STAT(numSyncOps, statistics::units::Count::get(),
+             "Number of synchronization operations replayed"),
+    ADD_STAT(numSyncWaits, statistics::units::Count::get(),
+             "Number of synchronization operations that waited for "
+             "operations of other CPUs"),
     ADD_STAT(dataLastTick, statistics::units::Tick::get(),
              "Last tick simulated from the elastic data trace")
 {
@@ -412,6 +452,15 @@ TraceCPU::ElasticDataGen::execute()
         assert(graph_itr != depGraph.end());
         GraphNode* node_ptr = graph_itr->second;
 
+        // A synchronization operation which is not next in the recorded
+        // order leaves the readyList until the operations before it
+        // have completed
+        if (!retryPkt && waitForSync(node_ptr)) {
+            readyList.erase(free_itr);
+            free_itr = readyList.begin();
+            continue;
+        }
+
         // If there is a retryPkt send that else execute the load
         if (retryPkt) {
             // The retryPkt must be the request that was created by the
@@ -439,6 +488,16 @@ TraceCPU::ElasticDataGen::execute()
             break;
         }
 
+        // A synchronization operation completes when its response is
+        // received, unless no request was sent for it
+        if (sync && node_ptr->isSync()) {
+            ++elasticStats.numSyncOps;
+            if (node_ptr->isStrictlyOrdered())
+                sync->complete(node_ptr->physAddr);
+            else
+                syncInFlight[node_ptr->seqNum] = node_ptr->physAddr;
+        }
+
         // Proceed to remove dependencies for the successfully executed node.
         // If it is a load which is not strictly ordered and we sent a
         // request for it successfully, we do not yet mark any register
@@ -683,9 +742,61 @@ TraceCPU::ElasticDataGen::checkAndIssue(const GraphNode* node_ptr, bool first)
     }
 }
 
+bool
+TraceCPU::ElasticDataGen::waitForSync(const GraphNode* node_ptr)
+{
+    if (!sync || !node_ptr->isSync() ||
+        sync->isNext(node_ptr->physAddr, node_ptr->syncOrder)) {
+        return false;
+    }
+
+    DPRINTF(TraceCPUData, "Sync. op. %lli on %#x waiting for its turn "
+            "(%lli).\n", node_ptr->seqNum, node_ptr->physAddr,
+            node_ptr->syncOrder);
+    ++elasticStats.numSyncWaits;
+
+    NodeSeqNum seq_num = node_ptr->seqNum;
+    sync->waitFor(node_ptr->physAddr, node_ptr->syncOrder,
+                  [this, seq_num]() { syncReady(seq_num); });
+    hwResource.cancel(node_ptr);
+    return true;
+}
+
+void
+TraceCPU::ElasticDataGen::syncReady(NodeSeqNum seq_num)
+{
+    DPRINTF(TraceCPUData, "Sync. op. %lli may proceed.\n", seq_num);
+
+    auto graph_itr = depGraph.find(seq_num);
+    assert(graph_itr != depGraph.end());
+    const GraphNode* node_ptr = graph_itr->second;
+
+    // The compute delay of the node has already elapsed, so it only has
+    // to get its resources back before it executes
+    if (hwResource.isAvailable(node_ptr)) {
+        addToSortedReadyList(seq_num, owner.clockEdge());
+        hwResource.occupy(node_ptr);
+    } else {
+        DPRINTFR(TraceCPUData, "\t\tResources unavailable for seq. num "
+                "%lli. Adding to depFreeQueue.\n", seq_num);
+        depFreeQueue.push(node_ptr);
+    }
+
+    // If waiting for a retry, execute() is called once it is received
+    if (!retryPkt)
+        owner.schedDcacheNextEvent(owner.clockEdge());
+}
+
 void
 TraceCPU::ElasticDataGen::completeMemAccess(PacketPtr pkt)
 {
+    // Let the next synchronization operation on the address go ahead
+    auto sync_itr = syncInFlight.find(pkt->req->getReqInstSeqNum());
+    if (sync_itr != syncInFlight.end()) {
+        sync->complete(sync_itr->second);
+        syncInFlight.erase(sync_itr);
+    }
+
     // Release the resources for this completed node.
     if (pkt->isWrite()) {
         // Consider store complete.
@@ -907,6 +1018,17 @@ TraceCPU::ElasticDataGen::HardwareResource::releaseStoreBuffer()
     --numInFlightStores;
 }
 
+void
+TraceCPU::ElasticDataGen::HardwareResource::cancel(const GraphNode* node)
+{
+    release(node);
+    // release() keeps the store buffer entry of a store that is sent, as
+    // it is only freed on response
+    if (node->isStore() && !node->isStrictlyOrdered()) {
+        releaseStoreBuffer();
+    }
+}
+
 bool
 TraceCPU::ElasticDataGen::HardwareResource::isAvailable(
         const GraphNode* new_node) const
@@ -1195,8 +1317,10 @@ TraceCPU::DcachePort::recvReqRetry()
 }
 
 TraceCPU::ElasticDataGen::InputStream::InputStream(
-        const std::string& filename, const double time_multiplier) :
+        const std::string& filename, const double time_multiplier,
+        size_t start_chunk) :
     trace(filename),
+    startChunk(start_chunk),
     timeMultiplier(time_multiplier),
     microOpCount(0)
 {
@@ -1214,12 +1338,17 @@ TraceCPU::ElasticDataGen::InputStream::InputStream(
         // when the data dependency trace was captured in the o3cpu model
         windowSize = header_msg.window_size();
     }
+
+    // Dependencies on the records before the start are considered done
+    seekStartChunk(trace, filename, startChunk);
 }
 
 void
 TraceCPU::ElasticDataGen::InputStream::reset()
 {
     trace.reset();
+    if (startChunk)
+        trace.seekChunk(startChunk);
 }
 
 bool
@@ -1279,6 +1408,11 @@ TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
         else
             element->pc = 0;
 
+        if (pkt_msg.has_sync_order())
+            element->syncOrder = pkt_msg.sync_order();
+        else
+            element->syncOrder = -1;
+
         // ROB occupancy number
         ++microOpCount;
         if (pkt_msg.has_weight()) {
@@ -1351,6 +1485,8 @@ TraceCPU::ElasticDataGen::GraphNode::writeElementAsTrace() const
         DPRINTFR(TraceCPUData, ",%i", physAddr);
         DPRINTFR(TraceCPUData, ",%i", size);
         DPRINTFR(TraceCPUData, ",%i", flags);
+        if (isSync())
+            DPRINTFR(TraceCPUData, ",sync:%lli", syncOrder);
     }
     DPRINTFR(TraceCPUData, ",%lli", compDelay);
     DPRINTFR(TraceCPUData, "robDep:");
@@ -1378,8 +1514,9 @@ TraceCPU::ElasticDataGen::GraphNode::typeToStr() const
     return Record::RecordType_Name(type);
 }
 
-TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename)
-    : trace(filename)
+TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename,
+                                                  size_t start_chunk)
+    : trace(filename), startChunk(start_chunk)
 {
     // Create a protobuf message for the header and read it from the stream
     ProtoMessage::PacketHeader header_msg;
@@ -1391,12 +1528,16 @@ TraceCPU::FixedRetryGen::InputStream::InputStream(const std::string& filename)
                   header_msg.tick_freq());
         }
     }
+
+    seekStartChunk(trace, filename, startChunk);
 }
 
 void
 TraceCPU::FixedRetryGen::InputStream::reset()
 {
     trace.reset();
+    if (startChunk)
+        trace.seekChunk(startChunk);
 }
 
 bool
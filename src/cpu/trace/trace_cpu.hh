@@ -46,6 +46,7 @@
 
 #include "base/statistics.hh"
 #include "cpu/base.hh"
+#include "cpu/trace/trace_sync.hh"
 #include "debug/TraceCPUData.hh"
 #include "debug/TraceCPUInst.hh"
 #include "params/TraceCPU.hh"
@@ -143,6 +144,7 @@ class TraceCPU : public BaseCPU
 {
 
   public:
+    PARAMS(TraceCPU);
     TraceCPU(const TraceCPUParams &params);
 
     void init();
@@ -377,13 +379,17 @@ class TraceCPU : public BaseCPU
             // Input file stream for the protobuf trace
             ProtoInputStream trace;
 
+            // Chunk of the trace to start reading from
+            const size_t startChunk;
+
           public:
             /**
              * Create a trace input stream for a given file name.
              *
              * @param filename Path to the file to read from
+             * @param start_chunk Chunk of the trace to start from
              */
-            InputStream(const std::string& filename);
+            InputStream(const std::string& filename, size_t start_chunk);
 
             /**
              * Reset the stream such that it can be played once
@@ -406,11 +412,11 @@ class TraceCPU : public BaseCPU
         /* Constructor */
         FixedRetryGen(TraceCPU& _owner, const std::string& _name,
                    RequestPort& _port, RequestorID requestor_id,
-                   const std::string& trace_file) :
+                   const std::string& trace_file, size_t start_chunk) :
             owner(_owner),
             port(_port),
             requestorId(requestor_id),
-            trace(trace_file),
+            trace(trace_file, start_chunk),
             genName(owner.name() + ".fixedretry." + _name),
             retryPkt(nullptr),
             delta(0),
@@ -590,6 +596,12 @@ class TraceCPU : public BaseCPU
             /** Instruction PC */
             Addr pc;
 
+            /**
+             * Position among the synchronization operations on the same
+             * address, or -1 if the node is not one
+             */
+            int64_t syncOrder;
+
             /** List of order dependencies. */
             RobDepList robDep;
 
@@ -618,6 +630,9 @@ class TraceCPU : public BaseCPU
             /** Is the node a compute (non load/store) node */
             bool isComp() const { return (type == Record::COMP); }
 
+            /** Is the node a synchronization operation */
+            bool isSync() const { return (syncOrder != -1); }
+
             /** Remove completed instruction from register dependency array */
             bool removeRegDep(NodeSeqNum reg_dep);
 
@@ -688,6 +703,15 @@ class TraceCPU : public BaseCPU
             /** Release store buffer entry for a completed store */
             void releaseStoreBuffer();
 
+            /**
+             * Release all the structures held by an issued node that is
+             * taken off the readyList without executing, including the
+             * store buffer entry of a store.
+             *
+             * @param node_ptr pointer to the node
+             */
+            void cancel(const GraphNode* node);
+
             /**
              * Check if structures required to issue a node are free.
              *
@@ -764,6 +788,9 @@ class TraceCPU : public BaseCPU
             /** Input file stream for the protobuf trace */
             ProtoInputStream trace;
 
+            /** Chunk of the trace to start reading from */
+            const size_t startChunk;
+
             /**
              * A multiplier for the compute delays in the trace to modulate
              * the Trace CPU frequency either up or down. The Trace CPU's
@@ -787,9 +814,10 @@ class TraceCPU : public BaseCPU
              *
              * @param filename Path to the file to read from
              * @param time_multiplier used to scale the compute delays
+             * @param start_chunk Chunk of the trace to start from
              */
             InputStream(const std::string& filename,
-                        const double time_multiplier);
+                        const double time_multiplier, size_t start_chunk);
 
             /**
              * Reset the stream such that it can be played once
@@ -824,7 +852,8 @@ class TraceCPU : public BaseCPU
             owner(_owner),
             port(_port),
             requestorId(requestor_id),
-            trace(trace_file, 1.0 / params.freqMultiplier),
+            trace(trace_file, 1.0 / params.freqMultiplier,
+                  params.dataTraceStartChunk),
             genName(owner.name() + ".elastic." + _name),
             retryPkt(nullptr),
             traceComplete(false),
@@ -832,7 +861,8 @@ class TraceCPU : public BaseCPU
             execComplete(false),
             windowSize(trace.getWindowSize()),
             hwResource(params.sizeROB, params.sizeStoreBuffer,
-                       params.sizeLoadBuffer), elasticStats(&_owner, _name)
+                       params.sizeLoadBuffer),
+            sync(params.sync), elasticStats(&_owner, _name)
         {
             DPRINTF(TraceCPUData, "Window size in the trace is %d.\n",
                     windowSize);
@@ -942,6 +972,27 @@ class TraceCPU : public BaseCPU
          */
         bool checkAndIssue(const GraphNode* node_ptr, bool first=true);
 
+        /**
+         * Check if a ready node is a synchronization operation that has
+         * to wait for operations of other CPUs. If so, the node is parked
+         * in the sync domain until its turn comes, and gives up its
+         * resources meanwhile so that it does not hold back younger nodes
+         * of other addresses.
+         *
+         * @param node_ptr pointer to the node about to execute
+         * @return true if the node must wait
+         */
+        bool waitForSync(const GraphNode* node_ptr);
+
+        /**
+         * Reissue a node that waited for its turn in the sync domain. It
+         * goes back into the readyList if resources are available, and
+         * into the depFreeQueue otherwise.
+         *
+         * @param seq_num seq. num of the node
+         */
+        void syncReady(NodeSeqNum seq_num);
+
         /** Get number of micro-ops modelled in the TraceCPU replay */
         uint64_t getMicroOpCount() const { return trace.getMicroOpCount(); }
 
@@ -1005,6 +1056,19 @@ class TraceCPU : public BaseCPU
         /** List of nodes that are ready to execute */
         std::list<ReadyNode> readyList;
 
+        /**
+         * Domain ordering the synchronization operations across CPUs, if
+         * the trace is replayed along with the traces of other threads.
+         */
+        TraceSync *sync;
+
+        /**
+         * Address of the synchronization operations sent to memory,
+         * indexed by seq. num, which are complete once the response is
+         * received.
+         */
+        std::unordered_map<NodeSeqNum, Addr> syncInFlight;
+
       protected:
         // Defining the a stat group
         struct ElasticDataGenStatGroup : public statistics::Group
@@ -1022,6 +1086,9 @@ class TraceCPU : public BaseCPU
             statistics::Scalar numSplitReqs;
             statistics::Scalar numSOLoads;
             statistics::Scalar numSOStores;
+            /** Synchronization operations replayed and delayed */
+            statistics::Scalar numSyncOps;
+            statistics::Scalar numSyncWaits;
             /** Tick when ElasticDataGen completes execution */
             statistics::Scalar dataLastTick;
         } elasticStats;
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_TRACE_TRACE_SYNC_HH__
+#define __CPU_TRACE_TRACE_SYNC_HH__
+
+#include "cpu/trace/sync_order.hh"
+#include "mem/request.hh"
+#include "params/TraceSync.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * The TraceSync keeps the order of the synchronization operations of
+ * the CPUs of a multi-threaded workload. When capturing elastic
+ * traces, each operation is given its position among the operations
+ * on the same address, in commit order across all the CPUs. When the
+ * traces are replayed, an operation is only executed once all the
+ * operations before it on that address have completed, so that lock
+ * handovers and barrier arrivals happen in the recorded order.
+ */
+class TraceSync : public SimObject, public SyncOrder
+{
+  public:
+    PARAMS(TraceSync);
+    TraceSync(const Params &p);
+
+    /**
+     * Check if a request takes part in synchronization between CPUs.
+     *
+     * @param flags Flags of the request
+     * @return true for atomic, locked and load-locked/store-conditional
+     *         requests
+     */
+    static bool
+    isSyncOp(Request::Flags flags)
+    {
+        return flags.isSet(Request::LLSC | Request::LOCKED_RMW |
+                           Request::ATOMIC_RETURN_OP |
+                           Request::ATOMIC_NO_RETURN_OP);
+    }
+};
+
+} // namespace gem5
+
+#endif // __CPU_TRACE_TRACE_SYNC_HH__
@@ -174,6 +174,13 @@ class Linux : public OperatingSystem
         uint64_t iov_len;
     };
 
+    // For epoll_ctl() and epoll_wait()
+    struct tgt_epoll_event
+    {
+        uint32_t events;
+        uint64_t data; // epoll_data_t
+    };
+
     // For select().
     // linux-3.14-src/include/uapi/linux/posix_types.h
     struct fd_set
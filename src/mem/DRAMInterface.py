@@ -46,6 +46,11 @@ from m5.objects.MemInterface import *
 class PageManage(Enum): vals = ['open', 'open_adaptive', 'close',
                                 'close_adaptive']
 
+# Enum for the model used to compute the per-rank energy stats, either
+# DRAMPower, which replays the full command trace, or a closed-form model
+# based on command counts and power-state residency.
+class DRAMEnergyModel(Enum): vals = ['drampower', 'counters']
+
 class DRAMInterface(MemInterface):
     type = 'DRAMInterface'
     cxx_header = "mem/dram_interface.hh"
@@ -76,6 +81,11 @@ class DRAMInterface(MemInterface):
     # IO and RD/WR termination power by default. This might be added as an
     # additional feature in the future.
 
+    # The counter based energy model avoids keeping and replaying the
+    # command trace, and is within a few percent of DRAMPower
+    energy_model = Param.DRAMEnergyModel('drampower',
+                                         "Model used for the energy stats")
+
     # timing behaviour and constraints - all in nanoseconds
 
     # the amount of time in nanoseconds from issuing an activate command
@@ -42,6 +42,8 @@ from m5.proxy import *
 from m5.SimObject import SimObject
 
 from m5.objects.ClockedObject import ClockedObject
+from m5.objects.IndexingPolicies import *
+from m5.objects.ReplacementPolicies import *
 
 class BaseXBar(ClockedObject):
     type = 'BaseXBar'
@@ -144,6 +146,22 @@ class SnoopFilter(SimObject):
     # Sanity check on max capacity to track, adjust if needed.
     max_capacity = Param.MemorySize('8MiB', "Maximum capacity of snoop filter")
 
+    # A bounded snoop filter is organised as a set-associative table of
+    # line entries, like an inclusive directory. When a set is full an
+    # entry is evicted, and the line is back-invalidated in the caches
+    # above that hold it.
+    bounded = Param.Bool(False, "Bound the snoop filter to a "
+                         "set-associative table")
+    entries = Param.MemorySize("16384",
+        "Number of entries of a bounded snoop filter")
+    assoc = Param.Int(8, "Associativity of a bounded snoop filter")
+    indexing_policy = Param.BaseIndexingPolicy(
+        SetAssociative(entry_size = 1, assoc = Parent.assoc,
+        size = Parent.entries),
+        "Indexing policy of a bounded snoop filter")
+    replacement_policy = Param.BaseReplacementPolicy(LRURP(),
+        "Replacement policy of a bounded snoop filter")
+
 # We use a coherent crossbar to connect multiple requestors to the L2
 # caches. Normally this crossbar would be part of the cache itself.
 class L2XBar(CoherentXBar):
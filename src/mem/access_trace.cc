@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/access_trace.hh"
+
+#include <cassert>
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Bit of a record token set when the requestor follows the token */
+const uint64_t NewRequestor = 0x4;
+
+/** Bits of a record token holding the operation */
+const uint64_t OpMask = 0x3;
+
+/** Number of low bits of a record token not holding the address delta */
+const int DeltaShift = 3;
+
+} // anonymous namespace
+
+AccessTrace::AccessTrace(size_t max_records, size_t chunk_records)
+    : maxRecords(max_records), chunkRecords(chunk_records),
+      numRecords(0), numBytes(0), last{0, Read, 0}
+{
+    assert(chunkRecords > 0);
+}
+
+void
+AccessTrace::putVarint(std::vector<uint8_t> &data, uint64_t value)
+{
+    while (value >= 0x80) {
+        data.push_back(uint8_t(value) | 0x80);
+        value >>= 7;
+    }
+    data.push_back(uint8_t(value));
+}
+
+uint64_t
+AccessTrace::getVarint(const uint8_t *&ptr)
+{
+    uint64_t value = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+        byte = *ptr++;
+        value |= uint64_t(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+void
+AccessTrace::append(const Record &rec)
+{
+    if (maxRecords == 0)
+        return;
+
+    if (chunks.empty() || chunks.back().records == chunkRecords) {
+        // Only drop the oldest chunk once the others hold enough
+        // records on their own
+        if (!chunks.empty() &&
+            numRecords - chunks.front().records >= maxRecords) {
+            numRecords -= chunks.front().records;
+            numBytes -= chunks.front().data.size();
+            chunks.pop_front();
+        }
+        chunks.emplace_back();
+        last = {0, Read, 0};
+    }
+
+    Chunk &chunk = chunks.back();
+    const size_t old_size = chunk.data.size();
+
+    // Zigzag encode the delta so that small negative strides are small
+    const int64_t delta = int64_t(rec.line - last.line);
+    const uint64_t zigzag = (uint64_t(delta) << 1) ^ uint64_t(delta >> 63);
+    const bool new_requestor = rec.requestor != last.requestor;
+
+    putVarint(chunk.data, (zigzag << DeltaShift) |
+              (new_requestor ? NewRequestor : 0) | rec.op);
+    if (new_requestor)
+        putVarint(chunk.data, rec.requestor);
+
+    chunk.records++;
+    numRecords++;
+    numBytes += chunk.data.size() - old_size;
+    last = rec;
+}
+
+void
+AccessTrace::decode(const uint8_t *&ptr, Record &prev)
+{
+    const uint64_t token = getVarint(ptr);
+    const uint64_t zigzag = token >> DeltaShift;
+    const int64_t delta = int64_t(zigzag >> 1) ^ -int64_t(zigzag & 1);
+
+    prev.line += Addr(delta);
+    prev.op = Op(token & OpMask);
+    if (token & NewRequestor)
+        prev.requestor = RequestorID(getVarint(ptr));
+}
+
+void
+AccessTrace::clear()
+{
+    chunks.clear();
+    numRecords = 0;
+    numBytes = 0;
+    last = {0, Read, 0};
+}
+
+} // namespace gem5
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * AccessTrace declaration
+ */
+
+#ifndef __MEM_ACCESS_TRACE_HH__
+#define __MEM_ACCESS_TRACE_HH__
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/request.hh"
+
+namespace gem5
+{
+
+/**
+ * A bounded, in-memory trace of cache line accesses, keeping only the
+ * most recent ones. Records are delta encoded against the previous
+ * record as variable length integers, typically taking one or two
+ * bytes each, and grouped in chunks that can be decoded on their own
+ * so that the oldest records can be dropped a chunk at a time.
+ */
+class AccessTrace
+{
+  public:
+    enum Op : uint8_t
+    {
+        Read = 0,
+        Write,
+        Fetch
+    };
+
+    struct Record
+    {
+        /** Cache line number, i.e. the address divided by the line size */
+        Addr line;
+        Op op;
+        RequestorID requestor;
+
+        bool
+        operator==(const Record &other) const
+        {
+            return line == other.line && op == other.op &&
+                requestor == other.requestor;
+        }
+    };
+
+  private:
+    struct Chunk
+    {
+        std::vector<uint8_t> data;
+        size_t records = 0;
+    };
+
+    /** Chunks, from the oldest to the most recent */
+    std::deque<Chunk> chunks;
+
+    /** Records to keep */
+    const size_t maxRecords;
+
+    /** Records in a chunk */
+    const size_t chunkRecords;
+
+    /** Records currently held */
+    size_t numRecords;
+
+    /** Bytes used by the encoded records */
+    size_t numBytes;
+
+    /** Previous record of the current chunk */
+    Record last;
+
+    static void putVarint(std::vector<uint8_t> &data, uint64_t value);
+    static uint64_t getVarint(const uint8_t *&ptr);
+
+  public:
+    /**
+     * @param max_records The number of most recent records to keep,
+     *                    the trace may hold up to one chunk more.
+     * @param chunk_records The number of records in a chunk.
+     */
+    AccessTrace(size_t max_records, size_t chunk_records=4096);
+
+    /** Append a record, dropping the oldest chunk if needed. */
+    void append(const Record &rec);
+
+    /** Drop all the records. */
+    void clear();
+
+    size_t size() const { return numRecords; }
+    bool empty() const { return numRecords == 0; }
+
+    /** Bytes used by the encoded records. */
+    size_t bytes() const { return numBytes; }
+
+    /**
+     * Call a function on all the records, from the oldest to the most
+     * recent one.
+     */
+    template <typename F>
+    void
+    forEach(F &&func) const
+    {
+        for (const auto &chunk : chunks) {
+            const uint8_t *ptr = chunk.data.data();
+            Record rec = {0, Read, 0};
+            for (size_t i = 0; i < chunk.records; i++) {
+                decode(ptr, rec);
+                func(rec);
+            }
+        }
+    }
+
+  private:
+    /** Decode the record following prev, overwriting it. */
+    static void decode(const uint8_t *&ptr, Record &prev);
+};
+
+} // namespace gem5
+
+#endif //__MEM_ACCESS_TRACE_HH__
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "mem/access_trace.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+std::vector<AccessTrace::Record>
+records(const AccessTrace &trace)
+{
+    std::vector<AccessTrace::Record> recs;
+    trace.forEach([&recs](const AccessTrace::Record &rec) {
+        recs.push_back(rec);
+    });
+    return recs;
+}
+
+} // anonymous namespace
+
+TEST(AccessTraceTest, Empty)
+{
+    AccessTrace trace(16);
+    EXPECT_TRUE(trace.empty());
+    EXPECT_EQ(0, trace.size());
+    EXPECT_EQ(0, trace.bytes());
+    EXPECT_TRUE(records(trace).empty());
+}
+
+TEST(AccessTraceTest, RoundTrip)
+{
+    AccessTrace trace(1000, 64);
+    std::vector<AccessTrace::Record> expected;
+
+    std::mt19937_64 rng(1);
+    Addr line = 0x1000;
+    for (int i = 0; i < 1000; i++) {
+        // Mostly small strides, with the odd far jump
+        if (rng() % 16 == 0)
+            line = rng() >> 8;
+        else
+            line += int(rng() % 9) - 4;
+        AccessTrace::Record rec = {line, AccessTrace::Op(rng() % 3),
+                                   RequestorID(rng() % 4)};
+        trace.append(rec);
+        expected.push_back(rec);
+    }
+
+    EXPECT_EQ(1000, trace.size());
+    EXPECT_EQ(expected, records(trace));
+}
+
+TEST(AccessTraceTest, Compact)
+{
+    AccessTrace trace(1024);
+    for (Addr line = 0; line < 1024; line++)
+        trace.append({line, AccessTrace::Read, 3});
+
+    // A stream from a single requestor takes one byte per record, plus
+    // one byte for the first requestor
+    EXPECT_EQ(1024 + 1, trace.bytes());
+}
+
+TEST(AccessTraceTest, KeepsMostRecent)
+{
+    AccessTrace trace(100, 10);
+    for (Addr line = 0; line < 1000; line++)
+        trace.append({line, AccessTrace::Write, 0});
+
+    auto recs = records(trace);
+    ASSERT_GE(recs.size(), 100);
+    ASSERT_LE(recs.size(), 110);
+    EXPECT_EQ(recs.size(), trace.size());
+    for (size_t i = 0; i < recs.size(); i++)
+        EXPECT_EQ(1000 - recs.size() + i, recs[i].line);
+
+    trace.clear();
+    EXPECT_TRUE(trace.empty());
+    EXPECT_EQ(0, trace.bytes());
+}
@@ -34,6 +34,7 @@
 
 #include "base/addr_range.hh"
 #include "base/callback.hh"
+#include "mem/request.hh"
 
 namespace gem5
 {
@@ -45,6 +46,13 @@ class MemBackdoor
     // a const reference to this back door as their only parameter.
     typedef std::function<void(const MemBackdoor &backdoor)> CbFunction;
 
+    // Some holders, e.g. caches keeping their tags warm, can only hand out a
+    // back door if they are told about the accesses made through it. The
+    // callable returns false if the access can't be done through the back
+    // door and has to be sent as a packet instead.
+    typedef std::function<bool(const RequestPtr &req, bool is_write)>
+        AccessFunction;
+
   public:
     enum Flags
     {
@@ -116,8 +124,22 @@ class MemBackdoor
         invalidationCallbacks.clear();
     }
 
+    // Set up a callable to be told about accesses made through this back
+    // door. Requestors accessing data through a back door which has one
+    // must call access() first, and fall back to a packet if it returns
+    // false.
+    void accessCallback(AccessFunction func) { accessFunc = func; }
+    bool hasAccessCallback() const { return bool(accessFunc); }
+
+    bool
+    access(const RequestPtr &req, bool is_write) const
+    {
+        return !accessFunc || accessFunc(req, is_write);
+    }
+
   private:
     CallbackQueue invalidationCallbacks;
+    AccessFunction accessFunc;
 
     AddrRange _range;
     uint8_t *_ptr;
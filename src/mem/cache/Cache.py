@@ -152,6 +152,14 @@ class BaseCache(ClockedObject):
     # data cache.
     write_allocator = Param.WriteAllocator(NULL, "Write allocator")
 
+    # When warming the cache in atomic mode, keep the line data in the
+    # memory below (reached through a backdoor) rather than in the data
+    # array, and hand a backdoor up that only updates the tags. This
+    # lets a warming CPU read and write hits directly in host memory,
+    # while the cache state evolves as if the accesses were packets.
+    warming_backdoor = Param.Bool(False,
+        "Use memory backdoors to warm the cache in atomic mode")
+
 class Cache(BaseCache):
     type = 'Cache'
     cxx_header = 'mem/cache/cache.hh'
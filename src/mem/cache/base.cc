@@ -86,6 +86,10 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       compressor(p.compressor),
       prefetcher(p.prefetcher),
       writeAllocator(p.write_allocator),
+      warmingBackdoor(p.warming_backdoor),
+      warmingBackdoors([this](const MemBackdoor &bd) {
+          removeWarmingBackdoor(bd);
+      }),
       writebackClean(p.writeback_clean),
       tempBlockWriteback(nullptr),
       writebackTempBlockAtomicEvent([this]{ writebackTempBlockAtomic(); },
@@ -134,6 +138,9 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
         "Compressed cache %s does not have a compression algorithm", name());
     if (compressor)
         compressor->setCache(this);
+
+    fatal_if(warmingBackdoor && compressor,
+        "Cache %s can't use a warming backdoor with a compressor", name());
 }
 
 BaseCache::~BaseCache()
@@ -197,6 +204,135 @@ BaseCache::init()
     forwardSnoops = cpuSidePort.isSnooping();
 }
 
+void
+BaseCache::drainResume()
+{
+    ClockedObject::drainResume();
+
+    // Only atomic accesses go through backdoors, so move the data
+    // back into the blocks when switching to any other mode
+    if (!system->isAtomicMode()) {
+        while (!warmingBackdoors.empty())
+            removeWarmingBackdoor(*warmingBackdoors.front()->below);
+    }
+}
+
+uint8_t *
+BaseCache::warmingBlkData(CacheBlk *blk)
+{
+    const Addr blk_addr = regenerateBlkAddr(blk);
+    WarmingBackdoors::Entry *wbd = warmingBackdoors.find(blk_addr);
+    if (!wbd)
+        return blk->data;
+
+    const MemBackdoor &bd = wbd->above;
+    return bd.ptr() + (blk_addr - bd.range().start());
+}
+
+Tick
+BaseCache::sendAtomicBelow(PacketPtr pkt)
+{
+    if (!warmingBackdoor || pkt->req->isUncacheable())
+        return memSidePort.sendAtomic(pkt);
+
+    MemBackdoorPtr bd = nullptr;
+    Tick latency = memSidePort.sendAtomicBackdoor(pkt, bd);
+    if (bd && !warmingBackdoors.find(*bd))
+        addWarmingBackdoor(bd);
+    return latency;
+}
+
+void
+BaseCache::addWarmingBackdoor(MemBackdoorPtr bd)
+{
+    // The data of the blocks is read and written in place
+    if (!bd->readable() || !bd->writeable())
+        return;
+
+    auto wbd = warmingBackdoors.add(bd,
+        [this](const RequestPtr &req, bool is_write) {
+            return warmingAccess(req, is_write);
+        });
+    if (!wbd) {
+        DPRINTF(Cache, "Not using warming backdoor for %s, it overlaps "
+                "one already held\n", bd->range().to_string());
+        return;
+    }
+
+    DPRINTF(Cache, "Using warming backdoor for %s\n",
+            bd->range().to_string());
+
+    // All the valid copies of a line are up to date, whereas the memory
+    // may not be, so ours can be used to update it
+    const AddrRange &range = bd->range();
+    tags->forEachBlk([this, bd, &range](CacheBlk &blk) {
+        if (!blk.isValid())
+            return;
+        const Addr blk_addr = regenerateBlkAddr(&blk);
+        if (range.contains(blk_addr)) {
+            std::memcpy(bd->ptr() + (blk_addr - range.start()), blk.data,
+                        blkSize);
+        }
+    });
+}
+
+void
+BaseCache::removeWarmingBackdoor(const MemBackdoor &bd)
+{
+    WarmingBackdoors::Entry *wbd = warmingBackdoors.find(bd);
+    if (!wbd)
+        return;
+
+    DPRINTF(Cache, "Dropping warming backdoor for %s\n",
+            bd.range().to_string());
+
+    // The memory holds the up to date data of our blocks
+    const AddrRange &range = bd.range();
+    tags->forEachBlk([this, &bd, &range](CacheBlk &blk) {
+        if (!blk.isValid())
+            return;
+        const Addr blk_addr = regenerateBlkAddr(&blk);
+        if (range.contains(blk_addr)) {
+            std::memcpy(blk.data, bd.ptr() + (blk_addr - range.start()),
+                        blkSize);
+        }
+    });
+
+    warmingBackdoors.remove(wbd);
+}
+
+bool
+BaseCache::warmingAccess(const RequestPtr &req, bool is_write)
+{
+    // Anything but plain cacheable reads and writes, as well as writes
+    // whose data is being observed, goes through access()
+    if (req->isUncacheable() || req->isLLSC() || req->isSwap() ||
+        req->isAtomic() || req->isLockedRMW() || req->isCacheMaintenance() ||
+        req->isPrefetch() || !system->isAtomicMode() ||
+        (is_write && (isReadOnly || ppDataUpdate->hasListeners()))) {
+        return false;
+    }
+
+    Packet pkt(req, is_write ? MemCmd::WriteReq : MemCmd::ReadReq);
+    CacheBlk *blk = tags->findBlock(pkt.getAddr(), pkt.isSecure());
+    if (!blk || !blk->isSet(is_write ? CacheBlk::WritableBit :
+                                       CacheBlk::ReadableBit)) {
+        return false;
+    }
+
+    // Only update the tags once the access is known to hit
+    Cycles lat = lookupLatency;
+    tags->accessBlock(&pkt, lat);
+    incHitCount(&pkt);
+    if (is_write) {
+        blk->checkWrite(&pkt);
+        blk->setCoherenceBits(CacheBlk::DirtyBit);
+    }
+    stats.warmingHits++;
+
+    return true;
+}
+
 Port &
 BaseCache::getPort(const std::string &if_name, PortID idx)
 {
@@ -729,7 +865,7 @@ BaseCache::functionalAccess(PacketPtr pkt, bool from_cpu_side)
     // see if we have data at all (owned or otherwise)
     bool have_data = blk && blk->isValid()
         && pkt->trySatisfyFunctional(&cbpw, blk_addr, is_secure, blkSize,
-                                     blk->data);
+                                     blkData(blk));
 
     // data we have is dirty if marked as such or if we have an
     // in-service MSHR that is pending a modified line
@@ -770,22 +906,23 @@ BaseCache::updateBlockData(CacheBlk *blk, const PacketPtr cpkt,
     bool has_old_data)
 {
     DataUpdate data_update(regenerateBlkAddr(blk), blk->isSecure());
+    uint8_t *blk_data = blkData(blk);
     if (ppDataUpdate->hasListeners()) {
         if (has_old_data) {
-            data_update.oldData = std::vector<uint64_t>(blk->data,
-                blk->data + (blkSize / sizeof(uint64_t)));
+            data_update.oldData = std::vector<uint64_t>(blk_data,
+                blk_data + (blkSize / sizeof(uint64_t)));
         }
     }
 
     // Actually perform the data update
     if (cpkt) {
-        cpkt->writeDataToBlock(blk->data, blkSize);
+        cpkt->writeDataToBlock(blk_data, blkSize);
     }
 
     if (ppDataUpdate->hasListeners()) {
         if (cpkt) {
-            data_update.newData = std::vector<uint64_t>(blk->data,
-                blk->data + (blkSize / sizeof(uint64_t)));
+            data_update.newData = std::vector<uint64_t>(blk_data,
+                blk_data + (blkSize / sizeof(uint64_t)));
         }
         ppDataUpdate->notify(data_update);
     }
@@ -802,15 +939,16 @@ BaseCache::cmpAndSwap(CacheBlk *blk, PacketPtr pkt)
     uint32_t condition_val32;
 
     int offset = pkt->getOffset(blkSize);
-    uint8_t *blk_data = blk->data + offset;
+    uint8_t *data = blkData(blk);
+    uint8_t *blk_data = data + offset;
 
     assert(sizeof(uint64_t) >= pkt->getSize());
 
     // Get a copy of the old block's contents for the probe before the update
     DataUpdate data_update(regenerateBlkAddr(blk), blk->isSecure());
     if (ppDataUpdate->hasListeners()) {
-        data_update.oldData = std::vector<uint64_t>(blk->data,
-            blk->data + (blkSize / sizeof(uint64_t)));
+        data_update.oldData = std::vector<uint64_t>(data,
+            data + (blkSize / sizeof(uint64_t)));
     }
 
     overwrite_mem = true;
@@ -837,8 +975,8 @@ BaseCache::cmpAndSwap(CacheBlk *blk, PacketPtr pkt)
         blk->setCoherenceBits(CacheBlk::DirtyBit);
 
         if (ppDataUpdate->hasListeners()) {
-            data_update.newData = std::vector<uint64_t>(blk->data,
-                blk->data + (blkSize / sizeof(uint64_t)));
+            data_update.newData = std::vector<uint64_t>(data,
+                data + (blkSize / sizeof(uint64_t)));
             ppDataUpdate->notify(data_update);
         }
     }
@@ -1105,15 +1243,16 @@ BaseCache::satisfyRequest(PacketPtr pkt, CacheBlk *blk, bool, bool)
             // Get a copy of the old block's contents for the probe before
             // the update
             DataUpdate data_update(regenerateBlkAddr(blk), blk->isSecure());
+            uint8_t *data = blkData(blk);
             if (ppDataUpdate->hasListeners()) {
-                data_update.oldData = std::vector<uint64_t>(blk->data,
-                    blk->data + (blkSize / sizeof(uint64_t)));
+                data_update.oldData = std::vector<uint64_t>(data,
+                    data + (blkSize / sizeof(uint64_t)));
             }
 
             // extract data from cache and save it into the data field in
             // the packet as a return value from this atomic op
             int offset = tags->extractBlkOffset(pkt->getAddr());
-            uint8_t *blk_data = blk->data + offset;
+            uint8_t *blk_data = data + offset;
             pkt->setData(blk_data);
 
             // execute AMO operation
@@ -1121,8 +1260,8 @@ BaseCache::satisfyRequest(PacketPtr pkt, CacheBlk *blk, bool, bool)
 
             // Inform of this block's data contents update
             if (ppDataUpdate->hasListeners()) {
-                data_update.newData = std::vector<uint64_t>(blk->data,
-                    blk->data + (blkSize / sizeof(uint64_t)));
+                data_update.newData = std::vector<uint64_t>(data,
+                    data + (blkSize / sizeof(uint64_t)));
                 ppDataUpdate->notify(data_update);
             }
 
@@ -1154,7 +1293,7 @@ BaseCache::satisfyRequest(PacketPtr pkt, CacheBlk *blk, bool, bool)
 
         // all read responses have a data payload
         assert(pkt->hasRespData());
-        pkt->setDataFromBlock(blk->data, blkSize);
+        pkt->setDataFromBlock(blkData(blk), blkSize);
     } else if (pkt->isUpgrade()) {
         // sanity check
         assert(!pkt->hasSharers());
@@ -1726,7 +1865,7 @@ BaseCache::writebackBlk(CacheBlk *blk)
     blk->clearCoherenceBits(CacheBlk::DirtyBit);
 
     pkt->allocate();
-    pkt->setDataFromBlock(blk->data, blkSize);
+    pkt->setDataFromBlock(blkData(blk), blkSize);
 
     // When a block is compressed, it must first be decompressed before being
     // sent for writeback.
@@ -1771,7 +1910,7 @@ BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
     blk->clearCoherenceBits(CacheBlk::DirtyBit);
 
     pkt->allocate();
-    pkt->setDataFromBlock(blk->data, blkSize);
+    pkt->setDataFromBlock(blkData(blk), blkSize);
 
     // When a block is compressed, it must first be decompressed before being
     // sent for writeback.
@@ -1823,7 +1962,7 @@ BaseCache::writebackVisitor(CacheBlk &blk)
         }
 
         Packet packet(request, MemCmd::WriteReq);
-        packet.dataStatic(blk.data);
+        packet.dataStatic(blkData(&blk));
 
         memSidePort.sendFunctional(&packet);
 
@@ -2271,6 +2410,8 @@ BaseCache::CacheStats::CacheStats(BaseCache &c)
              "number of data expansions"),
     ADD_STAT(dataContractions, statistics::units::Count::get(),
              "number of data contractions"),
+    ADD_STAT(warmingHits, statistics::units::Count::get(),
+             "number of hits through a warming backdoor"),
     cmd(MemCmd::NUM_MEM_CMDS)
 {
     for (int idx = 0; idx < MemCmd::NUM_MEM_CMDS; ++idx)
@@ -2500,6 +2641,7 @@ BaseCache::CacheStats::regStats()
 
     dataExpansions.flags(nozero | nonan);
     dataContractions.flags(nozero | nonan);
+    warmingHits.flags(nozero | nonan);
 }
 
 void
@@ -2575,6 +2717,28 @@ BaseCache::CpuSidePort::recvAtomic(PacketPtr pkt)
     }
 }
 
+Tick
+BaseCache::CpuSidePort::recvAtomicBackdoor(PacketPtr pkt,
+                                           MemBackdoorPtr &backdoor)
+{
+    if (cache->system->bypassCaches()) {
+        // The cache is not in the way, so pass on any backdoor from
+        // the memory below.
+        return cache->memSidePort.sendAtomicBackdoor(pkt, backdoor);
+    }
+
+    Tick latency = cache->recvAtomic(pkt);
+
+    // Hand up the backdoor holding the data of our blocks, if any, so
+    // that hits above can be done without a packet.
+    if (cache->warmingBackdoor) {
+        auto wbd = cache->warmingBackdoors.find(pkt->getAddr());
+        if (wbd)
+            backdoor = &wbd->above;
+    }
+    return latency;
+}
+
 void
 BaseCache::CpuSidePort::recvFunctional(PacketPtr pkt)
 {
@@ -58,9 +58,11 @@
 #include "debug/Cache.hh"
 #include "debug/CachePort.hh"
 #include "enums/Clusivity.hh"
+#include "mem/backdoor.hh"
 #include "mem/cache/cache_blk.hh"
 #include "mem/cache/compressors/base.hh"
 #include "mem/cache/mshr_queue.hh"
+#include "mem/cache/warming_backdoors.hh"
 #include "mem/cache/tags/base.hh"
 #include "mem/cache/write_queue.hh"
 #include "mem/cache/write_queue_entry.hh"
@@ -324,6 +326,9 @@ class BaseCache : public ClockedObject
 
         virtual Tick recvAtomic(PacketPtr pkt) override;
 
+        virtual Tick recvAtomicBackdoor(PacketPtr pkt,
+                                        MemBackdoorPtr &backdoor) override;
+
         virtual void recvFunctional(PacketPtr pkt) override;
 
         virtual AddrRangeList getAddrRanges() const override;
@@ -401,6 +406,77 @@ class BaseCache : public ClockedObject
      */
     std::unique_ptr<Packet> pendingDelete;
 
+    /**
+     * Keep the data of the blocks in the memory below when warming in
+     * atomic mode, see the warming_backdoor parameter.
+     */
+    const bool warmingBackdoor;
+
+    /**
+     * Backdoors to the memory below currently held, each holding the
+     * data of all the valid blocks in its range, and the backdoors
+     * handed to the cache(s) and CPU(s) above in their place. The
+     * latter call warmingAccess() on every access made through them.
+     */
+    WarmingBackdoors warmingBackdoors;
+
+    /**
+     * Get the data of a block. This is normally the block's own data,
+     * unless we hold a warming backdoor covering the block, in which
+     * case the data lives in the memory below.
+     *
+     * @param blk Valid block to get the data of.
+     * @return A pointer to blkSize bytes of data.
+     */
+    uint8_t *
+    blkData(CacheBlk *blk)
+    {
+        if (warmingBackdoors.empty() || !blk->isValid())
+            return blk->data;
+        return warmingBlkData(blk);
+    }
+
+    /** Slow path of blkData(), looking up the backdoor of a block. */
+    uint8_t *warmingBlkData(CacheBlk *blk);
+
+    /**
+     * Send a request below in atomic mode, asking for a backdoor when
+     * warming.
+     *
+     * @param pkt The request to send.
+     * @return The latency of the access.
+     */
+    Tick sendAtomicBelow(PacketPtr pkt);
+
+    /**
+     * Start keeping the data of the blocks covered by a backdoor in
+     * memory. The data of all the valid blocks in its range is first
+     * copied to memory, as all valid copies of a line are up to date.
+     * A backdoor overlapping one already held is not used.
+     *
+     * @param bd The backdoor given by the memory below.
+     */
+    void addWarmingBackdoor(MemBackdoorPtr bd);
+
+    /**
+     * Stop using a backdoor, copying the data back into the blocks in
+     * its range and invalidating the backdoor handed above.
+     *
+     * @param bd The backdoor given by the memory below.
+     */
+    void removeWarmingBackdoor(const MemBackdoor &bd);
+
+    /**
+     * Update the tags for an access made through a backdoor we handed
+     * above, as if the access was a hit handled by access().
+     *
+     * @param req The request being performed.
+     * @param is_write Whether the request writes data.
+     * @return False if the access needs to be sent as a packet, i.e.
+     * it misses, needs a coherence action or isn't a plain access.
+     */
+    bool warmingAccess(const RequestPtr &req, bool is_write);
+
     /**
      * Mark a request as in service (sent downstream in the memory
      * system), effectively making this MSHR the ordering point.
@@ -1142,6 +1218,9 @@ class BaseCache : public ClockedObject
          */
         statistics::Scalar dataContractions;
 
+        /** Number of hits made through a warming backdoor. */
+        statistics::Scalar warmingHits;
+
         /** Per-command statistics */
         std::vector<std::unique_ptr<CacheCmdStats>> cmd;
     } stats;
@@ -1155,6 +1234,8 @@ class BaseCache : public ClockedObject
 
     void init() override;
 
+    void drainResume() override;
+
     Port &getPort(const std::string &if_name,
                   PortID idx=InvalidPortID) override;
 
@@ -245,14 +245,14 @@ Cache::doWritebacksAtomic(PacketList& writebacks)
                 // below. We can discard CleanEvicts because cached
                 // copies exist above. Atomic mode isCachedAbove
                 // modifies packet to set BLOCK_CACHED flag
-                memSidePort.sendAtomic(wbPkt);
+                sendAtomicBelow(wbPkt);
             }
         } else {
             // If the block is not cached above, send packet below. Both
             // CleanEvict and Writeback with BLOCK_CACHED flag cleared will
             // reset the bit corresponding to this address in the snoop filter
             // below.
-            memSidePort.sendAtomic(wbPkt);
+            sendAtomicBelow(wbPkt);
         }
         writebacks.pop_front();
         // In case of CleanEvicts, the packet destructor will delete the
@@ -599,7 +599,7 @@ Cache::handleAtomicReqMiss(PacketPtr pkt, CacheBlk *&blk,
 
     const std::string old_state = blk ? blk->print() : "";
 
-    Cycles latency = ticksToCycles(memSidePort.sendAtomic(bus_pkt));
+    Cycles latency = ticksToCycles(sendAtomicBelow(bus_pkt));
 
     bool is_invalidate = bus_pkt->isInvalidate();
 
@@ -1213,13 +1213,14 @@ Cache::handleSnoop(PacketPtr pkt, CacheBlk *blk, bool is_timing,
                  "but keeping the block", name(), pkt->print());
 
         if (is_timing) {
-            doTimingSupplyResponse(pkt, blk->data, is_deferred, pending_inval);
+            doTimingSupplyResponse(pkt, blkData(blk), is_deferred,
+                                   pending_inval);
         } else {
             pkt->makeAtomicResponse();
             // packets such as upgrades do not actually have any data
             // payload
             if (pkt->hasData())
-                pkt->setDataFromBlock(blk->data, blkSize);
+                pkt->setDataFromBlock(blkData(blk), blkSize);
         }
 
         // When a block is compressed, it must first be decompressed before
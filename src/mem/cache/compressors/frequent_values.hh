@@ -39,7 +39,7 @@
 #include "mem/cache/base.hh"
 #include "mem/cache/compressors/base.hh"
 #include "mem/cache/compressors/encoders/huffman.hh"
-#include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/tags/associative_set.hh"
 #include "sim/eventq.hh"
 #include "sim/probe/probe.hh"
 
@@ -109,7 +109,7 @@ NoncoherentCache::doWritebacksAtomic(PacketList& writebacks)
 {
     while (!writebacks.empty()) {
         PacketPtr wb_pkt = writebacks.front();
-        memSidePort.sendAtomic(wb_pkt);
+        sendAtomicBelow(wb_pkt);
         writebacks.pop_front();
         delete wb_pkt;
     }
@@ -175,7 +175,7 @@ NoncoherentCache::handleAtomicReqMiss(PacketPtr pkt, CacheBlk *&blk,
                                          pkt->isWholeLineWrite(blkSize));
     DPRINTF(Cache, "Sending an atomic %s\n", bus_pkt->print());
 
-    Cycles latency = ticksToCycles(memSidePort.sendAtomic(bus_pkt));
+    Cycles latency = ticksToCycles(sendAtomicBelow(bus_pkt));
 
     assert(bus_pkt->isResponse());
     // At the moment the only supported downstream requests we issue
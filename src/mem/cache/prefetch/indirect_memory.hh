@@ -42,8 +42,8 @@
 #include <vector>
 
 #include "base/sat_counter.hh"
-#include "mem/cache/prefetch/associative_set.hh"
 #include "mem/cache/prefetch/queued.hh"
+#include "mem/cache/tags/associative_set.hh"
 
 namespace gem5
 {
@@ -40,8 +40,8 @@
 
 #include "base/callback.hh"
 #include "base/sat_counter.hh"
-#include "mem/cache/prefetch/associative_set.hh"
 #include "mem/cache/prefetch/queued.hh"
+#include "mem/cache/tags/associative_set.hh"
 
 namespace gem5
 {
@@ -41,8 +41,8 @@
 #include <vector>
 
 #include "base/circular_queue.hh"
-#include "mem/cache/prefetch/associative_set.hh"
 #include "mem/cache/prefetch/queued.hh"
+#include "mem/cache/tags/associative_set.hh"
 
 namespace gem5
 {
@@ -32,7 +32,7 @@
 #include <climits>
 
 #include "debug/HWPrefetch.hh"
-#include "mem/cache/prefetch/associative_set_impl.hh"
+#include "mem/cache/tags/associative_set_impl.hh"
 #include "params/SignaturePathPrefetcher.hh"
 
 namespace gem5
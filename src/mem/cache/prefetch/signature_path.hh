@@ -41,8 +41,8 @@
 #define __MEM_CACHE_PREFETCH_SIGNATURE_PATH_HH__
 
 #include "base/sat_counter.hh"
-#include "mem/cache/prefetch/associative_set.hh"
 #include "mem/cache/prefetch/queued.hh"
+#include "mem/cache/tags/associative_set.hh"
 #include "mem/packet.hh"
 
 namespace gem5
@@ -41,8 +41,8 @@
 #ifndef __MEM_CACHE_PREFETCH_SIGNATURE_PATH_V2_HH__
 #define __MEM_CACHE_PREFETCH_SIGNATURE_PATH_V2_HH__
 
-#include "mem/cache/prefetch/associative_set.hh"
 #include "mem/cache/prefetch/signature_path.hh"
+#include "mem/cache/tags/associative_set.hh"
 #include "mem/packet.hh"
 
 namespace gem5
@@ -29,7 +29,7 @@
 #include "mem/cache/prefetch/spatio_temporal_memory_streaming.hh"
 
 #include "debug/HWPrefetch.hh"
-#include "mem/cache/prefetch/associative_set_impl.hh"
+#include "mem/cache/tags/associative_set_impl.hh"
 #include "params/STeMSPrefetcher.hh"
 
 namespace gem5
@@ -53,8 +53,8 @@
 #include "base/random.hh"
 #include "base/trace.hh"
 #include "debug/HWPrefetch.hh"
-#include "mem/cache/prefetch/associative_set_impl.hh"
 #include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/tags/associative_set_impl.hh"
 #include "params/StridePrefetcher.hh"
 
 namespace gem5
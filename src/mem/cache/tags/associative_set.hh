@@ -26,8 +26,8 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#ifndef __CACHE_PREFETCH_ASSOCIATIVE_SET_HH__
-#define __CACHE_PREFETCH_ASSOCIATIVE_SET_HH__
+#ifndef __CACHE_TAGS_ASSOCIATIVE_SET_HH__
+#define __CACHE_TAGS_ASSOCIATIVE_SET_HH__
 
 #include "mem/cache/replacement_policies/base.hh"
 #include "mem/cache/tags/indexing_policies/base.hh"
@@ -166,4 +166,4 @@ class AssociativeSet
 
 } // namespace gem5
 
-#endif//__CACHE_PREFETCH_ASSOCIATIVE_SET_HH__
+#endif//__CACHE_TAGS_ASSOCIATIVE_SET_HH__
@@ -26,11 +26,11 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#ifndef __CACHE_PREFETCH_ASSOCIATIVE_SET_IMPL_HH__
-#define __CACHE_PREFETCH_ASSOCIATIVE_SET_IMPL_HH__
+#ifndef __CACHE_TAGS_ASSOCIATIVE_SET_IMPL_HH__
+#define __CACHE_TAGS_ASSOCIATIVE_SET_IMPL_HH__
 
 #include "base/intmath.hh"
-#include "mem/cache/prefetch/associative_set.hh"
+#include "mem/cache/tags/associative_set.hh"
 
 namespace gem5
 {
@@ -126,4 +126,4 @@ AssociativeSet<Entry>::invalidate(Entry* entry)
 
 } // namespace gem5
 
-#endif//__CACHE_PREFETCH_ASSOCIATIVE_SET_IMPL_HH__
+#endif//__CACHE_TAGS_ASSOCIATIVE_SET_IMPL_HH__
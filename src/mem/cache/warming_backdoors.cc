@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/warming_backdoors.hh"
+
+#include <cassert>
+
+namespace gem5
+{
+
+WarmingBackdoors::Entry *
+WarmingBackdoors::add(MemBackdoorPtr below,
+                      MemBackdoor::AccessFunction access)
+{
+    const AddrRange &range = below->range();
+    auto map_it = map.insert(range, nullptr);
+    if (map_it == map.end())
+        return nullptr;
+
+    entries.emplace_back();
+    Entry *entry = &entries.back();
+    entry->below = below;
+    entry->above.range(range);
+    entry->above.ptr(below->ptr());
+    entry->above.flags(below->flags());
+    entry->above.accessCallback(access);
+    map_it->second = entry;
+
+    if (registered.insert(below).second) {
+        below->addInvalidationCallback([this](const MemBackdoor &bd) {
+            // the callbacks are cleared once called
+            registered.erase(&bd);
+            if (find(bd))
+                invalidated(bd);
+        });
+    }
+
+    return entry;
+}
+
+void
+WarmingBackdoors::remove(Entry *entry)
+{
+    auto map_it = map.contains(entry->above.range());
+    assert(map_it != map.end() && map_it->second == entry);
+    map.erase(map_it);
+
+    // Let the holders above know before the backdoor goes away
+    entry->above.invalidate();
+
+    entries.remove_if([entry](const Entry &e) { return &e == entry; });
+}
+
+WarmingBackdoors::Entry *
+WarmingBackdoors::find(const MemBackdoor &below)
+{
+    auto it = map.contains(below.range());
+    if (it == map.end() || it->second->below != &below)
+        return nullptr;
+    return it->second;
+}
+
+} // namespace gem5
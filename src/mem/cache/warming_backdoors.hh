@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Bookkeeping of the memory backdoors held by a cache warming in
+ * atomic mode.
+ */
+
+#ifndef __MEM_CACHE_WARMING_BACKDOORS_HH__
+#define __MEM_CACHE_WARMING_BACKDOORS_HH__
+
+#include <functional>
+#include <list>
+#include <unordered_set>
+
+#include "base/addr_range.hh"
+#include "base/addr_range_map.hh"
+#include "base/types.hh"
+#include "mem/backdoor.hh"
+
+namespace gem5
+{
+
+/**
+ * The warming backdoors held by a cache. Each one pairs a backdoor to
+ * the memory below, which holds the data of the blocks in its range
+ * while the cache has it, with the backdoor handed above in its place.
+ * The ranges of the backdoors held never overlap, so that the data of
+ * a block is in a single place.
+ */
+class WarmingBackdoors
+{
+  public:
+    struct Entry
+    {
+        /** The backdoor given by the memory below */
+        MemBackdoorPtr below;
+        /** The backdoor handed above, reporting the accesses made */
+        MemBackdoor above;
+    };
+
+    typedef std::function<void(const MemBackdoor &below)>
+        InvalidateFunction;
+
+    /**
+     * @param invalidated Called when the memory below invalidates a
+     *                    backdoor that is held
+     */
+    WarmingBackdoors(InvalidateFunction invalidated)
+        : invalidated(invalidated)
+    {}
+
+    /**
+     * Start holding a backdoor to the memory below.
+     *
+     * @param below The backdoor given by the memory below
+     * @param access The access callback of the backdoor handed above
+     * @return the new entry, or nullptr if the backdoor overlaps one
+     *         that is already held, in which case it is not used
+     */
+    Entry *add(MemBackdoorPtr below, MemBackdoor::AccessFunction access);
+
+    /**
+     * Stop holding a backdoor, invalidating the one handed above.
+     *
+     * @param entry An entry returned by add() or find()
+     */
+    void remove(Entry *entry);
+
+    /** Find the backdoor covering an address, if any */
+    Entry *
+    find(Addr addr)
+    {
+        auto it = map.contains(addr);
+        return it == map.end() ? nullptr : it->second;
+    }
+
+    /** Find the entry of a backdoor to the memory below, if held */
+    Entry *find(const MemBackdoor &below);
+
+    bool empty() const { return entries.empty(); }
+    size_t size() const { return entries.size(); }
+
+    /** Any of the backdoors held, to remove them all in turn */
+    Entry *front() { return &entries.front(); }
+
+  private:
+    InvalidateFunction invalidated;
+
+    /** The backdoors held, in a list for stable addresses */
+    std::list<Entry> entries;
+
+    /** The backdoors held, indexed by their address range */
+    AddrRangeMap<Entry *, 1> map;
+
+    /**
+     * The backdoors below that have our invalidation callback. It stays
+     * registered after we stop using a backdoor, as a backdoor has no
+     * way to remove a callback, and must not be registered again if
+     * we use the backdoor again.
+     */
+    std::unordered_set<const MemBackdoor *> registered;
+};
+
+} // namespace gem5
+
+#endif // __MEM_CACHE_WARMING_BACKDOORS_HH__
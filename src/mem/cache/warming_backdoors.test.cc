@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "mem/cache/warming_backdoors.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+bool
+alwaysHit(const RequestPtr &, bool)
+{
+    return true;
+}
+
+} // anonymous namespace
+
+/** Held backdoors are found by address and by the backdoor below */
+TEST(WarmingBackdoorsTest, Add)
+{
+    std::vector<uint8_t> data(0x2000);
+    MemBackdoor below(AddrRange(0x1000, 0x3000), data.data(),
+                      MemBackdoor::Readable);
+    WarmingBackdoors wbds([](const MemBackdoor &) {});
+
+    auto wbd = wbds.add(&below, alwaysHit);
+    ASSERT_NE(wbd, nullptr);
+    ASSERT_EQ(wbds.size(), 1);
+    ASSERT_EQ(wbd->below, &below);
+    ASSERT_EQ(wbd->above.range(), below.range());
+    ASSERT_EQ(wbd->above.ptr(), below.ptr());
+    ASSERT_EQ(wbd->above.flags(), below.flags());
+    ASSERT_TRUE(wbd->above.hasAccessCallback());
+
+    ASSERT_EQ(wbds.find(0x1000), wbd);
+    ASSERT_EQ(wbds.find(0x2fff), wbd);
+    ASSERT_EQ(wbds.find(0x3000), nullptr);
+    ASSERT_EQ(wbds.find(below), wbd);
+}
+
+/**
+ * A backdoor overlapping one already held is turned down, and leaves
+ * nothing behind
+ */
+TEST(WarmingBackdoorsTest, Overlap)
+{
+    std::vector<uint8_t> data(0x2000);
+    MemBackdoor below(AddrRange(0x1000, 0x3000), data.data(),
+                      MemBackdoor::Readable);
+    MemBackdoor overlap(AddrRange(0x2000, 0x4000), data.data(),
+                        MemBackdoor::Readable);
+    int invalidations = 0;
+    WarmingBackdoors wbds([&](const MemBackdoor &) { invalidations++; });
+
+    auto wbd = wbds.add(&below, alwaysHit);
+    ASSERT_NE(wbd, nullptr);
+    ASSERT_EQ(wbds.add(&overlap, alwaysHit), nullptr);
+    ASSERT_EQ(wbds.add(&below, alwaysHit), nullptr);
+    ASSERT_EQ(wbds.size(), 1);
+    ASSERT_EQ(wbds.find(overlap), nullptr);
+    ASSERT_EQ(wbds.find(0x3000), nullptr);
+
+    // The backdoor turned down is not tracked
+    overlap.invalidate();
+    ASSERT_EQ(invalidations, 0);
+    ASSERT_EQ(wbds.size(), 1);
+
+    // Removing everything terminates
+    while (!wbds.empty())
+        wbds.remove(wbds.front());
+    ASSERT_EQ(wbds.find(0x1000), nullptr);
+}
+
+/**
+ * Removing a backdoor invalidates the one handed above, and the
+ * invalidation of a backdoor below is reported once, however many
+ * times it has been held
+ */
+TEST(WarmingBackdoorsTest, Remove)
+{
+    std::vector<uint8_t> data(0x1000);
+    MemBackdoor below(AddrRange(0x1000, 0x2000), data.data(),
+                      MemBackdoor::Readable);
+    std::vector<const MemBackdoor *> invalidated;
+    WarmingBackdoors wbds([&](const MemBackdoor &bd) {
+        invalidated.push_back(&bd);
+    });
+
+    int above_invalidations = 0;
+    for (int i = 0; i < 3; i++) {
+        auto wbd = wbds.add(&below, alwaysHit);
+        ASSERT_NE(wbd, nullptr);
+        wbd->above.addInvalidationCallback([&](const MemBackdoor &) {
+            above_invalidations++;
+        });
+        wbds.remove(wbd);
+        ASSERT_TRUE(wbds.empty());
+        ASSERT_EQ(wbds.find(0x1000), nullptr);
+        ASSERT_EQ(above_invalidations, i + 1);
+    }
+
+    // Not held anymore, the invalidation is not reported
+    below.invalidate();
+    ASSERT_TRUE(invalidated.empty());
+
+    // Held again, the invalidation is reported once, and the backdoor
+    // can be used again afterwards
+    auto wbd = wbds.add(&below, alwaysHit);
+    ASSERT_NE(wbd, nullptr);
+    wbds.add(&below, alwaysHit);
+    below.invalidate();
+    ASSERT_EQ(invalidated.size(), 1);
+    ASSERT_EQ(invalidated[0], &below);
+
+    wbds.remove(wbd);
+    ASSERT_NE(wbds.add(&below, alwaysHit), nullptr);
+    below.invalidate();
+    ASSERT_EQ(invalidated.size(), 2);
+}
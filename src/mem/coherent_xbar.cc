@@ -66,7 +66,9 @@ CoherentXBar::CoherentXBar(const CoherentXBarParams &p)
       ADD_STAT(snoops, statistics::units::Count::get(), "Total snoops"),
       ADD_STAT(snoopTraffic, statistics::units::Byte::get(), "Total snoop traffic"),
       ADD_STAT(snoopFanout, statistics::units::Count::get(),
-               "Request fanout histogram")
+               "Request fanout histogram"),
+      ADD_STAT(backInvalidationWritebacks, statistics::units::Count::get(),
+               "Dirty lines written back due to snoop filter evictions")
 {
     // create the ports based on the size of the memory-side port and
     // CPU-side port vector ports, and the presence of the default port,
@@ -302,9 +304,16 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
         }
     }
 
+    // time spent back-invalidating the lines evicted from a bounded
+    // snoop filter to make room for this request
+    Tick back_inval_delay = 0;
+
     if (snoopFilter && snoop_caches) {
         // Let the snoop filter know about the success of the send operation
         snoopFilter->finishRequest(!success, addr, pkt->isSecure());
+
+        if (snoopFilter->hasEvictions())
+            back_inval_delay = backInvalidate(true);
     }
 
     // check if we were successful in sending the packet onwards
@@ -348,8 +357,10 @@ CoherentXBar::recvTimingReq(PacketPtr pkt, PortID cpu_side_port_id)
                          name(), maxRoutingTableSizeCheck);
             }
 
-            // update the layer state and schedule an idle event
-            reqLayers[mem_side_port_id]->succeededTiming(packetFinishTime);
+            // update the layer state and schedule an idle event, the
+            // layer is also kept busy by any back-invalidation
+            reqLayers[mem_side_port_id]->succeededTiming(
+                packetFinishTime + back_inval_delay);
         }
 
         // stats updates only consider packets that were successfully sent
@@ -572,6 +583,15 @@ CoherentXBar::recvTimingSnoopResp(PacketPtr pkt, PortID cpu_side_port_id)
     // determine the source port based on the id
     ResponsePort* src_port = cpuSidePorts[cpu_side_port_id];
 
+    // responses to back-invalidations end here, as the data was
+    // already written to the memory below
+    if (outstandingBackInvalidation.erase(pkt->req)) {
+        DPRINTF(CoherentXBar, "%s: src %s packet %s sunk\n", __func__,
+                src_port->name(), pkt->print());
+        delete pkt;
+        return true;
+    }
+
     // get the destination
     const auto route_lookup = routeTo.find(pkt->req);
     assert(route_lookup != routeTo.end());
@@ -745,6 +765,7 @@ CoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
 
     MemCmd snoop_response_cmd = MemCmd::InvalidCmd;
     Tick snoop_response_latency = 0;
+    Tick back_inval_latency = 0;
 
     // is this the destination point for this packet? (e.g. true if
     // this xbar is the PoC for a cache maintenance operation to the
@@ -773,6 +794,9 @@ CoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
             // between and change the filter state
             snoopFilter->finishRequest(false, pkt->getAddr(), pkt->isSecure());
 
+            if (snoopFilter->hasEvictions())
+                back_inval_latency = backInvalidate(false);
+
             if (pkt->isEviction()) {
                 // for block-evicting packets, i.e. writebacks and
                 // clean evictions, there is no need to snoop up, as
@@ -880,6 +904,10 @@ CoherentXBar::recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
         transDist[pkt_cmd]++;
     }
 
+    // the back-invalidations happened before the request was
+    // forwarded
+    response_latency += back_inval_latency;
+
     // @todo: Not setting header time
     pkt->payloadDelay = response_latency;
     return response_latency;
@@ -1076,6 +1104,79 @@ CoherentXBar::forwardFunctional(PacketPtr pkt, PortID exclude_cpu_side_port_id)
     }
 }
 
+Tick
+CoherentXBar::backInvalidate(bool is_timing)
+{
+    const unsigned blk_size = system->cacheLineSize();
+    Tick latency = 0;
+
+    for (const auto& eviction : snoopFilter->takeEvictions()) {
+        Request::Flags flags;
+        if (eviction.isSecure)
+            flags.set(Request::SECURE);
+
+        // a holder with a dirty copy would drop it when invalidated, so
+        // look for the up-to-date data first and write it to the memory
+        // below, without modelling the timing of the writeback
+        RequestPtr rd_req = std::make_shared<Request>(
+            eviction.addr, blk_size, flags, Request::wbRequestorId);
+        Packet rd_pkt(rd_req, MemCmd::ReadReq);
+        rd_pkt.allocate();
+        for (const auto& p : eviction.holders) {
+            p->sendFunctionalSnoop(&rd_pkt);
+            if (rd_pkt.isResponse())
+                break;
+        }
+
+        if (rd_pkt.isResponse()) {
+            Packet wr_pkt(rd_req, MemCmd::WriteReq);
+            wr_pkt.dataStatic(rd_pkt.getConstPtr<uint8_t>());
+            memSidePorts[findPort(wr_pkt.getAddrRange())]->
+                sendFunctional(&wr_pkt);
+            backInvalidationWritebacks++;
+        }
+
+        // the invalidation is a snoop originating at this crossbar, it
+        // goes up like the snoops of a normal request, and the caches
+        // account for their lookup in its snoop delay
+        RequestPtr req = std::make_shared<Request>(
+            eviction.addr, blk_size, flags, Request::wbRequestorId);
+        Packet pkt(req, MemCmd::InvalidateReq);
+        pkt.setExpressSnoop();
+
+        DPRINTF(CoherentXBar, "%s: packet %s to %d holders\n", __func__,
+                pkt.print(), eviction.holders.size());
+
+        Tick snoop_latency = 0;
+        if (is_timing) {
+            forwardTiming(&pkt, InvalidPortID, eviction.holders);
+            snoop_latency = pkt.snoopDelay;
+
+            // a cache with the line dirty, or in its write buffer,
+            // commits to respond
+            if (pkt.cacheResponding())
+                outstandingBackInvalidation.insert(req);
+        } else {
+            for (const auto& p : eviction.holders) {
+                snoop_latency = std::max(snoop_latency,
+                                         p->sendAtomicSnoop(&pkt));
+                // the response, if any, is not needed as the data is
+                // already in the memory below
+                if (pkt.isResponse())
+                    pkt.cmd = MemCmd::InvalidateReq;
+            }
+            snoopFanout.sample(eviction.holders.size());
+        }
+
+        // the lines are invalidated in turn
+        latency += snoop_latency;
+        snoops += eviction.holders.size();
+        transDist[pkt.cmdToIndex()] += eviction.holders.size();
+    }
+
+    return latency;
+}
+
 bool
 CoherentXBar::sinkPacket(const PacketPtr pkt) const
 {
@@ -267,6 +267,12 @@ class CoherentXBar : public BaseXBar
      */
     std::unordered_map<PacketId, PacketPtr> outstandingCMO;
 
+    /**
+     * Store the back-invalidations that a cache committed to respond
+     * to, so that their snoop responses can be sunk here.
+     */
+    std::unordered_set<RequestPtr> outstandingBackInvalidation;
+
     /**
      * Keep a pointer to the system to be allow to querying memory system
      * properties.
@@ -388,6 +394,16 @@ class CoherentXBar : public BaseXBar
      */
     void forwardFunctional(PacketPtr pkt, PortID exclude_cpu_side_port_id);
 
+    /**
+     * Invalidate the lines evicted by a bounded snoop filter in the
+     * caches above that hold them. Dirty data is first written to the
+     * memory below functionally, so the invalidations can drop it.
+     *
+     * @param is_timing Whether to send timing or atomic snoops
+     * @return the time taken by the invalidation snoops
+     */
+    Tick backInvalidate(bool is_timing);
+
     /**
      * Determine if the crossbar should sink the packet, as opposed to
      * forwarding it, or responding.
@@ -421,6 +437,7 @@ class CoherentXBar : public BaseXBar
     statistics::Scalar snoops;
     statistics::Scalar snoopTraffic;
     statistics::Distribution snoopFanout;
+    statistics::Scalar backInvalidationWritebacks;
 
   public:
 
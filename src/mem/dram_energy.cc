@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/dram_energy.hh"
+
+#include <algorithm>
+
+namespace gem5
+{
+
+namespace memory
+{
+
+DRAMEnergy::DRAMEnergy(const Spec &_spec)
+    : spec(_spec), srefRefPending(0), refActPending(0)
+{
+    reset();
+}
+
+double
+DRAMEnergy::tivEnergy(double cycles, double current, double current2) const
+{
+    // mA x V x ns gives pJ, the second voltage domain is only present
+    // for LPDDR and WideIO devices, where VDD2 is non-zero
+    return cycles * spec.clkPeriod *
+        (current * spec.vdd + current2 * spec.vdd2);
+}
+
+void
+DRAMEnergy::command(Command cmd)
+{
+    ++commands[cmd];
+
+    if (cmd == REF) {
+        refActPending = spec.tRFC - spec.tRP;
+    } else if (cmd == SREN) {
+        // a self-refresh starts with a refresh of the whole device
+        srefRefPending = spec.tRFC;
+    }
+}
+
+void
+DRAMEnergy::residency(State state, double cycles)
+{
+    switch (state) {
+      case PRE_STDBY:
+        preCycles += cycles;
+        break;
+      case ACT_STDBY:
+        actCycles += cycles;
+        break;
+      case REFRESH: {
+        // the banks are active until the final tRP of the refresh
+        double act_cycles = std::min(cycles, refActPending);
+        refActPending -= act_cycles;
+        actCycles += act_cycles;
+        preCycles += cycles - act_cycles;
+        break;
+      }
+      case PRE_PDN:
+        prePdnCycles += cycles;
+        break;
+      case ACT_PDN:
+        actPdnCycles += cycles;
+        break;
+      case SELF_REFRESH: {
+        double ref_cycles = std::min(cycles, srefRefPending);
+        srefRefPending -= ref_cycles;
+        srefRefCycles += ref_cycles;
+        srefCycles += cycles - ref_cycles;
+        break;
+      }
+      default:
+        break;
+    }
+}
+
+DRAMEnergy::Energy
+DRAMEnergy::energy() const
+{
+    const Spec &s = spec;
+    Energy e;
+
+    e.act = tivEnergy(commands[ACT] * s.tRAS,
+                      s.idd0 - s.idd3n, s.idd02 - s.idd3n2);
+    e.pre = tivEnergy(commands[PRE] * (s.tRC - s.tRAS),
+                      s.idd0 - s.idd2n, s.idd02 - s.idd2n2);
+    e.read = tivEnergy(commands[RD] * s.burstCycles,
+                       s.idd4r - s.idd3n, s.idd4r2 - s.idd3n2);
+    e.write = tivEnergy(commands[WR] * s.burstCycles,
+                        s.idd4w - s.idd3n, s.idd4w2 - s.idd3n2);
+    e.refresh = tivEnergy(commands[REF] * s.tRFC,
+                          s.idd5 - s.idd3n, s.idd52 - s.idd3n2);
+
+    e.actBack = tivEnergy(actCycles, s.idd3n, s.idd3n2);
+    e.preBack = tivEnergy(preCycles, s.idd2n, s.idd2n2);
+    // gem5 only uses the fast-exit power-down modes
+    e.actPowerDown = tivEnergy(actPdnCycles, s.idd3p1, s.idd3p12);
+    e.prePowerDown = tivEnergy(prePdnCycles, s.idd2p1, s.idd2p12);
+
+    // the refresh on self-refresh entry is charged as an auto-refresh on
+    // top of the self-refresh current, with a precharged power-down
+    // background for its duration
+    e.selfRefresh = tivEnergy(srefCycles, s.idd6, s.idd62) +
+        tivEnergy(srefRefCycles, s.idd5 - s.idd3n, s.idd52 - s.idd3n2);
+    double sref_ref_back = tivEnergy(srefRefCycles, s.idd2p0, s.idd2p02);
+
+    e.total = e.act + e.pre + e.read + e.write + e.refresh +
+        e.actBack + e.preBack + e.actPowerDown + e.prePowerDown +
+        e.selfRefresh + sref_ref_back;
+
+    return e;
+}
+
+void
+DRAMEnergy::reset()
+{
+    commands.fill(0);
+    actCycles = 0;
+    preCycles = 0;
+    actPdnCycles = 0;
+    prePdnCycles = 0;
+    srefCycles = 0;
+    srefRefCycles = 0;
+    // pending cycles belong to an ongoing refresh and carry over
+}
+
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * DRAMEnergy declaration
+ */
+
+#ifndef __MEM_DRAM_ENERGY_HH__
+#define __MEM_DRAM_ENERGY_HH__
+
+#include <array>
+#include <cstdint>
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * Closed-form, counter based DRAM energy model. Instead of replaying a
+ * timestamped command trace like DRAMPower, the rank state machine
+ * reports the commands it issues and the time it spends in each power
+ * state, and the energy of a window is computed from those counters
+ * using the same IDD based equations as DRAMPower. The per-window cost is
+ * constant and no command history is kept, at the expense of the
+ * cycle-level corner cases (e.g. power-up cycles) DRAMPower tracks.
+ */
+class DRAMEnergy
+{
+  public:
+    /**
+     * Device currents (mA), voltages (V) and timings (clock cycles)
+     * needed by the model, following the DRAMPower memSpec conventions.
+     */
+    struct Spec
+    {
+        double idd0 = 0, idd02 = 0;
+        double idd2p0 = 0, idd2p02 = 0;
+        double idd2p1 = 0, idd2p12 = 0;
+        double idd2n = 0, idd2n2 = 0;
+        double idd3p0 = 0, idd3p02 = 0;
+        double idd3p1 = 0, idd3p12 = 0;
+        double idd3n = 0, idd3n2 = 0;
+        double idd4r = 0, idd4r2 = 0;
+        double idd4w = 0, idd4w2 = 0;
+        double idd5 = 0, idd52 = 0;
+        double idd6 = 0, idd62 = 0;
+        double vdd = 0, vdd2 = 0;
+
+        /** Clock period in ns */
+        double clkPeriod = 0;
+
+        uint64_t tRAS = 0;
+        uint64_t tRC = 0;
+        uint64_t tRP = 0;
+        uint64_t tRFC = 0;
+
+        /** Clock cycles needed to transfer one burst */
+        uint64_t burstCycles = 0;
+    };
+
+    /** Commands that carry an energy cost of their own */
+    enum Command
+    {
+        ACT = 0,
+        PRE,
+        RD,
+        WR,
+        REF,
+        SREN,
+        NUM_COMMANDS
+    };
+
+    /** Background states a rank can be in */
+    enum State
+    {
+        PRE_STDBY = 0,
+        ACT_STDBY,
+        REFRESH,
+        PRE_PDN,
+        ACT_PDN,
+        SELF_REFRESH,
+        NUM_STATES
+    };
+
+    /**
+     * Energy of the current window in pJ, broken down like the
+     * DRAMInterface rank stats.
+     */
+    struct Energy
+    {
+        double act = 0;
+        double pre = 0;
+        double read = 0;
+        double write = 0;
+        double refresh = 0;
+        double actBack = 0;
+        double preBack = 0;
+        double actPowerDown = 0;
+        double prePowerDown = 0;
+        double selfRefresh = 0;
+        double total = 0;
+    };
+
+  private:
+    const Spec spec;
+
+    /** Commands issued in the current window */
+    std::array<uint64_t, NUM_COMMANDS> commands;
+
+    /** Background cycles accumulated in the current window */
+    double actCycles;
+    double preCycles;
+    double actPdnCycles;
+    double prePdnCycles;
+    double srefCycles;
+
+    /**
+     * Background cycles of a self-refresh spent on the refresh performed
+     * on entry, and cycles still to be attributed to it.
+     */
+    double srefRefCycles;
+    double srefRefPending;
+
+    /**
+     * Cycles of the ongoing auto-refresh during which the banks are
+     * still active, as DRAMPower only considers the last tRP precharged.
+     */
+    double refActPending;
+
+    /**
+     * Energy over a number of cycles at a given current in both voltage
+     * domains.
+     */
+    double tivEnergy(double cycles, double current, double current2) const;
+
+  public:
+    DRAMEnergy(const Spec &_spec);
+
+    /**
+     * Record the issue of a command.
+     *
+     * @param cmd The command issued
+     */
+    void command(Command cmd);
+
+    /**
+     * Record the time spent in a background state.
+     *
+     * @param state The state the rank was in
+     * @param cycles Residency in clock cycles
+     */
+    void residency(State state, double cycles);
+
+    /**
+     * Compute the energy of the window since the last reset.
+     */
+    Energy energy() const;
+
+    /**
+     * Start a new window, clearing all the counters.
+     */
+    void reset();
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif //__MEM_DRAM_ENERGY_HH__
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "libdrampower/LibDRAMPower.h"
+#include "mem/dram_energy.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+namespace
+{
+
+/**
+ * Drive the counter based model and DRAMPower with the same command
+ * stream, reporting background residency the way the rank power state
+ * machine does.
+ */
+class EnergyHarness
+{
+  public:
+    DRAMEnergy::Spec spec;
+    Data::MemorySpecification memSpec;
+
+    DRAMEnergy model;
+    libDRAMPower powerlib;
+
+    DRAMEnergy::State state;
+    int64_t stateCycle;
+
+    static DRAMEnergy::Spec
+    ddr3Spec()
+    {
+        // DDR3-1600 x8, as in DDR3_1600_8x8
+        DRAMEnergy::Spec s;
+        s.idd0 = 55;
+        s.idd2n = 32;
+        s.idd3n = 38;
+        s.idd4w = 125;
+        s.idd4r = 157;
+        s.idd5 = 235;
+        s.idd3p1 = 38;
+        s.idd2p1 = 32;
+        s.idd2p0 = 15;
+        s.idd6 = 20;
+        s.vdd = 1.5;
+        s.clkPeriod = 1.25;
+        s.tRAS = 28;
+        s.tRC = 39;
+        s.tRP = 11;
+        s.tRFC = 208;
+        s.burstCycles = 4;
+        return s;
+    }
+
+    static Data::MemorySpecification
+    toMemSpec(const DRAMEnergy::Spec &s)
+    {
+        Data::MemorySpecification m;
+        m.memArchSpec.burstLength = 8;
+        m.memArchSpec.nbrOfBanks = 8;
+        m.memArchSpec.nbrOfRanks = 1;
+        m.memArchSpec.dataRate = 2;
+        m.memArchSpec.nbrOfColumns = 0;
+        m.memArchSpec.nbrOfRows = 0;
+        m.memArchSpec.width = 8;
+        m.memArchSpec.nbrOfBankGroups = 0;
+        m.memArchSpec.dll = true;
+        m.memArchSpec.twoVoltageDomains = false;
+        m.memArchSpec.termination = false;
+
+        m.memTimingSpec.RC = s.tRC;
+        m.memTimingSpec.RCD = 11;
+        m.memTimingSpec.RL = 11;
+        m.memTimingSpec.RP = s.tRP;
+        m.memTimingSpec.RFC = s.tRFC;
+        m.memTimingSpec.RAS = s.tRAS;
+        m.memTimingSpec.WL = 10;
+        m.memTimingSpec.DQSCK = 0;
+        m.memTimingSpec.RTP = 6;
+        m.memTimingSpec.WR = 12;
+        m.memTimingSpec.XP = 5;
+        m.memTimingSpec.XPDLL = 5;
+        m.memTimingSpec.XS = 216;
+        m.memTimingSpec.XSDLL = 216;
+        m.memTimingSpec.clkPeriod = s.clkPeriod;
+        m.memTimingSpec.clkMhz = 1000 / s.clkPeriod;
+
+        m.memPowerSpec.idd0 = s.idd0;
+        m.memPowerSpec.idd02 = 0;
+        m.memPowerSpec.idd2p0 = s.idd2p0;
+        m.memPowerSpec.idd2p02 = 0;
+        m.memPowerSpec.idd2p1 = s.idd2p1;
+        m.memPowerSpec.idd2p12 = 0;
+        m.memPowerSpec.idd2n = s.idd2n;
+        m.memPowerSpec.idd2n2 = 0;
+        m.memPowerSpec.idd3p0 = s.idd3p0;
+        m.memPowerSpec.idd3p02 = 0;
+        m.memPowerSpec.idd3p1 = s.idd3p1;
+        m.memPowerSpec.idd3p12 = 0;
+        m.memPowerSpec.idd3n = s.idd3n;
+        m.memPowerSpec.idd3n2 = 0;
+        m.memPowerSpec.idd4r = s.idd4r;
+        m.memPowerSpec.idd4r2 = 0;
+        m.memPowerSpec.idd4w = s.idd4w;
+        m.memPowerSpec.idd4w2 = 0;
+        m.memPowerSpec.idd5 = s.idd5;
+        m.memPowerSpec.idd52 = 0;
+        m.memPowerSpec.idd6 = s.idd6;
+        m.memPowerSpec.idd62 = 0;
+        m.memPowerSpec.vdd = s.vdd;
+        m.memPowerSpec.vdd2 = 0;
+        return m;
+    }
+
+    EnergyHarness()
+        : spec(ddr3Spec()), memSpec(toMemSpec(spec)), model(spec),
+          powerlib(memSpec, false), state(DRAMEnergy::PRE_STDBY),
+          stateCycle(0)
+    {}
+
+    /** Issue a command to both models */
+    void
+    cmd(int64_t cycle, Data::MemCommand::cmds type,
+        DRAMEnergy::Command counter_cmd, int bank = 0)
+    {
+        powerlib.doCommand(type, bank, cycle);
+        if (counter_cmd != DRAMEnergy::NUM_COMMANDS)
+            model.command(counter_cmd);
+    }
+
+    /** Move the counter based model to a new background state */
+    void
+    transition(int64_t cycle, DRAMEnergy::State next)
+    {
+        model.residency(state, cycle - stateCycle);
+        state = next;
+        stateCycle = cycle;
+    }
+
+    /** Close the window in both models at a given cycle */
+    std::pair<DRAMEnergy::Energy, Data::MemoryPowerModel::Energy>
+    window(int64_t cycle)
+    {
+        transition(cycle, state);
+        powerlib.calcWindowEnergy(cycle);
+        auto e = model.energy();
+        model.reset();
+        return std::make_pair(e, powerlib.getEnergy());
+    }
+};
+
+bool
+within(double value, double reference, double tolerance)
+{
+    return std::fabs(value - reference) <= tolerance * reference;
+}
+
+} // anonymous namespace
+
+/** Command energies only depend on command counts and match exactly */
+TEST(DRAMEnergyTest, CommandEnergy)
+{
+    using namespace Data;
+    EnergyHarness h;
+
+    h.cmd(0, MemCommand::ACT, DRAMEnergy::ACT, 0);
+    h.transition(0, DRAMEnergy::ACT_STDBY);
+    h.cmd(2, MemCommand::ACT, DRAMEnergy::ACT, 1);
+    h.cmd(13, MemCommand::RD, DRAMEnergy::RD, 0);
+    h.cmd(17, MemCommand::RD, DRAMEnergy::RD, 0);
+    h.cmd(21, MemCommand::RD, DRAMEnergy::RD, 1);
+    h.cmd(40, MemCommand::WR, DRAMEnergy::WR, 1);
+    h.cmd(60, MemCommand::PRE, DRAMEnergy::PRE, 0);
+    h.cmd(62, MemCommand::PRE, DRAMEnergy::PRE, 1);
+    h.transition(62, DRAMEnergy::PRE_STDBY);
+    h.cmd(100, MemCommand::REF, DRAMEnergy::REF);
+    h.transition(100, DRAMEnergy::REFRESH);
+    h.transition(308, DRAMEnergy::PRE_STDBY);
+
+    auto [counters, reference] = h.window(400);
+
+    EXPECT_DOUBLE_EQ(counters.act, reference.act_energy);
+    EXPECT_DOUBLE_EQ(counters.pre, reference.pre_energy);
+    EXPECT_DOUBLE_EQ(counters.read, reference.read_energy);
+    EXPECT_DOUBLE_EQ(counters.write, reference.write_energy);
+    EXPECT_DOUBLE_EQ(counters.refresh, reference.ref_energy);
+}
+
+/**
+ * Background energy follows the power state residency. Like DRAMPower,
+ * the rank charges the tRP following the last precharge as precharged
+ * standby.
+ */
+TEST(DRAMEnergyTest, WindowEnergy)
+{
+    using namespace Data;
+    EnergyHarness h;
+    int64_t t = 0;
+
+    for (int i = 0; i < 20; i++) {
+        h.cmd(t, MemCommand::ACT, DRAMEnergy::ACT, i % 8);
+        h.transition(t, DRAMEnergy::ACT_STDBY);
+        for (int b = 0; b < 8; b++)
+            h.cmd(t + 11 + 4 * b, i % 2 ? MemCommand::WR : MemCommand::RD,
+                  i % 2 ? DRAMEnergy::WR : DRAMEnergy::RD, i % 8);
+        h.cmd(t + 60, MemCommand::PRE, DRAMEnergy::PRE, i % 8);
+        h.transition(t + 60, DRAMEnergy::PRE_STDBY);
+        t += 200;
+    }
+
+    // fast-exit precharge power-down
+    h.cmd(t, MemCommand::PDN_F_PRE, DRAMEnergy::NUM_COMMANDS);
+    h.transition(t, DRAMEnergy::PRE_PDN);
+    t += 2000;
+    h.cmd(t, MemCommand::PUP_PRE, DRAMEnergy::NUM_COMMANDS);
+    h.transition(t, DRAMEnergy::PRE_STDBY);
+    t += 100;
+
+    // refresh
+    h.cmd(t, MemCommand::REF, DRAMEnergy::REF);
+    h.transition(t, DRAMEnergy::REFRESH);
+    t += h.spec.tRFC;
+    h.transition(t, DRAMEnergy::PRE_STDBY);
+    t += 100;
+
+    // fast-exit active power-down
+    h.cmd(t, MemCommand::ACT, DRAMEnergy::ACT, 3);
+    h.transition(t, DRAMEnergy::ACT_STDBY);
+    t += 50;
+    h.cmd(t, MemCommand::PDN_F_ACT, DRAMEnergy::NUM_COMMANDS);
+    h.transition(t, DRAMEnergy::ACT_PDN);
+    t += 1000;
+    h.cmd(t, MemCommand::PUP_ACT, DRAMEnergy::NUM_COMMANDS);
+    h.transition(t, DRAMEnergy::ACT_STDBY);
+    t += 20;
+    h.cmd(t, MemCommand::PRE, DRAMEnergy::PRE, 3);
+    h.transition(t, DRAMEnergy::PRE_STDBY);
+    t += 100;
+
+    auto [counters, reference] = h.window(t);
+
+    EXPECT_TRUE(within(counters.actBack, reference.act_stdby_energy, 0.01));
+    EXPECT_TRUE(within(counters.preBack, reference.pre_stdby_energy, 0.01));
+    EXPECT_DOUBLE_EQ(counters.actPowerDown, reference.f_act_pd_energy);
+    EXPECT_DOUBLE_EQ(counters.prePowerDown, reference.f_pre_pd_energy);
+    EXPECT_TRUE(within(counters.total, reference.window_energy, 0.02));
+}
+
+/** Self-refresh includes the refresh performed on entry */
+TEST(DRAMEnergyTest, SelfRefresh)
+{
+    using namespace Data;
+    EnergyHarness h;
+
+    h.cmd(100, MemCommand::SREN, DRAMEnergy::SREN);
+    h.transition(100, DRAMEnergy::SELF_REFRESH);
+    h.cmd(10100, MemCommand::SREX, DRAMEnergy::NUM_COMMANDS);
+    h.transition(10100, DRAMEnergy::PRE_STDBY);
+
+    auto [counters, reference] = h.window(10200);
+
+    EXPECT_TRUE(within(counters.selfRefresh, reference.sref_energy, 0.01));
+    EXPECT_TRUE(within(counters.total, reference.window_energy, 0.02));
+}
+
+/** Counters are cleared between windows */
+TEST(DRAMEnergyTest, Reset)
+{
+    DRAMEnergy model(EnergyHarness::ddr3Spec());
+
+    model.command(DRAMEnergy::ACT);
+    model.residency(DRAMEnergy::ACT_STDBY, 100);
+    EXPECT_GT(model.energy().total, 0);
+
+    model.reset();
+    EXPECT_EQ(model.energy().total, 0);
+}
@@ -204,8 +204,7 @@ DRAMInterface::activateBank(Rank& rank_ref, Bank& bank_ref,
             "%d active\n", bank_ref.bank, rank_ref.rank, act_at,
             ranks[rank_ref.rank]->numBanksActive);
 
-    rank_ref.cmdList.push_back(Command(MemCommand::ACT, bank_ref.bank,
-                               act_at));
+    rank_ref.recordCommand(MemCommand::ACT, bank_ref.bank, act_at);
 
     DPRINTF(DRAMPower, "%llu,ACT,%d,%d\n", divCeil(act_at, tCK) -
             timeStampOffset, bank_ref.bank, rank_ref.rank);
@@ -322,10 +321,13 @@ DRAMInterface::prechargeBank(Rank& rank_ref, Bank& bank, Tick pre_tick,
 
     if (trace) {
 
-        rank_ref.cmdList.push_back(Command(MemCommand::PRE, bank.bank,
-                                   pre_at));
+        rank_ref.recordCommand(MemCommand::PRE, bank.bank, pre_at);
         DPRINTF(DRAMPower, "%llu,PRE,%d,%d\n", divCeil(pre_at, tCK) -
                 timeStampOffset, bank.bank, rank_ref.rank);
+    } else if (energyModel == enums::counters) {
+        // a precharge all is accounted for as one precharge per open
+        // bank, as done by DRAMPower
+        rank_ref.dramEnergy.command(DRAMEnergy::PRE);
     }
 
     // if we look at the current number of active banks we might be
@@ -555,7 +557,7 @@ DRAMInterface::doBurstAccess(MemPacket* mem_pkt, Tick next_burst_at,
     MemCommand::cmds command = (mem_cmd == "RD") ? MemCommand::RD :
                                                    MemCommand::WR;
 
-    rank_ref.cmdList.push_back(Command(command, mem_pkt->bank, cmd_at));
+    rank_ref.recordCommand(command, mem_pkt->bank, cmd_at);
 
     DPRINTF(DRAMPower, "%llu,%s,%d,%d\n", divCeil(cmd_at, tCK) -
             timeStampOffset, mem_cmd, mem_pkt->bank, mem_pkt->rank);
@@ -657,6 +659,7 @@ DRAMInterface::DRAMInterface(const DRAMInterfaceParams &_p)
       maxAccessesPerRow(_p.max_accesses_per_row),
       timeStampOffset(0), activeRank(0),
       enableDRAMPowerdown(_p.enable_dram_powerdown),
+      energyModel(_p.energy_model),
       lastStatsResetTick(0),
       stats(*this)
 {
@@ -1114,14 +1117,56 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
     return std::make_pair(bank_mask, hidden_bank_prep);
 }
 
+DRAMEnergy::Spec
+DRAMInterface::getEnergySpec(const DRAMInterfaceParams &p)
+{
+    // Use the same conventions as DRAMPower, with currents in mA and
+    // timings in clock cycles
+    DRAMEnergy::Spec spec;
+    spec.idd0 = p.IDD0 * 1000;
+    spec.idd02 = p.IDD02 * 1000;
+    spec.idd2p0 = p.IDD2P0 * 1000;
+    spec.idd2p02 = p.IDD2P02 * 1000;
+    spec.idd2p1 = p.IDD2P1 * 1000;
+    spec.idd2p12 = p.IDD2P12 * 1000;
+    spec.idd2n = p.IDD2N * 1000;
+    spec.idd2n2 = p.IDD2N2 * 1000;
+    spec.idd3p0 = p.IDD3P0 * 1000;
+    spec.idd3p02 = p.IDD3P02 * 1000;
+    spec.idd3p1 = p.IDD3P1 * 1000;
+    spec.idd3p12 = p.IDD3P12 * 1000;
+    spec.idd3n = p.IDD3N * 1000;
+    spec.idd3n2 = p.IDD3N2 * 1000;
+    spec.idd4r = p.IDD4R * 1000;
+    spec.idd4r2 = p.IDD4R2 * 1000;
+    spec.idd4w = p.IDD4W * 1000;
+    spec.idd4w2 = p.IDD4W2 * 1000;
+    spec.idd5 = p.IDD5 * 1000;
+    spec.idd52 = p.IDD52 * 1000;
+    spec.idd6 = p.IDD6 * 1000;
+    spec.idd62 = p.IDD62 * 1000;
+    spec.vdd = p.VDD;
+    spec.vdd2 = p.VDD2;
+
+    spec.clkPeriod = p.tCK / (double)(sim_clock::as_int::ns);
+    spec.tRAS = divCeil(p.tRAS, p.tCK);
+    spec.tRC = divCeil(p.tRAS + p.tRP, p.tCK);
+    spec.tRP = divCeil(p.tRP, p.tCK);
+    spec.tRFC = divCeil(p.tRFC, p.tCK);
+    spec.burstCycles = p.burst_length / p.beats_per_clock;
+    return spec;
+}
+
 DRAMInterface::Rank::Rank(const DRAMInterfaceParams &_p,
                          int _rank, DRAMInterface& _dram)
     : EventManager(&_dram), dram(_dram),
       pwrStateTrans(PWR_IDLE), pwrStatePostRefresh(PWR_IDLE),
-      pwrStateTick(0), refreshDueAt(0), pwrState(PWR_IDLE),
+      pwrStateTick(0), refreshDueAt(0), energyTick(0), pwrState(PWR_IDLE),
       refreshState(REF_IDLE), inLowPowerState(false), rank(_rank),
       readEntries(0), writeEntries(0), outstandingEvents(0),
-      wakeUpAllowedAt(0), power(_p, false), banks(_p.banks_per_rank),
+      wakeUpAllowedAt(0), power(_p, false),
+      dramEnergy(DRAMInterface::getEnergySpec(_p)),
+      banks(_p.banks_per_rank),
       numBanksActive(0), actTicks(_p.activation_limit, 0), lastBurstTick(0),
       writeDoneEvent([this]{ processWriteDoneEvent(); }, name()),
       activateEvent([this]{ processActivateEvent(); }, name()),
@@ -1158,6 +1203,7 @@ DRAMInterface::Rank::startup(Tick ref_tick)
     assert(ref_tick > curTick());
 
     pwrStateTick = curTick();
+    energyTick = curTick();
 
     // kick off the refresh, and give ourselves enough time to
     // precharge
@@ -1230,6 +1276,81 @@ DRAMInterface::Rank::flushCmdList()
     cmdList.assign(next_iter, cmdList.end());
 }
 
+void
+DRAMInterface::Rank::recordCommand(MemCommand::cmds type, uint8_t bank,
+                                   Tick cmd_at)
+{
+    if (dram.energyModel == enums::drampower) {
+        cmdList.push_back(Command(type, bank, cmd_at));
+        return;
+    }
+
+    // only the commands with an energy cost of their own are counted,
+    // power-down entry and exit are covered by the state residency
+    switch (type) {
+      case MemCommand::ACT:
+        dramEnergy.command(DRAMEnergy::ACT);
+        break;
+      case MemCommand::PRE:
+        dramEnergy.command(DRAMEnergy::PRE);
+        break;
+      case MemCommand::RD:
+        dramEnergy.command(DRAMEnergy::RD);
+        break;
+      case MemCommand::WR:
+        dramEnergy.command(DRAMEnergy::WR);
+        break;
+      case MemCommand::REF:
+        dramEnergy.command(DRAMEnergy::REF);
+        break;
+      case MemCommand::SREN:
+        dramEnergy.command(DRAMEnergy::SREN);
+        break;
+      default:
+        break;
+    }
+}
+
+void
+DRAMInterface::Rank::updateEnergyResidency(PowerState pwr_state,
+                                           PowerState next_state)
+{
+    assert(curTick() >= energyTick);
+    double cycles = (curTick() - energyTick) / (double)dram.tCK;
+    energyTick = curTick();
+
+    switch (pwr_state) {
+      case PWR_IDLE:
+        dramEnergy.residency(DRAMEnergy::PRE_STDBY, cycles);
+        break;
+      case PWR_REF:
+        dramEnergy.residency(DRAMEnergy::REFRESH, cycles);
+        break;
+      case PWR_SREF:
+        dramEnergy.residency(DRAMEnergy::SELF_REFRESH, cycles);
+        break;
+      case PWR_PRE_PDN:
+        dramEnergy.residency(DRAMEnergy::PRE_PDN, cycles);
+        break;
+      case PWR_ACT:
+        if (next_state == PWR_IDLE) {
+            // the rank only becomes idle tRP after the last precharge,
+            // which DRAMPower accounts for as precharged standby
+            double pre_cycles = std::min(cycles, dram.tRP /
+                                         (double)dram.tCK);
+            dramEnergy.residency(DRAMEnergy::ACT_STDBY,
+                                 cycles - pre_cycles);
+            dramEnergy.residency(DRAMEnergy::PRE_STDBY, pre_cycles);
+        } else {
+            dramEnergy.residency(DRAMEnergy::ACT_STDBY, cycles);
+        }
+        break;
+      case PWR_ACT_PDN:
+        dramEnergy.residency(DRAMEnergy::ACT_PDN, cycles);
+        break;
+    }
+}
+
 void
 DRAMInterface::Rank::processActivateEvent()
 {
@@ -1363,7 +1484,7 @@ DRAMInterface::Rank::processRefreshEvent()
             }
 
             // precharge all banks in rank
-            cmdList.push_back(Command(MemCommand::PREA, 0, pre_at));
+            recordCommand(MemCommand::PREA, 0, pre_at);
 
             DPRINTF(DRAMPower, "%llu,PREA,0,%d\n",
                     divCeil(pre_at, dram.tCK) -
@@ -1410,7 +1531,7 @@ DRAMInterface::Rank::processRefreshEvent()
         }
 
         // at the moment this affects all ranks
-        cmdList.push_back(Command(MemCommand::REF, 0, curTick()));
+        recordCommand(MemCommand::REF, 0, curTick());
 
         // Update the stats
         updatePowerStats();
@@ -1517,7 +1638,7 @@ DRAMInterface::Rank::powerDownSleep(PowerState pwr_state, Tick tick)
     if (pwr_state == PWR_ACT_PDN) {
         schedulePowerEvent(pwr_state, tick);
         // push command to DRAMPower
-        cmdList.push_back(Command(MemCommand::PDN_F_ACT, 0, tick));
+        recordCommand(MemCommand::PDN_F_ACT, 0, tick);
         DPRINTF(DRAMPower, "%llu,PDN_F_ACT,0,%d\n", divCeil(tick,
                 dram.tCK) - dram.timeStampOffset, rank);
     } else if (pwr_state == PWR_PRE_PDN) {
@@ -1526,7 +1647,7 @@ DRAMInterface::Rank::powerDownSleep(PowerState pwr_state, Tick tick)
         // This is neglected here.
         schedulePowerEvent(pwr_state, tick);
         //push Command to DRAMPower
-        cmdList.push_back(Command(MemCommand::PDN_F_PRE, 0, tick));
+        recordCommand(MemCommand::PDN_F_PRE, 0, tick);
         DPRINTF(DRAMPower, "%llu,PDN_F_PRE,0,%d\n", divCeil(tick,
                 dram.tCK) - dram.timeStampOffset, rank);
     } else if (pwr_state == PWR_REF) {
@@ -1536,7 +1657,7 @@ DRAMInterface::Rank::powerDownSleep(PowerState pwr_state, Tick tick)
         // this is not considered.
         schedulePowerEvent(PWR_PRE_PDN, tick);
         //push Command to DRAMPower
-        cmdList.push_back(Command(MemCommand::PDN_F_PRE, 0, tick));
+        recordCommand(MemCommand::PDN_F_PRE, 0, tick);
         DPRINTF(DRAMPower, "%llu,PDN_F_PRE,0,%d\n", divCeil(tick,
                 dram.tCK) - dram.timeStampOffset, rank);
     } else if (pwr_state == PWR_SREF) {
@@ -1546,7 +1667,7 @@ DRAMInterface::Rank::powerDownSleep(PowerState pwr_state, Tick tick)
         // this is not considered.
         schedulePowerEvent(PWR_SREF, tick);
         // push Command to DRAMPower
-        cmdList.push_back(Command(MemCommand::SREN, 0, tick));
+        recordCommand(MemCommand::SREN, 0, tick);
         DPRINTF(DRAMPower, "%llu,SREN,0,%d\n", divCeil(tick,
                 dram.tCK) - dram.timeStampOffset, rank);
     }
@@ -1596,16 +1717,16 @@ DRAMInterface::Rank::scheduleWakeUpEvent(Tick exit_delay)
     // use pwrStateTrans for cases where we have a power event scheduled
     // to enter low power that has not yet been processed
     if (pwrStateTrans == PWR_ACT_PDN) {
-        cmdList.push_back(Command(MemCommand::PUP_ACT, 0, wake_up_tick));
+        recordCommand(MemCommand::PUP_ACT, 0, wake_up_tick);
         DPRINTF(DRAMPower, "%llu,PUP_ACT,0,%d\n", divCeil(wake_up_tick,
                 dram.tCK) - dram.timeStampOffset, rank);
 
     } else if (pwrStateTrans == PWR_PRE_PDN) {
-        cmdList.push_back(Command(MemCommand::PUP_PRE, 0, wake_up_tick));
+        recordCommand(MemCommand::PUP_PRE, 0, wake_up_tick);
         DPRINTF(DRAMPower, "%llu,PUP_PRE,0,%d\n", divCeil(wake_up_tick,
                 dram.tCK) - dram.timeStampOffset, rank);
     } else if (pwrStateTrans == PWR_SREF) {
-        cmdList.push_back(Command(MemCommand::SREX, 0, wake_up_tick));
+        recordCommand(MemCommand::SREX, 0, wake_up_tick);
         DPRINTF(DRAMPower, "%llu,SREX,0,%d\n", divCeil(wake_up_tick,
                 dram.tCK) - dram.timeStampOffset, rank);
     }
@@ -1639,6 +1760,8 @@ DRAMInterface::Rank::processPowerEvent()
 
     // update the accounting
     stats.pwrStateTime[prev_state] += duration;
+    if (dram.energyModel == enums::counters)
+        updateEnergyResidency(prev_state, pwrStateTrans);
 
     // track to total idle time
     if ((prev_state == PWR_PRE_PDN) || (prev_state == PWR_ACT_PDN) ||
@@ -1764,6 +1887,44 @@ DRAMInterface::Rank::processPowerEvent()
 
 void
 DRAMInterface::Rank::updatePowerStats()
+{
+    if (dram.energyModel == enums::counters) {
+        // account for the time in the current state, and compute the
+        // window energy directly from the counters
+        updateEnergyResidency(pwrState, pwrState);
+        DRAMEnergy::Energy window = dramEnergy.energy();
+        dramEnergy.reset();
+
+        stats.actEnergy += window.act * dram.devicesPerRank;
+        stats.preEnergy += window.pre * dram.devicesPerRank;
+        stats.readEnergy += window.read * dram.devicesPerRank;
+        stats.writeEnergy += window.write * dram.devicesPerRank;
+        stats.refreshEnergy += window.refresh * dram.devicesPerRank;
+        stats.actBackEnergy += window.actBack * dram.devicesPerRank;
+        stats.preBackEnergy += window.preBack * dram.devicesPerRank;
+        stats.actPowerDownEnergy += window.actPowerDown *
+            dram.devicesPerRank;
+        stats.prePowerDownEnergy += window.prePowerDown *
+            dram.devicesPerRank;
+        stats.selfRefreshEnergy += window.selfRefresh * dram.devicesPerRank;
+        stats.totalEnergy += window.total * dram.devicesPerRank;
+    } else {
+        updateDRAMPowerStats();
+    }
+
+    // Average power must not be accumulated but calculated over the time
+    // since last stats reset. sim_clock::Frequency is tick period not tick
+    // frequency.
+    //              energy (pJ)     1e-9
+    // power (mW) = ----------- * ----------
+    //              time (tick)   tick_frequency
+    stats.averagePower = (stats.totalEnergy.value() /
+                    (curTick() - dram.lastStatsResetTick)) *
+                    (sim_clock::Frequency / 1000000000.0);
+}
+
+void
+DRAMInterface::Rank::updateDRAMPowerStats()
 {
     // All commands up to refresh have completed
     // flush cmdList to DRAMPower
@@ -1794,15 +1955,6 @@ DRAMInterface::Rank::updatePowerStats()
 
     // Accumulate window energy into the total energy.
     stats.totalEnergy += energy.window_energy * dram.devicesPerRank;
-    // Average power must not be accumulated but calculated over the time
-    // since last stats reset. sim_clock::Frequency is tick period not tick
-    // frequency.
-    //              energy (pJ)     1e-9
-    // power (mW) = ----------- * ----------
-    //              time (tick)   tick_frequency
-    stats.averagePower = (stats.totalEnergy.value() /
-                    (curTick() - dram.lastStatsResetTick)) *
-                    (sim_clock::Frequency / 1000000000.0);
 }
 
 void
@@ -1820,6 +1972,13 @@ DRAMInterface::Rank::computeStats()
 
 void
 DRAMInterface::Rank::resetStats() {
+    if (dram.energyModel == enums::counters) {
+        // drop anything accumulated since the last update
+        dramEnergy.reset();
+        energyTick = curTick();
+        return;
+    }
+
     // The only way to clear the counters in DRAMPower is to call
     // calcWindowEnergy function as that then calls clearCounters. The
     // clearCounters method itself is private.
@@ -46,6 +46,7 @@
 #ifndef __DRAM_INTERFACE_HH__
 #define __DRAM_INTERFACE_HH__
 
+#include "mem/dram_energy.hh"
 #include "mem/drampower.hh"
 #include "mem/mem_interface.hh"
 #include "params/DRAMInterface.hh"
@@ -256,11 +257,32 @@ class DRAMInterface : public MemInterface
          */
         Tick refreshDueAt;
 
+        /**
+         * Track up to when the power state residency has been passed to
+         * the counter based energy model
+         */
+        Tick energyTick;
+
         /**
          * Function to update Power Stats
          */
         void updatePowerStats();
 
+        /**
+         * Update the energy stats from DRAMPower
+         */
+        void updateDRAMPowerStats();
+
+        /**
+         * Pass the residency in a power state, up to the current tick,
+         * to the counter based energy model.
+         *
+         * @param pwr_state Power state the rank was in
+         * @param next_state Power state the rank is transitioning to
+         */
+        void updateEnergyResidency(PowerState pwr_state,
+                                   PowerState next_state);
+
         /**
          * Schedule a power state transition in the future, and
          * potentially override an already scheduled transition.
@@ -327,6 +349,13 @@ class DRAMInterface : public MemInterface
          */
         std::vector<Command> cmdList;
 
+        /**
+         * Counter based energy model, used instead of DRAMPower when
+         * selected. Only command counts and power state residency are
+         * tracked, and cmdList is left empty.
+         */
+        DRAMEnergy dramEnergy;
+
         /**
          * Vector of Banks. Each rank is made of several devices which in
          * term are made from several banks.
@@ -416,6 +445,17 @@ class DRAMInterface : public MemInterface
          */
         void flushCmdList();
 
+        /**
+         * Record a command for the energy model in use, either by adding
+         * it to cmdList for DRAMPower or by updating the command counts.
+         *
+         * @param type Type of the command
+         * @param bank Bank the command is targeting
+         * @param cmd_at Tick when the command is issued
+         */
+        void recordCommand(Data::MemCommand::cmds type, uint8_t bank,
+                           Tick cmd_at);
+
         /**
          * Computes stats just prior to dump event
          */
@@ -478,6 +518,12 @@ class DRAMInterface : public MemInterface
         return cmd.timeStamp < cmd_next.timeStamp;
     }
 
+    /**
+     * Transform the DRAMInterfaceParams to the currents, voltages and
+     * timings used by the counter based energy model.
+     */
+    static DRAMEnergy::Spec getEnergySpec(const DRAMInterfaceParams &p);
+
     /**
      * DRAM specific device characteristics
      */
@@ -533,6 +579,9 @@ class DRAMInterface : public MemInterface
     /** Enable or disable DRAM powerdown states. */
     bool enableDRAMPowerdown;
 
+    /** Model used to compute the rank energy stats */
+    const enums::DRAMEnergyModel energyModel;
+
     /** The time when stats were last reset used to calculate average power */
     Tick lastStatsResetTick;
 
@@ -33,11 +33,13 @@
  */
 #include "mem/page_table.hh"
 
+#include <mutex>
 #include <string>
 
 #include "base/compiler.hh"
 #include "base/trace.hh"
 #include "debug/MMU.hh"
+#include "sim/eventq.hh"
 #include "sim/faults.hh"
 #include "sim/serialize.hh"
 
@@ -47,6 +49,8 @@ namespace gem5
 void
 EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 {
+    std::unique_lock<std::shared_mutex> lock(pTableMutex);
+
     bool clobber = flags & Clobber;
     // starting address must be page aligned
     assert(pageOffset(vaddr) == 0);
@@ -74,6 +78,8 @@ EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 void
 EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 {
+    std::unique_lock<std::shared_mutex> lock(pTableMutex);
+
     assert(pageOffset(vaddr) == 0);
     assert(pageOffset(new_vaddr) == 0);
 
@@ -96,6 +102,7 @@ EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 void
 EmulationPageTable::getMappings(std::vector<std::pair<Addr, Addr>> *addr_maps)
 {
+    std::shared_lock<std::shared_mutex> lock(pTableMutex);
     for (auto &iter : pTable)
         addr_maps->push_back(std::make_pair(iter.first, iter.second.paddr));
 }
@@ -103,6 +110,8 @@ EmulationPageTable::getMappings(std::vector<std::pair<Addr, Addr>> *addr_maps)
 void
 EmulationPageTable::unmap(Addr vaddr, int64_t size)
 {
+    std::unique_lock<std::shared_mutex> lock(pTableMutex);
+
     assert(pageOffset(vaddr) == 0);
 
     DPRINTF(MMU, "Unmapping page: %#x-%#x\n", vaddr, vaddr + size);
@@ -119,6 +128,8 @@ EmulationPageTable::unmap(Addr vaddr, int64_t size)
 bool
 EmulationPageTable::isUnmapped(Addr vaddr, int64_t size)
 {
+    std::shared_lock<std::shared_mutex> lock(pTableMutex);
+
     // starting address must be page aligned
     assert(pageOffset(vaddr) == 0);
 
@@ -132,6 +143,12 @@ EmulationPageTable::isUnmapped(Addr vaddr, int64_t size)
 const EmulationPageTable::Entry *
 EmulationPageTable::lookup(Addr vaddr)
 {
+    // Translations are frequent, only pay for the lock when other threads
+    // may be changing the mappings.
+    std::shared_lock<std::shared_mutex> lock(pTableMutex, std::defer_lock);
+    if (inParallelMode)
+        lock.lock();
+
     Addr page_addr = pageAlign(vaddr);
     PTableItr iter = pTable.find(page_addr);
     if (iter == pTable.end())
@@ -35,6 +35,7 @@
 #ifndef __MEM_PAGE_TABLE_HH__
 #define __MEM_PAGE_TABLE_HH__
 
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
@@ -67,6 +68,16 @@ class EmulationPageTable : public Serializable
     typedef PTable::iterator PTableItr;
     PTable pTable;
 
+    /**
+     * Guards pTable when the threads of a process are simulated on
+     * different event queues: lookups may happen on any thread while a
+     * fault or a syscall changes the mappings. Entries are only erased by
+     * syscalls, which run with all the other threads stopped, so the
+     * entries returned by lookup() can be used without holding the lock.
+     * Lookups only take the lock in parallel mode.
+     */
+    std::shared_mutex pTableMutex;
+
     const Addr _pageSize;
     const Addr offsetMask;
 
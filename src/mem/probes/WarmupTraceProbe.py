@@ -0,0 +1,59 @@
+# Copyright (c) 2026 The Regents of The University of Michigan
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import *
+from m5.objects.BaseMemProbe import BaseMemProbe
+
+class WarmupTraceProbe(BaseMemProbe):
+    """Keep a compact trace of the most recent cache line accesses, e.g.
+    from CommMonitors between CPUs and their caches while fast-forwarding
+    with the caches bypassed, and replay it into the caches right before
+    switching to detailed CPUs. The system has to be drained for the
+    replay, e.g.:
+
+        m5.drain()
+        probe.replay()
+        m5.switchCpus(system, switch_cpu_list)
+    """
+
+    type = 'WarmupTraceProbe'
+    cxx_header = "mem/probes/warmup_trace.hh"
+    cxx_class = 'gem5::WarmupTraceProbe'
+
+    cxx_exports = [
+        PyBindMethod("replay"),
+    ]
+
+    max_records = Param.Unsigned(8 * 1024 * 1024,
+        "Number of most recent accesses to keep")
+
+    # The accesses of a CPU are replayed through its ports, so these
+    # are the CPUs the trace was recorded from.
+    cpus = VectorParam.BaseCPU([], "CPUs to replay the accesses of")
+
+    system = Param.System(Parent.any, "System the probe belongs to")
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/probes/warmup_trace.hh"
+
+#include <unordered_map>
+
+#include "base/logging.hh"
+#include "cpu/base.hh"
+#include "mem/packet.hh"
+#include "mem/port.hh"
+#include "params/WarmupTraceProbe.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+WarmupTraceProbe::WarmupTraceProbe(const WarmupTraceProbeParams &p)
+    : BaseMemProbe(p),
+      trace(p.max_records),
+      cpus(p.cpus),
+      system(p.system),
+      lineSize(p.system->cacheLineSize()),
+      lastRecord{0, AccessTrace::Read, 0},
+      haveLastRecord(false),
+      replaying(false)
+{
+}
+
+void
+WarmupTraceProbe::handleRequest(const probing::PacketInfo &pkt_info)
+{
+    if (replaying || (pkt_info.flags & Request::UNCACHEABLE) ||
+        pkt_info.cmd.isEviction()) {
+        return;
+    }
+
+    AccessTrace::Op op;
+    if (pkt_info.cmd.isWrite()) {
+        op = AccessTrace::Write;
+    } else if (pkt_info.cmd.isRead()) {
+        op = (pkt_info.flags & Request::INST_FETCH) ?
+            AccessTrace::Fetch : AccessTrace::Read;
+    } else {
+        return;
+    }
+
+    const AccessTrace::Record rec = {pkt_info.addr / lineSize, op,
+                                     pkt_info.id};
+
+    // Back to back accesses to the same line don't change the state
+    // of the caches any further
+    if (haveLastRecord && rec == lastRecord)
+        return;
+
+    trace.append(rec);
+    lastRecord = rec;
+    haveLastRecord = true;
+}
+
+uint64_t
+WarmupTraceProbe::replay()
+{
+    fatal_if(system->drainState() != DrainState::Drained,
+             "%s: The system has to be drained to replay the trace.",
+             name());
+
+    std::unordered_map<RequestorID, RequestPort *> ports;
+    for (auto *cpu : cpus) {
+        ports[cpu->dataRequestorId()] =
+            &dynamic_cast<RequestPort &>(cpu->getDataPort());
+        ports[cpu->instRequestorId()] =
+            &dynamic_cast<RequestPort &>(cpu->getInstPort());
+    }
+
+    // The caches are bypassed in atomic_noncaching mode
+    const enums::MemoryMode mode = system->getMemoryMode();
+    system->setMemoryMode(enums::atomic);
+    replaying = true;
+
+    std::vector<uint8_t> data(lineSize);
+    uint64_t replayed = 0;
+    trace.forEach([&](const AccessTrace::Record &rec) {
+        auto it = ports.find(rec.requestor);
+        if (it == ports.end())
+            return;
+        RequestPort &port = *it->second;
+
+        const Request::Flags flags = rec.op == AccessTrace::Fetch ?
+            Request::INST_FETCH : 0;
+        auto req = std::make_shared<Request>(rec.line * lineSize, lineSize,
+                                             flags, rec.requestor);
+
+        if (rec.op == AccessTrace::Write) {
+            // Write what is already there, so that only the state of
+            // the caches changes
+            Packet read_pkt(req, MemCmd::ReadReq);
+            read_pkt.dataStatic(data.data());
+            port.sendFunctional(&read_pkt);
+        }
+
+        Packet pkt(req, rec.op == AccessTrace::Write ?
+                   MemCmd::WriteReq : MemCmd::ReadReq);
+        pkt.dataStatic(data.data());
+        port.sendAtomic(&pkt);
+        replayed++;
+    });
+
+    replaying = false;
+    system->setMemoryMode(mode);
+
+    trace.clear();
+    haveLastRecord = false;
+
+    return replayed;
+}
+
+} // namespace gem5
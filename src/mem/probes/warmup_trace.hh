@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_PROBES_WARMUP_TRACE_HH__
+#define __MEM_PROBES_WARMUP_TRACE_HH__
+
+#include <vector>
+
+#include "mem/access_trace.hh"
+#include "mem/probes/base.hh"
+
+namespace gem5
+{
+
+struct WarmupTraceProbeParams;
+class BaseCPU;
+class System;
+
+/**
+ * Keep a bounded trace of the most recent cache line accesses, and
+ * replay them into the caches before switching to detailed CPUs. The
+ * accesses are replayed as atomic accesses through the ports of the
+ * CPUs they were recorded from, so the caches are warmed with the
+ * usual coherence actions and data movements, without executing
+ * anything. The replay assumes the caches are clean, e.g. because
+ * they were bypassed while recording.
+ */
+class WarmupTraceProbe : public BaseMemProbe
+{
+  public:
+    WarmupTraceProbe(const WarmupTraceProbeParams &params);
+
+    /**
+     * Replay the trace into the caches and clear it. The system has to
+     * be drained.
+     *
+     * @return The number of accesses replayed.
+     */
+    uint64_t replay();
+
+  protected:
+    void handleRequest(const probing::PacketInfo &pkt_info) override;
+
+  private:
+    AccessTrace trace;
+
+    const std::vector<BaseCPU *> cpus;
+
+    System *system;
+
+    /** Cache line size of the system */
+    const unsigned lineSize;
+
+    /** Most recent record, not to record repeated accesses */
+    AccessTrace::Record lastRecord;
+    bool haveLastRecord;
+
+    /** Don't record the accesses we replay */
+    bool replaying;
+};
+
+} // namespace gem5
+
+#endif //__MEM_PROBES_WARMUP_TRACE_HH__
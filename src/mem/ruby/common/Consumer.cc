@@ -48,7 +48,7 @@ namespace ruby
 
 Consumer::Consumer(ClockedObject *_em, Event::Priority ev_prio)
     : m_wakeup_event([this]{ processCurrentEvent(); },
-                    "Consumer Event", false, ev_prio),
+                    _em->name() + ".consumerEvent", false, ev_prio),
       em(_em)
 { }
 
@@ -42,7 +42,7 @@ namespace ruby
 
 Histogram::Histogram(int binsize, uint32_t bins)
 {
-    m_binsize = binsize;
+    setBinSize(binsize);
     clear(bins);
 }
 
@@ -53,10 +53,18 @@ Histogram::~Histogram()
 void
 Histogram::clear(int binsize, uint32_t bins)
 {
-    m_binsize = binsize;
+    setBinSize(binsize);
     clear(bins);
 }
 
+void
+Histogram::setBinSize(int binsize)
+{
+    m_binsize = binsize;
+    m_binshift = (binsize > 0 && isPowerOf2(binsize)) ?
+        floorLog2(binsize) : -1;
+}
+
 void
 Histogram::clear(uint32_t bins)
 {
@@ -87,6 +95,8 @@ Histogram::doubleBinSize()
     }
 
     m_binsize *= 2;
+    if (m_binshift >= 0)
+        m_binshift++;
 }
 
 void
@@ -116,7 +126,10 @@ Histogram::add(int64_t value)
         uint32_t t_bins = m_data.size();
 
         while (m_max >= (t_bins * m_binsize)) doubleBinSize();
-        index = value/m_binsize;
+        if (m_binshift >= 0)
+            index = value >> m_binshift;
+        else
+            index = value/m_binsize;
     }
 
     assert(index < m_data.size());
@@ -71,12 +71,14 @@ private:
     int64_t m_max;          // the maximum value seen so far
     uint64_t m_count;                // the number of elements added
     int m_binsize;                // the size of each bucket
+    int m_binshift;               // log2 of a power of 2 bin size, or -1
     uint32_t m_largest_bin;      // the largest bin used
 
     int64_t m_sumSamples;   // the sum of all samples
     uint64_t m_sumSquaredSamples; // the sum of the square of all samples
 
     double getStandardDeviation() const;
+    void setBinSize(int binsize);
 };
 
 bool node_less_then_eq(const Histogram* n1, const Histogram* n2);
@@ -407,6 +407,13 @@ AbstractController::recvAtomic(PacketPtr pkt)
    return ticksToCycles(memoryPort.sendAtomic(pkt));
 }
 
+Tick
+AbstractController::recvAtomicBackdoor(PacketPtr pkt,
+                                       MemBackdoorPtr &backdoor)
+{
+   return ticksToCycles(memoryPort.sendAtomicBackdoor(pkt, backdoor));
+}
+
 MachineID
 AbstractController::mapAddressToMachine(Addr addr, MachineType mtype) const
 {
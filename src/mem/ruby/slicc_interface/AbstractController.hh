@@ -49,6 +49,7 @@
 #include "base/addr_range.hh"
 #include "base/addr_range_map.hh"
 #include "base/callback.hh"
+#include "mem/backdoor.hh"
 #include "mem/packet.hh"
 #include "mem/qport.hh"
 #include "mem/ruby/common/Address.hh"
@@ -167,6 +168,7 @@ class AbstractController : public ClockedObject, public Consumer
 
     void recvTimingResp(PacketPtr pkt);
     Tick recvAtomic(PacketPtr pkt);
+    Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &backdoor);
 
     const AddrRangeList &getAddrRanges() const { return addrRanges; }
 
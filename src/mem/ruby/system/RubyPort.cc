@@ -319,6 +319,20 @@ RubyPort::MemResponsePort::recvTimingReq(PacketPtr pkt)
 
 Tick
 RubyPort::MemResponsePort::recvAtomic(PacketPtr pkt)
+{
+    return atomicAccess(pkt, nullptr);
+}
+
+Tick
+RubyPort::MemResponsePort::recvAtomicBackdoor(PacketPtr pkt,
+                                              MemBackdoorPtr &backdoor)
+{
+    return atomicAccess(pkt, &backdoor);
+}
+
+Tick
+RubyPort::MemResponsePort::atomicAccess(PacketPtr pkt,
+                                        MemBackdoorPtr *backdoor)
 {
     RubyPort *ruby_port = static_cast<RubyPort *>(&owner);
     // Only atomic_noncaching mode supported!
@@ -367,9 +381,20 @@ RubyPort::MemResponsePort::recvAtomic(PacketPtr pkt)
                     pkt->getAddr(), (MachineType)mem_interface_type);
     AbstractController *mem_interface =
         rs->m_abstract_controls[mem_interface_type][id.getNum()];
-    Tick latency = mem_interface->recvAtomic(pkt);
-    if (access_backing_store)
+
+    // As the Ruby caches are bypassed, the memory holding the data can
+    // be handed up as is, i.e. the backing store if it is the one used
+    Tick latency;
+    if (access_backing_store) {
+        latency = mem_interface->recvAtomic(pkt);
         rs->getPhysMem()->access(pkt);
+        if (backdoor)
+            rs->getPhysMem()->getBackdoor(*backdoor);
+    } else if (backdoor) {
+        latency = mem_interface->recvAtomicBackdoor(pkt, *backdoor);
+    } else {
+        latency = mem_interface->recvAtomic(pkt);
+    }
     return latency;
 }
 
@@ -45,6 +45,7 @@
 #include <cassert>
 #include <string>
 
+#include "mem/backdoor.hh"
 #include "mem/ruby/common/MachineID.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
 #include "mem/ruby/protocol/RequestStatus.hh"
@@ -97,6 +98,8 @@ class RubyPort : public ClockedObject
 
         Tick recvAtomic(PacketPtr pkt);
 
+        Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &backdoor);
+
         void recvFunctional(PacketPtr pkt);
 
         AddrRangeList getAddrRanges() const
@@ -107,6 +110,12 @@ class RubyPort : public ClockedObject
       private:
         bool isShadowRomAddress(Addr addr) const;
         bool isPhysMemAddress(PacketPtr pkt) const;
+
+        /**
+         * Do an atomic access, which bypasses the Ruby caches, and get
+         * a backdoor to the memory holding the data if asked to.
+         */
+        Tick atomicAccess(PacketPtr pkt, MemBackdoorPtr *backdoor);
     };
 
     class PioRequestPort : public QueuedRequestPort
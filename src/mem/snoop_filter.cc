@@ -45,6 +45,7 @@
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/SnoopFilter.hh"
+#include "mem/cache/tags/associative_set_impl.hh"
 #include "sim/system.hh"
 
 namespace gem5
@@ -52,12 +53,84 @@ namespace gem5
 
 const int SnoopFilter::SNOOP_MASK_SIZE;
 
+SnoopFilter::SnoopFilter(const SnoopFilterParams &p)
+    : SimObject(p), reqLookupResult(cachedLocations.end()),
+      linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
+      maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
+      table(p.bounded ?
+            new AssociativeSet<TableEntry>(p.assoc, p.entries,
+                                           p.indexing_policy,
+                                           p.replacement_policy) :
+            nullptr),
+      replacementPolicy(p.replacement_policy),
+      stats(this)
+{
+}
+
+SnoopFilter::TableEntry *
+SnoopFilter::findEntry(Addr line_addr) const
+{
+    TableEntry *entry = table->findEntry(tableKey(line_addr),
+                                         line_addr & LineSecure);
+    assert(!entry || entry->lineAddr == line_addr);
+    return entry;
+}
+
+void
+SnoopFilter::allocateEntry(Addr line_addr)
+{
+    // lines with requests in flight cannot be evicted, as their
+    // responses still need to find them
+    ReplacementCandidates candidates;
+    for (TableEntry *entry : table->getPossibleEntries(tableKey(line_addr))) {
+        if (!entry->isValid() ||
+            cachedLocations.find(entry->lineAddr)->second.requested.none()) {
+            candidates.push_back(entry);
+        }
+    }
+    panic_if(candidates.empty(), "No snoop filter entry can be evicted for "
+             "%#x, all the lines of the set have requests in flight\n",
+             line_addr);
+
+    TableEntry *victim =
+        static_cast<TableEntry *>(replacementPolicy->getVictim(candidates));
+
+    if (victim->isValid()) {
+        auto sf_it = cachedLocations.find(victim->lineAddr);
+        assert(sf_it != cachedLocations.end());
+
+        SnoopList holders = maskToPortList(sf_it->second.holder);
+        DPRINTF(SnoopFilter, "%s:   evicting %#x, SF value %x.%x\n",
+                __func__, victim->lineAddr, sf_it->second.requested,
+                sf_it->second.holder);
+
+        stats.evictions++;
+        stats.backInvalidations += holders.size();
+        if (!holders.empty()) {
+            evictions.push_back({victim->lineAddr & ~Addr(LineSecure),
+                                 victim->isSecure(), std::move(holders)});
+        }
+
+        cachedLocations.erase(sf_it);
+        table->invalidate(victim);
+    }
+
+    victim->lineAddr = line_addr;
+    table->insertEntry(tableKey(line_addr), line_addr & LineSecure, victim);
+}
+
 void
 SnoopFilter::eraseIfNullEntry(SnoopFilterCache::iterator& sf_it)
 {
     SnoopItem& sf_item = sf_it->second;
     if ((sf_item.requested | sf_item.holder).none()) {
+        // a line allocated by a request that will retry has no entry
+        if (table) {
+            if (TableEntry *entry = findEntry(sf_it->first))
+                table->invalidate(entry);
+        }
         cachedLocations.erase(sf_it);
+        sf_it = cachedLocations.end();
         DPRINTF(SnoopFilter, "%s:   Removed SF entry.\n",
                 __func__);
     }
@@ -79,6 +152,7 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
     }
     SnoopMask req_port = portToMask(cpu_side_port);
     reqLookupResult.it = cachedLocations.find(line_addr);
+    reqLookupResult.needsEntry = false;
     bool is_hit = (reqLookupResult.it != cachedLocations.end());
 
     // If the snoop filter has no entry, and we should not allocate,
@@ -87,8 +161,23 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
     if (!is_hit && !allocate)
         return snoopDown(lookupLatency);
 
+    // A bounded snoop filter may have evicted, and back-invalidated,
+    // the line while the eviction from above was in flight, in which
+    // case there is nothing left to track.
+    if (!is_hit && table && cpkt->isEviction())
+        return snoopDown(lookupLatency);
+
     // If no hit in snoop filter create a new element and update iterator
     if (!is_hit) {
+        if (table) {
+            // the table entry, and the eviction it may cause, waits
+            // for the request to be accepted in finishRequest
+            reqLookupResult.needsEntry = true;
+        } else {
+            panic_if(cachedLocations.size() >= maxEntryCount,
+                     "snoop filter exceeded capacity of %d cache blocks\n",
+                     maxEntryCount);
+        }
         reqLookupResult.it =
             cachedLocations.emplace(line_addr, SnoopItem()).first;
     }
@@ -102,6 +191,12 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 
     stats.totRequests++;
     if (is_hit) {
+        if (table) {
+            TableEntry *entry = findEntry(line_addr);
+            assert(entry);
+            table->accessEntry(entry);
+        }
+
         if (interested.count() == 1)
             stats.hitSingleRequests++;
         else
@@ -179,6 +274,12 @@ SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
         }
 
         eraseIfNullEntry(reqLookupResult.it);
+
+        if (reqLookupResult.needsEntry &&
+            reqLookupResult.it != cachedLocations.end()) {
+            allocateEntry(line_addr);
+        }
+        reqLookupResult.needsEntry = false;
     }
 }
 
@@ -196,10 +297,6 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
     auto sf_it = cachedLocations.find(line_addr);
     bool is_hit = (sf_it != cachedLocations.end());
 
-    panic_if(!is_hit && (cachedLocations.size() >= maxEntryCount),
-             "snoop filter exceeded capacity of %d cache blocks\n",
-             maxEntryCount);
-
     // If the snoop filter has no entry, simply return a NULL
     // portlist, there is no point creating an entry only to remove it
     // later
@@ -266,7 +363,12 @@ SnoopFilter::updateSnoopResponse(const Packet* cpkt,
     }
     SnoopMask rsp_mask = portToMask(rsp_port);
     SnoopMask req_mask = portToMask(req_port);
-    SnoopItem& sf_item = cachedLocations[line_addr];
+    // only lookupRequest allocates entries, so that the iterator it
+    // keeps for finishRequest stays valid
+    auto sf_it = cachedLocations.find(line_addr);
+    panic_if(sf_it == cachedLocations.end(),
+             "No SF entry for %#x on snoop response\n", line_addr);
+    SnoopItem& sf_item = sf_it->second;
 
     DPRINTF(SnoopFilter, "%s:   old SF value %x.%x\n",
             __func__,  sf_item.requested, sf_item.holder);
@@ -407,7 +509,12 @@ SnoopFilter::SnoopFilterStats::SnoopFilterStats(statistics::Group *parent)
                "holder of the requested data."),
       ADD_STAT(hitMultiSnoops, statistics::units::Count::get(),
                "Number of snoops hitting in the snoop filter with multiple "
-               "(>1) holders of the requested data.")
+               "(>1) holders of the requested data."),
+      ADD_STAT(evictions, statistics::units::Count::get(),
+               "Number of lines evicted from a bounded snoop filter."),
+      ADD_STAT(backInvalidations, statistics::units::Count::get(),
+               "Number of back-invalidations sent to the holders of the "
+               "evicted lines.")
 {}
 
 void
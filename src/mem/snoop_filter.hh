@@ -44,9 +44,14 @@
 #define __MEM_SNOOP_FILTER_HH__
 
 #include <bitset>
-#include <unordered_map>
+#include <memory>
 #include <utility>
+#include <vector>
 
+#include "base/flat_addr_map.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/tags/associative_set.hh"
+#include "mem/cache/tags/tagged_entry.hh"
 #include "mem/packet.hh"
 #include "mem/port.hh"
 #include "mem/qport.hh"
@@ -85,6 +90,13 @@ namespace gem5
  *     upper cache dropped a line, making the snoop filter pessimistic for now
  * (4) ordering: there is no single point of order in the system.  Instead,
  *     requesting MSHRs track order between local requests and remote snoops
+ *
+ * By default the number of lines tracked is only limited by a sanity
+ * check. A bounded snoop filter instead tracks the lines in a
+ * set-associative table, like an inclusive directory. Allocating an
+ * entry in a full set evicts another line, which must then be
+ * back-invalidated in the caches above that hold it. The snoop filter
+ * queues such evictions, and the crossbar sends the invalidations.
  */
 class SnoopFilter : public SimObject
 {
@@ -95,13 +107,18 @@ class SnoopFilter : public SimObject
 
     typedef std::vector<QueuedResponsePort*> SnoopList;
 
-    SnoopFilter (const SnoopFilterParams &p) :
-        SimObject(p), reqLookupResult(cachedLocations.end()),
-        linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
-        maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
-        stats(this)
+    /**
+     * A line evicted from a bounded snoop filter, along with the ports
+     * of the caches that still hold it.
+     */
+    struct Eviction
     {
-    }
+        Addr addr;
+        bool isSecure;
+        SnoopList holders;
+    };
+
+    SnoopFilter (const SnoopFilterParams &p);
 
     /**
      * Init a new snoop filter and tell it about all the cpu_sideports
@@ -127,6 +144,28 @@ class SnoopFilter : public SimObject
                  SNOOP_MASK_SIZE, id);
     }
 
+    /**
+     * Check whether lines have been evicted, and need to be
+     * back-invalidated by the crossbar.
+     *
+     * @return true if there are evictions to handle
+     */
+    bool hasEvictions() const { return !evictions.empty(); }
+
+    /**
+     * Hand the lines evicted since the last call over to the crossbar,
+     * which must back-invalidate them in all their holders.
+     *
+     * @return the evicted lines and their holders
+     */
+    std::vector<Eviction>
+    takeEvictions()
+    {
+        std::vector<Eviction> res;
+        res.swap(evictions);
+        return res;
+    }
+
     /**
      * Lookup a request (from a CPU-side port) in the snoop filter and
      * return a list of other CPU-side ports that need forwarding of the
@@ -146,7 +185,9 @@ class SnoopFilter : public SimObject
      * For an un-successful request, revert the change to the snoop
      * filter. Also take care of erasing any null entries. This method
      * relies on the result from lookupRequest being stored in
-     * reqLookupResult.
+     * reqLookupResult. In a bounded snoop filter, a line allocated by a
+     * successful request only takes its table entry here, so that a
+     * request that will retry does not evict another line.
      *
      * @param will_retry    This request will retry on this bus / snoop filter
      * @param addr          Packet address, merely for sanity checking
@@ -221,9 +262,9 @@ class SnoopFilter : public SimObject
         SnoopMask holder;
     };
     /**
-     * HashMap of SnoopItems indexed by line address
+     * Open-addressing hash map of SnoopItems indexed by line address
      */
-    typedef std::unordered_map<Addr, SnoopItem> SnoopFilterCache;
+    typedef FlatAddrMap<SnoopItem> SnoopFilterCache;
 
     /**
      * Simple factory methods for standard return values.
@@ -284,6 +325,12 @@ class SnoopFilter : public SimObject
          */
         SnoopItem retryItem;
 
+        /**
+         * Whether the line was allocated by the lookup, and still needs
+         * a table entry in a bounded snoop filter
+         */
+        bool needsEntry;
+
         /**
          * The constructor must be informed of the internal cache's end
          * iterator, so do not allow the compiler to implictly define it.
@@ -291,7 +338,7 @@ class SnoopFilter : public SimObject
          * @param end_it Iterator to the end of the internal cache.
          */
         ReqLookupResult(SnoopFilterCache::iterator end_it)
-            : it(end_it), retryItem{0, 0}
+            : it(end_it), retryItem{0, 0}, needsEntry(false)
         {
         }
         ReqLookupResult() = delete;
@@ -308,6 +355,47 @@ class SnoopFilter : public SimObject
     /** Max capacity in terms of cache blocks tracked, for sanity checking */
     const unsigned maxEntryCount;
 
+    /** Entry of the set-associative table of a bounded snoop filter. */
+    struct TableEntry : public TaggedEntry
+    {
+        /** Line address, including the line status bits */
+        Addr lineAddr = 0;
+    };
+
+    /**
+     * Table of the lines tracked by a bounded snoop filter, the state of
+     * the lines is kept in cachedLocations. Null if unbounded.
+     */
+    std::unique_ptr<AssociativeSet<TableEntry>> table;
+
+    /** Replacement policy of the table */
+    replacement_policy::Base *const replacementPolicy;
+
+    /** Evicted lines waiting to be back-invalidated */
+    std::vector<Eviction> evictions;
+
+    /**
+     * Get the key of a line in the table, i.e. the line number, as the
+     * secure bit is part of the tag of the entries.
+     */
+    Addr tableKey(Addr line_addr) const { return line_addr / linesize; }
+
+    /**
+     * Allocate a table entry for a line, evicting another line of the
+     * set if needed.
+     *
+     * @param line_addr Line address, including the line status bits
+     */
+    void allocateEntry(Addr line_addr);
+
+    /**
+     * Find the table entry of a tracked line.
+     *
+     * @param line_addr Line address, including the line status bits
+     * @return the entry, or nullptr if the line has no entry (yet)
+     */
+    TableEntry *findEntry(Addr line_addr) const;
+
     /**
      * Use the lower bits of the address to keep track of the line status
      */
@@ -329,6 +417,9 @@ class SnoopFilter : public SimObject
         statistics::Scalar totSnoops;
         statistics::Scalar hitSingleSnoops;
         statistics::Scalar hitMultiSnoops;
+
+        statistics::Scalar evictions;
+        statistics::Scalar backInvalidations;
     } stats;
 };
 
@@ -336,18 +427,25 @@ inline SnoopFilter::SnoopMask
 SnoopFilter::portToMask(const ResponsePort& port) const
 {
     assert(port.getId() != InvalidPortID);
+    SnoopMask mask;
     // if this is not a snooping port, return a zero mask
-    return !port.isSnooping() ? 0 :
-        ((SnoopMask)1) << localResponsePortIds[port.getId()];
+    if (port.isSnooping())
+        mask.set(localResponsePortIds[port.getId()]);
+    return mask;
 }
 
 inline SnoopFilter::SnoopList
 SnoopFilter::maskToPortList(SnoopMask port_mask) const
 {
     SnoopList res;
-    for (const auto& p : cpuSidePorts)
-        if ((port_mask & portToMask(*p)).any())
-            res.push_back(p);
+    // the local mask ids follow the order of cpuSidePorts, so test the
+    // bits directly rather than building a mask per port
+    for (size_t i = 0; i < cpuSidePorts.size() && port_mask.any(); ++i) {
+        if (port_mask[i]) {
+            res.push_back(cpuSidePorts[i]);
+            port_mask.reset(i);
+        }
+    }
     return res;
 }
 
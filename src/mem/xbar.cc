@@ -45,6 +45,8 @@
 
 #include "mem/xbar.hh"
 
+#include <algorithm>
+
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/AddrRanges.hh"
@@ -61,6 +63,7 @@ BaseXBar::BaseXBar(const BaseXBarParams &p)
       responseLatency(p.response_latency),
       headerLatency(p.header_latency),
       width(p.width),
+      lastRoute(0),
       gotAddrRanges(p.port_default_connection_count +
                           p.port_mem_side_ports_connection_count, false),
       gotAllAddrRanges(false), defaultPortID(InvalidPortID),
@@ -334,10 +337,26 @@ BaseXBar::findPort(AddrRange addr_range)
     // ranges of all connected CPU-side-port modules
     assert(gotAllAddrRanges);
 
-    // Check the address map interval tree
-    auto i = portMap.contains(addr_range);
-    if (i != portMap.end()) {
-        return i->second;
+    // Most packets go to the same destination as the previous one
+    if (lastRoute < routeTable.size() &&
+        addr_range.isSubset(routeTable[lastRoute].range)) {
+        return routeTable[lastRoute].id;
+    }
+
+    // Find the last range starting at or before the address, and walk
+    // back until none of the earlier ranges extends far enough
+    auto i = std::upper_bound(routeTable.begin(), routeTable.end(),
+                              addr_range.start(),
+                              [](Addr a, const RouteEntry &e)
+                              { return a < e.range.start(); });
+    while (i != routeTable.begin()) {
+        --i;
+        if (i->maxEnd <= addr_range.start())
+            break;
+        if (addr_range.isSubset(i->range)) {
+            lastRoute = i - routeTable.begin();
+            return i->id;
+        }
     }
 
     // Check if this matches the default range
@@ -359,6 +378,19 @@ BaseXBar::findPort(AddrRange addr_range)
           name());
 }
 
+void
+BaseXBar::updateRouteTable()
+{
+    // the portMap is ordered on the start address already
+    routeTable.clear();
+    Addr max_end = 0;
+    for (const auto &r : portMap) {
+        max_end = std::max(max_end, r.first.end());
+        routeTable.push_back({r.first, max_end, r.second});
+    }
+    lastRoute = 0;
+}
+
 /** Function called by the port when the crossbar is receiving a range change.*/
 void
 BaseXBar::recvRangeChange(PortID mem_side_port_id)
@@ -431,6 +463,8 @@ BaseXBar::recvRangeChange(PortID mem_side_port_id)
                       memSidePorts[conflict_id]->getPeer());
             }
         }
+
+        updateRouteTable();
     }
 
     // if we have received ranges from all our neighbouring CPU-side-port
@@ -48,6 +48,7 @@
 
 #include <deque>
 #include <unordered_map>
+#include <vector>
 
 #include "base/addr_range_map.hh"
 #include "base/types.hh"
@@ -318,6 +319,29 @@ class BaseXBar : public ClockedObject
 
     AddrRangeMap<PortID, 3> portMap;
 
+    /**
+     * Flat copy of the portMap used for routing. The ranges are kept
+     * sorted on their start address, alongside the highest end address
+     * of all the ranges up to and including each entry, so that a
+     * lookup is a binary search followed by a short backwards walk
+     * that stops as soon as no earlier range can reach the address.
+     */
+    struct RouteEntry
+    {
+        AddrRange range;
+        Addr maxEnd;
+        PortID id;
+    };
+    std::vector<RouteEntry> routeTable;
+
+    /** Index in the routeTable of the last successful lookup */
+    size_t lastRoute;
+
+    /**
+     * Rebuild the routeTable from the portMap after a range change.
+     */
+    void updateRouteTable();
+
     /**
      * Remember where request packets came from so that we can route
      * responses to the appropriate port. This relies on the fact that
@@ -37,35 +37,62 @@
 
 #include "proto/protoio.hh"
 
+#include <algorithm>
 #include <string>
+#include <thread>
 
 #include "base/logging.hh"
+#include "config/have_zstd.hh"
+
+#if HAVE_ZSTD
+#include "proto/zstd_stream.hh"
+
+#endif
 
 using namespace google::protobuf;
 
 ProtoOutputStream::ProtoOutputStream(const std::string& filename) :
     fileStream(filename.c_str(),
             std::ios::out | std::ios::binary | std::ios::trunc),
-    wrappedFileStream(NULL), gzipStream(NULL), zeroCopyStream(NULL)
+    wrappedFileStream(NULL), gzipStream(NULL), zstdStream(NULL),
+    zeroCopyStream(NULL)
 {
     if (!fileStream.good())
         panic("Could not open %s for writing\n", filename);
 
+    std::string extension;
+    if (filename.find_last_of('.') != std::string::npos)
+        extension = filename.substr(filename.find_last_of('.') + 1);
+
     // Wrap the output file in a zero copy stream, that in turn is
     // wrapped in a gzip stream if the filename ends with .gz. The
-    // latter stream is in turn wrapped in a coded stream
-    wrappedFileStream = new io::OstreamOutputStream(&fileStream);
-    if (filename.find_last_of('.') != std::string::npos &&
-        filename.substr(filename.find_last_of('.') + 1) == "gz") {
+    // latter stream is in turn wrapped in a coded stream. A zstd
+    // stream does its own buffering and writes straight to the file
+    if (extension == "zst") {
+#if HAVE_ZSTD
+        const unsigned threads =
+            std::min(std::thread::hardware_concurrency(), 4U);
+        zstdStream = new ZstdOutputStream(&fileStream, zstdChunkSize,
+                                          threads, zstdLevel);
+        zeroCopyStream = zstdStream;
+#else
+        fatal("Cannot write %s as gem5 was built without zstd support\n",
+              filename);
+#endif
+    } else if (extension == "gz") {
+        wrappedFileStream = new io::OstreamOutputStream(&fileStream);
         gzipStream = new io::GzipOutputStream(wrappedFileStream);
         zeroCopyStream = gzipStream;
     } else {
+        wrappedFileStream = new io::OstreamOutputStream(&fileStream);
         zeroCopyStream = wrappedFileStream;
     }
 
     // Write the magic number to the file
-    io::CodedOutputStream codedStream(zeroCopyStream);
-    codedStream.WriteLittleEndian32(magicNumber);
+    {
+        io::CodedOutputStream codedStream(zeroCopyStream);
+        codedStream.WriteLittleEndian32(magicNumber);
+    }
 
     // Note that each type of stream (packet, instruction etc) should
     // add its own header and perform the appropriate checks
@@ -76,6 +103,10 @@ ProtoOutputStream::~ProtoOutputStream()
     // As the compression is optional, see if the stream exists
     if (gzipStream != NULL)
         delete gzipStream;
+#if HAVE_ZSTD
+    // Closing the zstd stream writes out the remaining chunks
+    delete zstdStream;
+#endif
     delete wrappedFileStream;
     fileStream.close();
 }
@@ -83,35 +114,53 @@ ProtoOutputStream::~ProtoOutputStream()
 void
 ProtoOutputStream::write(const Message& msg)
 {
-    // Due to the byte limit of the coded stream we create it for
-    // every single mesage (based on forum discussions around the size
-    // limitation)
-    io::CodedOutputStream codedStream(zeroCopyStream);
-
-    // Write the size of the message to the stream
-#   if GOOGLE_PROTOBUF_VERSION < 3001000
-        auto msg_size = msg.ByteSize();
-#   else
-        auto msg_size = msg.ByteSizeLong();
-#   endif
-    codedStream.WriteVarint32(msg_size);
-
-    // Write the message itself to the stream
-    msg.SerializeWithCachedSizes(&codedStream);
+    {
+        // Due to the byte limit of the coded stream we create it for
+        // every single mesage (based on forum discussions around the
+        // size limitation)
+        io::CodedOutputStream codedStream(zeroCopyStream);
+
+        // Write the size of the message to the stream
+#       if GOOGLE_PROTOBUF_VERSION < 3001000
+            auto msg_size = msg.ByteSize();
+#       else
+            auto msg_size = msg.ByteSizeLong();
+#       endif
+        codedStream.WriteVarint32(msg_size);
+
+        // Write the message itself to the stream
+        msg.SerializeWithCachedSizes(&codedStream);
+    }
+
+#if HAVE_ZSTD
+    // Now that the coded stream has handed back what it did not use,
+    // let the zstd stream cut a chunk between the messages
+    if (zstdStream != NULL)
+        zstdStream->messageBoundary();
+#endif
 }
 
 ProtoInputStream::ProtoInputStream(const std::string& filename) :
     fileStream(filename.c_str(), std::ios::in | std::ios::binary),
-    fileName(filename), useGzip(false),
-    wrappedFileStream(NULL), gzipStream(NULL), zeroCopyStream(NULL)
+    fileName(filename), useGzip(false), useZstd(false),
+    wrappedFileStream(NULL), gzipStream(NULL), zstdStream(NULL),
+    zeroCopyStream(NULL)
 {
     if (!fileStream.good())
         panic("Could not open %s for reading\n", filename);
 
-    // check the magic number to see if this is a gzip stream
-    unsigned char bytes[2];
-    fileStream.read((char*) bytes, 2);
+    // check the magic number to see if this is a gzip or zstd stream
+    unsigned char bytes[4];
+    fileStream.read((char*) bytes, 4);
     useGzip = fileStream.good() && bytes[0] == 0x1f && bytes[1] == 0x8b;
+    useZstd = fileStream.good() && bytes[0] == 0x28 && bytes[1] == 0xb5 &&
+        bytes[2] == 0x2f && bytes[3] == 0xfd;
+
+#if !HAVE_ZSTD
+    if (useZstd)
+        fatal("Cannot read %s as gem5 was built without zstd support\n",
+              filename);
+#endif
 
     // seek to the start of the input file and clear any flags
     fileStream.clear();
@@ -125,16 +174,23 @@ ProtoInputStream::createStreams()
 {
     // All streams should be NULL at this point
     assert(wrappedFileStream == NULL && gzipStream == NULL &&
-           zeroCopyStream == NULL);
+           zstdStream == NULL && zeroCopyStream == NULL);
 
     // Wrap the input file in a zero copy stream, that in turn is
-    // wrapped in a gzip stream if the filename ends with .gz. The
-    // latter stream is in turn wrapped in a coded stream
-    wrappedFileStream = new io::IstreamInputStream(&fileStream);
-    if (useGzip) {
+    // wrapped in a gzip stream if the file is compressed. The
+    // latter stream is in turn wrapped in a coded stream. The zstd
+    // stream reads the file directly as it needs to seek in it
+    if (useZstd) {
+#if HAVE_ZSTD
+        zstdStream = new ZstdInputStream(&fileStream);
+        zeroCopyStream = zstdStream;
+#endif
+    } else if (useGzip) {
+        wrappedFileStream = new io::IstreamInputStream(&fileStream);
         gzipStream = new io::GzipInputStream(wrappedFileStream);
         zeroCopyStream = gzipStream;
     } else {
+        wrappedFileStream = new io::IstreamInputStream(&fileStream);
         zeroCopyStream = wrappedFileStream;
     }
 
@@ -154,6 +210,10 @@ ProtoInputStream::destroyStreams()
         delete gzipStream;
         gzipStream = NULL;
     }
+#if HAVE_ZSTD
+    delete zstdStream;
+    zstdStream = NULL;
+#endif
     delete wrappedFileStream;
     wrappedFileStream = NULL;
 
@@ -178,6 +238,35 @@ ProtoInputStream::reset()
     createStreams();
 }
 
+size_t
+ProtoInputStream::numChunks() const
+{
+#if HAVE_ZSTD
+    if (zstdStream != NULL)
+        return zstdStream->numChunks();
+#endif
+    return 0;
+}
+
+void
+ProtoInputStream::seekChunk(size_t chunk)
+{
+    panic_if(chunk >= numChunks(),
+             "Cannot seek to chunk %d of %s, which has %d chunks\n",
+             chunk, fileName, numChunks());
+
+    // The first chunk starts with the magic number, so go through
+    // the checks done when opening the file
+    if (chunk == 0) {
+        reset();
+        return;
+    }
+
+#if HAVE_ZSTD
+    zstdStream->seekChunk(chunk);
+#endif
+}
+
 bool
 ProtoInputStream::read(Message& msg)
 {
@@ -51,6 +51,9 @@
 
 #include <fstream>
 
+class ZstdOutputStream;
+class ZstdInputStream;
+
 /**
  * A ProtoStream provides the shared functionality of the input and
  * output streams. At the moment this is limited to magic number.
@@ -63,6 +66,12 @@ class ProtoStream
     /// Use the ASCII characters gem5 as our magic number
     static const uint32_t magicNumber = 0x356d6567;
 
+    /// Uncompressed size of the chunks of a zstd stream
+    static const size_t zstdChunkSize = 1 << 20;
+
+    /// Compression level of zstd streams
+    static const int zstdLevel = 3;
+
     /**
      * Create a ProtoStream.
      */
@@ -94,7 +103,10 @@ class ProtoOutputStream : public ProtoStream
 
     /**
      * Create an output stream for a given file name. If the filename
-     * ends with .gz then the file will be compressed accordinly.
+     * ends with .gz then the file will be compressed accordinly. If
+     * it ends with .zst then the file is compressed with zstd, in
+     * chunks that are compressed in the background and can be
+     * decoded independently of each other.
      *
      * @param filename Path to the file to create or truncate
      */
@@ -125,6 +137,9 @@ class ProtoOutputStream : public ProtoStream
     /// Optional Gzip stream to wrap the Zero Copy stream
     google::protobuf::io::GzipOutputStream* gzipStream;
 
+    /// Optional zstd stream writing to the file stream
+    ZstdOutputStream* zstdStream;
+
     /// Top-level zero-copy stream, either with compression or not
     google::protobuf::io::ZeroCopyOutputStream* zeroCopyStream;
 
@@ -143,8 +158,8 @@ class ProtoInputStream : public ProtoStream
   public:
 
     /**
-     * Create an input stream for a given file name. If the filename
-     * ends with .gz then the file will be decompressed accordingly.
+     * Create an input stream for a given file name. Files compressed
+     * with gzip or zstd are detected and decompressed accordingly.
      *
      * @param filename Path to the file to read from
      */
@@ -169,6 +184,22 @@ class ProtoInputStream : public ProtoStream
      */
     void reset();
 
+    /**
+     * Get the number of chunks that reading can start from, which is
+     * only non-zero for chunked zstd streams.
+     */
+    size_t numChunks() const;
+
+    /**
+     * Continue reading from the start of a chunk. The first chunk
+     * starts with the stream header, and any other chunk with the
+     * first message following it, so the header is typically read
+     * before seeking past it.
+     *
+     * @param chunk Index of the chunk, less than numChunks()
+     */
+    void seekChunk(size_t chunk);
+
   private:
 
     /**
@@ -190,12 +221,18 @@ class ProtoInputStream : public ProtoStream
     /// Boolean flag to remember whether we use gzip or not
     bool useGzip;
 
+    /// Boolean flag to remember whether we use zstd or not
+    bool useZstd;
+
     /// Zero Copy stream wrapping the STL input stream
     google::protobuf::io::IstreamInputStream* wrappedFileStream;
 
     /// Optional Gzip stream to wrap the Zero Copy stream
     google::protobuf::io::GzipInputStream* gzipStream;
 
+    /// Optional zstd stream reading from the file stream
+    ZstdInputStream* zstdStream;
+
     /// Top-level zero-copy stream, either with compression or not
     google::protobuf::io::ZeroCopyInputStream* zeroCopyStream;
 
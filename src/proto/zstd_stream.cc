@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "proto/zstd_stream.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/logging.hh"
+
+namespace
+{
+
+/// Magic numbers and sizes of the zstd seekable format
+const uint32_t skippableMagic = 0x184D2A5E;
+const uint32_t seekableMagic = 0x8F92EAB1;
+const size_t seekTableFooterSize = 9;
+const size_t skippableHeaderSize = 8;
+const uint8_t seekTableChecksumFlag = 0x80;
+
+void
+putLE32(std::string &buf, uint32_t val)
+{
+    for (int i = 0; i < 4; i++)
+        buf.push_back(char((val >> (8 * i)) & 0xff));
+}
+
+uint32_t
+getLE32(const char *buf)
+{
+    uint32_t val = 0;
+    for (int i = 0; i < 4; i++)
+        val |= uint32_t(uint8_t(buf[i])) << (8 * i);
+    return val;
+}
+
+} // anonymous namespace
+
+ZstdOutputStream::ZstdOutputStream(std::ostream *_out, size_t chunk_size,
+                                   unsigned threads, int _level) :
+    out(_out), chunkSize(chunk_size), level(_level), used(0),
+    submitted(0), nextToCompress(0), stopping(false), closed(false)
+{
+    threads = std::max(threads, 1U);
+    for (unsigned i = 0; i < threads; i++)
+        workers.emplace_back([this]() { worker(); });
+}
+
+ZstdOutputStream::~ZstdOutputStream()
+{
+    close();
+}
+
+bool
+ZstdOutputStream::Next(void** data, int* size)
+{
+    // Start each chunk with room for a whole chunk, and only grow it
+    // if a single record overflows it
+    if (used == current.size())
+        current.resize(std::max(chunkSize, current.size() * 2));
+
+    *data = &current[used];
+    *size = current.size() - used;
+    used = current.size();
+    return true;
+}
+
+void
+ZstdOutputStream::BackUp(int count)
+{
+    assert(count >= 0 && size_t(count) <= used);
+    used -= count;
+}
+
+int64_t
+ZstdOutputStream::ByteCount() const
+{
+    return submitted + used;
+}
+
+void
+ZstdOutputStream::messageBoundary()
+{
+    if (used >= chunkSize)
+        submit();
+}
+
+void
+ZstdOutputStream::submit()
+{
+    if (used == 0)
+        return;
+
+    current.resize(used);
+    submitted += used;
+    used = 0;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    queue.emplace_back();
+    queue.back().raw = std::move(current);
+    current = std::string();
+    workAvailable.notify_one();
+
+    // Keep a bounded number of chunks in flight so that a producer
+    // outpacing the compression does not grow the memory footprint
+    drain(lock, 2 * workers.size());
+}
+
+void
+ZstdOutputStream::drain(std::unique_lock<std::mutex> &lock,
+                        size_t max_pending)
+{
+    while (true) {
+        while (!queue.empty() && queue.front().done) {
+            Chunk chunk = std::move(queue.front());
+            queue.pop_front();
+            nextToCompress--;
+
+            lock.unlock();
+            out->write(chunk.compressed.data(), chunk.compressed.size());
+            frames.emplace_back(chunk.compressed.size(), chunk.rawSize);
+            lock.lock();
+        }
+
+        if (queue.size() <= max_pending)
+            return;
+
+        workDone.wait(lock);
+    }
+}
+
+void
+ZstdOutputStream::worker()
+{
+    ZSTD_CCtx *cctx = ZSTD_createCCtx();
+    panic_if(!cctx, "Failed to create a zstd compression context\n");
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        workAvailable.wait(lock, [this]() {
+            return stopping || nextToCompress < queue.size();
+        });
+        if (nextToCompress == queue.size())
+            break;
+
+        // References to the elements of a deque survive insertions
+        // and removals at either end, and the producer only removes
+        // chunks that are done
+        Chunk &chunk = queue[nextToCompress++];
+        lock.unlock();
+
+        chunk.rawSize = chunk.raw.size();
+        chunk.compressed.resize(ZSTD_compressBound(chunk.rawSize));
+        size_t size = ZSTD_compressCCtx(cctx, &chunk.compressed[0],
+                                        chunk.compressed.size(),
+                                        chunk.raw.data(), chunk.rawSize,
+                                        level);
+        panic_if(ZSTD_isError(size), "zstd compression failed: %s\n",
+                 ZSTD_getErrorName(size));
+        chunk.compressed.resize(size);
+        chunk.raw = std::string();
+
+        lock.lock();
+        chunk.done = true;
+        workDone.notify_all();
+    }
+
+    ZSTD_freeCCtx(cctx);
+}
+
+void
+ZstdOutputStream::close()
+{
+    if (closed)
+        return;
+    closed = true;
+
+    submit();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        drain(lock, 0);
+        stopping = true;
+        workAvailable.notify_all();
+    }
+
+    for (auto &thread : workers)
+        thread.join();
+    workers.clear();
+
+    // Append the seek table as a skippable frame, which decoders that
+    // are not aware of it simply step over
+    std::string table;
+    putLE32(table, skippableMagic);
+    putLE32(table, frames.size() * 8 + seekTableFooterSize);
+    for (const auto &frame : frames) {
+        putLE32(table, frame.first);
+        putLE32(table, frame.second);
+    }
+    putLE32(table, frames.size());
+    table.push_back(0);
+    putLE32(table, seekableMagic);
+    out->write(table.data(), table.size());
+    out->flush();
+}
+
+ZstdInputStream::ZstdInputStream(std::istream *_in) :
+    in(_in), dctx(ZSTD_createDCtx()),
+    inBuf(ZSTD_DStreamInSize()), input{inBuf.data(), 0, 0},
+    inputEnd(false), flushPending(false),
+    outBuf(ZSTD_DStreamOutSize()), outSize(0), outPos(0), byteCount(0)
+{
+    panic_if(!dctx, "Failed to create a zstd decompression context\n");
+    readSeekTable();
+}
+
+ZstdInputStream::~ZstdInputStream()
+{
+    ZSTD_freeDCtx(dctx);
+}
+
+void
+ZstdInputStream::readSeekTable()
+{
+    in->seekg(0, std::ios::end);
+    const uint64_t file_size = in->tellg();
+
+    char footer[seekTableFooterSize];
+    if (!in->good() ||
+        file_size < seekTableFooterSize + skippableHeaderSize) {
+        // Too small to hold a seek table
+        in->clear();
+        in->seekg(0, std::ios::beg);
+        return;
+    }
+    in->seekg(file_size - seekTableFooterSize);
+    in->read(footer, seekTableFooterSize);
+
+    if (in->good() && getLE32(footer + 5) == seekableMagic) {
+        const uint32_t num_frames = getLE32(footer);
+        const size_t entry_size =
+            footer[4] & seekTableChecksumFlag ? 12 : 8;
+        const uint64_t table_size =
+            uint64_t(num_frames) * entry_size + seekTableFooterSize;
+
+        if (file_size >= table_size + skippableHeaderSize) {
+            std::vector<char> table(table_size + skippableHeaderSize);
+            in->seekg(file_size - table.size());
+            in->read(table.data(), table.size());
+
+            if (in->good() &&
+                getLE32(table.data()) == skippableMagic &&
+                getLE32(table.data() + 4) == table_size) {
+                uint64_t offset = 0;
+                const char *entry = table.data() + skippableHeaderSize;
+                for (uint32_t i = 0; i < num_frames; i++) {
+                    chunkOffsets.push_back(offset);
+                    offset += getLE32(entry);
+                    entry += entry_size;
+                }
+            }
+        }
+    }
+
+    in->clear();
+    in->seekg(0, std::ios::beg);
+}
+
+bool
+ZstdInputStream::Next(const void** data, int* size)
+{
+    while (outPos == outSize) {
+        // Only fetch more input once the decoder has flushed all it
+        // holds, which is the case when it did not fill the output
+        if (input.pos == input.size && !flushPending) {
+            if (inputEnd)
+                return false;
+            in->read(inBuf.data(), inBuf.size());
+            input.size = in->gcount();
+            input.pos = 0;
+            if (input.size == 0) {
+                inputEnd = true;
+                return false;
+            }
+        }
+
+        ZSTD_outBuffer output = { outBuf.data(), outBuf.size(), 0 };
+        size_t ret = ZSTD_decompressStream(dctx, &output, &input);
+        panic_if(ZSTD_isError(ret), "zstd decompression failed: %s\n",
+                 ZSTD_getErrorName(ret));
+        flushPending = output.pos == output.size;
+        outSize = output.pos;
+        outPos = 0;
+    }
+
+    *data = outBuf.data() + outPos;
+    *size = outSize - outPos;
+    byteCount += *size;
+    outPos = outSize;
+    return true;
+}
+
+void
+ZstdInputStream::BackUp(int count)
+{
+    assert(count >= 0 && size_t(count) <= outPos);
+    outPos -= count;
+    byteCount -= count;
+}
+
+bool
+ZstdInputStream::Skip(int count)
+{
+    const void *data;
+    int size;
+    while (count > 0) {
+        if (!Next(&data, &size))
+            return false;
+        if (size > count) {
+            BackUp(size - count);
+            return true;
+        }
+        count -= size;
+    }
+    return true;
+}
+
+int64_t
+ZstdInputStream::ByteCount() const
+{
+    return byteCount;
+}
+
+void
+ZstdInputStream::seekChunk(size_t chunk)
+{
+    panic_if(chunk >= chunkOffsets.size(),
+             "Chunk %d is beyond the %d chunks in the stream\n",
+             chunk, chunkOffsets.size());
+
+    in->clear();
+    in->seekg(chunkOffsets[chunk], std::ios::beg);
+    ZSTD_DCtx_reset(dctx, ZSTD_reset_session_only);
+
+    input.size = 0;
+    input.pos = 0;
+    inputEnd = false;
+    flushPending = false;
+    outSize = 0;
+    outPos = 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Chunked zstd streams for the protobuf trace files.
+ */
+
+#ifndef __PROTO_ZSTD_STREAM_HH__
+#define __PROTO_ZSTD_STREAM_HH__
+
+#include <google/protobuf/io/zero_copy_stream.h>
+#include <zstd.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * A ZstdOutputStream compresses the data written to it as a sequence
+ * of independent zstd frames, one per chunk, and appends a seek table
+ * in the zstd seekable format when closed. The frames are compressed
+ * by a pool of worker threads while the simulation carries on
+ * producing data, and written to the file in order. The owner is
+ * expected to call messageBoundary() between records, and chunks are
+ * only ever cut there, so that every chunk can be decoded on its own
+ * starting with a complete record.
+ */
+class ZstdOutputStream : public google::protobuf::io::ZeroCopyOutputStream
+{
+  public:
+
+    /**
+     * Create a compressing stream on top of a file stream.
+     *
+     * @param out Stream receiving the compressed data
+     * @param chunk_size Uncompressed size at which a chunk is cut
+     * @param threads Number of compression threads, at least one
+     * @param level zstd compression level
+     */
+    ZstdOutputStream(std::ostream *out, size_t chunk_size,
+                     unsigned threads, int level);
+
+    /**
+     * Close the stream if this has not already been done.
+     */
+    ~ZstdOutputStream();
+
+    bool Next(void** data, int* size) override;
+    void BackUp(int count) override;
+    int64_t ByteCount() const override;
+
+    /**
+     * Mark the end of a record, cutting a new chunk if the current
+     * one has reached the chunk size.
+     */
+    void messageBoundary();
+
+    /**
+     * Compress and write any pending data, followed by the seek
+     * table, and stop the worker threads.
+     */
+    void close();
+
+  private:
+
+    /** A chunk on its way from the producer to the file */
+    struct Chunk
+    {
+        std::string raw;
+        std::string compressed;
+        uint32_t rawSize = 0;
+        bool done = false;
+    };
+
+    /** Hand the current chunk over to the workers */
+    void submit();
+
+    /**
+     * Write the finished chunks at the head of the queue to the file.
+     *
+     * @param lock Lock on the queue mutex, held by the caller
+     * @param max_pending Number of chunks that may remain queued
+     */
+    void drain(std::unique_lock<std::mutex> &lock, size_t max_pending);
+
+    /** Body of the compression threads */
+    void worker();
+
+    std::ostream *out;
+    const size_t chunkSize;
+    const int level;
+
+    /// Chunk being filled and the number of bytes used in it
+    std::string current;
+    size_t used;
+
+    /// Uncompressed bytes of the chunks already submitted
+    int64_t submitted;
+
+    /// Chunks in submission order, and the next one to compress
+    std::deque<Chunk> queue;
+    size_t nextToCompress;
+
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+    bool stopping;
+
+    std::vector<std::thread> workers;
+
+    /// Compressed and uncompressed size of every frame written
+    std::vector<std::pair<uint32_t, uint32_t>> frames;
+
+    bool closed;
+};
+
+/**
+ * A ZstdInputStream decompresses a file made of zstd frames. If the
+ * file ends with a seek table, as written by ZstdOutputStream, the
+ * stream can also be positioned at the start of any of the frames.
+ */
+class ZstdInputStream : public google::protobuf::io::ZeroCopyInputStream
+{
+  public:
+
+    /**
+     * Create a decompressing stream on top of a file stream. The file
+     * stream is expected to be positioned at the start of the file.
+     *
+     * @param in Stream providing the compressed data
+     */
+    ZstdInputStream(std::istream *in);
+
+    ~ZstdInputStream();
+
+    bool Next(const void** data, int* size) override;
+    void BackUp(int count) override;
+    bool Skip(int count) override;
+    int64_t ByteCount() const override;
+
+    /**
+     * Get the number of independently decodable chunks, or zero if
+     * the file has no seek table.
+     */
+    size_t numChunks() const { return chunkOffsets.size(); }
+
+    /**
+     * Restart decompression at the start of a chunk.
+     *
+     * @param chunk Index of the chunk, less than numChunks()
+     */
+    void seekChunk(size_t chunk);
+
+  private:
+
+    /** Look for a seek table at the end of the file */
+    void readSeekTable();
+
+    std::istream *in;
+    ZSTD_DCtx *dctx;
+
+    /// Compressed input and the part of it consumed so far
+    std::vector<char> inBuf;
+    ZSTD_inBuffer input;
+    bool inputEnd;
+
+    /// Whether the decoder may hold output it did not have room for
+    bool flushPending;
+
+    /// Decompressed output, and the part of it handed out so far
+    std::vector<char> outBuf;
+    size_t outSize;
+    size_t outPos;
+
+    int64_t byteCount;
+
+    /// File offset of every chunk
+    std::vector<uint64_t> chunkOffsets;
+};
+
+#endif //__PROTO_ZSTD_STREAM_HH__
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/gtest/logging.hh"
+#include "proto/zstd_stream.hh"
+
+namespace
+{
+
+/** @return The contents of the i-th record, of variable length. */
+std::string
+record(int i)
+{
+    std::string rec(1 + (i * 37) % 301, 'a' + i % 26);
+    rec += std::to_string(i) + ";";
+    return rec;
+}
+
+/** Write a string to a zero-copy stream. */
+void
+write(ZstdOutputStream &out, const std::string &data)
+{
+    size_t pos = 0;
+    while (pos < data.size()) {
+        void *buf;
+        int size;
+        ASSERT_TRUE(out.Next(&buf, &size));
+        size_t len = std::min<size_t>(size, data.size() - pos);
+        std::copy(data.begin() + pos, data.begin() + pos + len,
+                  (char *)buf);
+        out.BackUp(size - len);
+        pos += len;
+    }
+}
+
+/** @return Everything left in a zero-copy stream. */
+std::string
+readAll(ZstdInputStream &in)
+{
+    std::string data;
+    const void *buf;
+    int size;
+    while (in.Next(&buf, &size))
+        data.append((const char *)buf, size);
+    return data;
+}
+
+/**
+ * Write a number of records to a stream, cutting chunks between them.
+ *
+ * @return The concatenated records
+ */
+std::string
+writeRecords(std::ostream &os, int num_records, size_t chunk_size,
+             unsigned threads, std::vector<size_t> *chunk_starts=nullptr)
+{
+    ZstdOutputStream out(&os, chunk_size, threads, 3);
+    std::string data;
+    size_t chunk_bytes = 0;
+    for (int i = 0; i < num_records; i++) {
+        if (chunk_starts && (i == 0 || chunk_bytes >= chunk_size)) {
+            chunk_starts->push_back(i);
+            chunk_bytes = 0;
+        }
+        const std::string rec = record(i);
+        write(out, rec);
+        out.messageBoundary();
+        data += rec;
+        chunk_bytes += rec.size();
+    }
+    EXPECT_EQ(out.ByteCount(), data.size());
+    out.close();
+    return data;
+}
+
+} // anonymous namespace
+
+/** Data written in many chunks by many threads reads back in order. */
+TEST(ZstdStreamTest, RoundTrip)
+{
+    std::stringstream ss;
+    const std::string data = writeRecords(ss, 5000, 4096, 4);
+
+    ZstdInputStream in(&ss);
+    EXPECT_EQ(readAll(in), data);
+    EXPECT_EQ(in.ByteCount(), data.size());
+}
+
+/** Data fits in a single chunk. */
+TEST(ZstdStreamTest, SingleChunk)
+{
+    std::stringstream ss;
+    const std::string data = writeRecords(ss, 10, 1 << 20, 1);
+
+    ZstdInputStream in(&ss);
+    EXPECT_EQ(in.numChunks(), 1);
+    EXPECT_EQ(readAll(in), data);
+}
+
+/** Closing a stream that was never written yields no data. */
+TEST(ZstdStreamTest, Empty)
+{
+    std::stringstream ss;
+    writeRecords(ss, 0, 4096, 2);
+
+    ZstdInputStream in(&ss);
+    EXPECT_EQ(in.numChunks(), 0);
+    EXPECT_EQ(readAll(in), "");
+}
+
+/** Every chunk starts with a record and can be read on its own. */
+TEST(ZstdStreamTest, SeekChunk)
+{
+    std::stringstream ss;
+    std::vector<size_t> chunk_starts;
+    const int num_records = 3000;
+    const std::string data =
+        writeRecords(ss, num_records, 2048, 3, &chunk_starts);
+
+    ZstdInputStream in(&ss);
+    ASSERT_EQ(in.numChunks(), chunk_starts.size());
+    ASSERT_GT(in.numChunks(), 10);
+
+    // Visit the chunks out of order, reading each to the end of the
+    // stream
+    for (size_t chunk : { size_t(7), size_t(3), in.numChunks() - 1,
+                          size_t(0), size_t(5) }) {
+        std::string expected;
+        for (int i = chunk_starts[chunk]; i < num_records; i++)
+            expected += record(i);
+        in.seekChunk(chunk);
+        EXPECT_EQ(readAll(in), expected);
+    }
+}
+
+/** Skipping and backing up move through the data. */
+TEST(ZstdStreamTest, SkipAndBackUp)
+{
+    std::stringstream ss;
+    const std::string data = writeRecords(ss, 2000, 1000, 2);
+
+    ZstdInputStream in(&ss);
+    ASSERT_TRUE(in.Skip(12345));
+    EXPECT_EQ(in.ByteCount(), 12345);
+
+    const void *buf;
+    int size;
+    ASSERT_TRUE(in.Next(&buf, &size));
+    ASSERT_GE(size, 10);
+    in.BackUp(size - 10);
+    EXPECT_EQ(std::string((const char *)buf, 10), data.substr(12345, 10));
+    EXPECT_EQ(readAll(in), data.substr(12355));
+
+    EXPECT_FALSE(in.Skip(1));
+}
+
+/** A plain zstd frame without a seek table can be read but not seeked. */
+TEST(ZstdStreamTest, PlainFrame)
+{
+    const std::string data(100000, 'x');
+    std::string compressed(ZSTD_compressBound(data.size()), 0);
+    compressed.resize(ZSTD_compress(&compressed[0], compressed.size(),
+                                    data.data(), data.size(), 1));
+    std::stringstream ss(compressed);
+
+    ZstdInputStream in(&ss);
+    EXPECT_EQ(in.numChunks(), 0);
+    EXPECT_EQ(readAll(in), data);
+    ASSERT_ANY_THROW(in.seekChunk(0));
+}
+
+/** Files too small to hold a seek table have no chunks. */
+TEST(ZstdStreamTest, TinyFile)
+{
+    std::string compressed(ZSTD_compressBound(0), 0);
+    compressed.resize(ZSTD_compress(&compressed[0], compressed.size(),
+                                    nullptr, 0, 1));
+    ASSERT_LT(compressed.size(), 17);
+    std::stringstream ss(compressed);
+
+    ZstdInputStream in(&ss);
+    EXPECT_EQ(in.numChunks(), 0);
+    EXPECT_EQ(readAll(in), "");
+}
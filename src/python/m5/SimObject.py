@@ -686,6 +686,7 @@ class SimObject(object, metaclass=MetaSimObject):
         # initialize required attributes
         self._parent = None
         self._name = None
+        self._path = None      # set once the hierarchy is final
         self._ccObject = None  # pointer to C++ object
         self._ccParams = None
         self._instantiated = False # really "cloned"
@@ -868,11 +869,13 @@ class SimObject(object, metaclass=MetaSimObject):
     def clear_parent(self, old_parent):
         assert self._parent is old_parent
         self._parent = None
+        self._path = None
 
     # Also implemented by SimObjectVector
     def set_parent(self, parent, name):
         self._parent = parent
         self._name = name
+        self._path = None
 
     # Return parent object of this SimObject, not implemented by
     # SimObjectVector because the elements in a SimObjectVector may not share
@@ -930,6 +933,8 @@ class SimObject(object, metaclass=MetaSimObject):
                 self.add_child(key, val)
 
     def path(self):
+        if self._path is not None:
+            return self._path
         if not self._parent:
             return '<orphan %s>' % self.__class__
         elif isinstance(self._parent, MetaSimObject):
@@ -940,6 +945,12 @@ class SimObject(object, metaclass=MetaSimObject):
             return self._name
         return ppath + "." + self._name
 
+    # Remember the path of this object. Called by m5.instantiate() on
+    # parents before their children, once the hierarchy is final.
+    def freezePath(self):
+        self._path = None
+        self._path = self.path()
+
     def path_list(self):
         if self._parent:
             return self._parent.path_list() + [ self._name, ]
@@ -1017,7 +1028,7 @@ class SimObject(object, metaclass=MetaSimObject):
     def unproxyParams(self):
         for param in self._params.keys():
             value = self._values.get(param)
-            if value != None and isproxy(value):
+            if value is not None and isproxy(value):
                 try:
                     value = value.unproxy(self)
                 except:
@@ -1108,16 +1119,16 @@ class SimObject(object, metaclass=MetaSimObject):
         cc_params = cc_params_struct()
         cc_params.name = str(self)
 
-        param_names = list(self._params.keys())
-        param_names.sort()
-        for param in param_names:
-            value = self._values.get(param)
+        param_names, port_names = self._getCCParamNames()
+        values = self._values
+        for param, is_vector in param_names:
+            value = values.get(param)
             if value is None:
                 fatal("%s.%s without default or user set value",
                       self.path(), param)
 
             value = value.getValue()
-            if isinstance(self._params[param], VectorParamDesc):
+            if is_vector:
                 assert isinstance(value, list)
                 vec = getattr(cc_params, param)
                 assert not len(vec)
@@ -1132,19 +1143,31 @@ class SimObject(object, metaclass=MetaSimObject):
             else:
                 setattr(cc_params, param, value)
 
-        port_names = list(self._ports.keys())
-        port_names.sort()
-        for port_name in port_names:
-            port = self._port_refs.get(port_name, None)
+        port_refs = self._port_refs
+        for port_name, count_name in port_names:
+            port = port_refs.get(port_name, None)
             if port != None:
                 port_count = len(port)
             else:
                 port_count = 0
-            setattr(cc_params, 'port_' + port_name + '_connection_count',
-                    port_count)
+            setattr(cc_params, count_name, port_count)
         self._ccParams = cc_params
         return self._ccParams
 
+    # The sorted parameter and port names getCCParams() goes through are
+    # the same for all the instances of a class, only compute them once.
+    @classmethod
+    def _getCCParamNames(cls):
+        names = cls.__dict__.get('_ccParamNames')
+        if names is None:
+            params = [ (param, isinstance(cls._params[param], VectorParamDesc))
+                       for param in sorted(cls._params.keys()) ]
+            ports = [ (port, 'port_' + port + '_connection_count')
+                      for port in sorted(cls._ports.keys()) ]
+            names = (params, ports)
+            type.__setattr__(cls, '_ccParamNames', names)
+        return names
+
     # Get C++ object corresponding to this object, calling C++ if
     # necessary to construct it.  Does *not* recursively create
     # children.
@@ -144,8 +144,16 @@ def parse_options():
     option("--debug-file", metavar="FILE", default="cout",
         help="Sets the output file for debug. Append '.gz' to the name for it"
               " to be compressed automatically [Default: %default]")
+    option("--debug-binary", action='store_true', default=False,
+        help="Write the debug output to --debug-file in a binary format, "
+             "to be decoded with util/decode_debug_trace.py")
     option("--debug-ignore", metavar="EXPR", action='append', split=':',
         help="Ignore EXPR sim objects")
+    option("--debug-sample-period", metavar="TICKS", type='int', default=0,
+        help="Only output debug messages during the first "
+             "--debug-sample-window ticks of every TICKS ticks")
+    option("--debug-sample-window", metavar="TICKS", type='int', default=0,
+        help="Ticks of debug output of every sampling period")
     option("--remote-gdb-port", type='int', default=7000,
         help="Remote gdb base port (set to 0 to disable listening)")
 
@@ -396,12 +404,20 @@ def main():
         e = event.create(trace.disable, event.Event.Debug_Enable_Pri)
         event.mainq.schedule(e, options.debug_end)
 
-    trace.output(options.debug_file)
+    if options.debug_binary:
+        trace.outputBinary(options.debug_file)
+    else:
+        trace.output(options.debug_file)
 
     for ignore in options.debug_ignore:
         _check_tracing()
         trace.ignore(ignore)
 
+    if options.debug_sample_period:
+        _check_tracing()
+        trace.sample(options.debug_sample_period,
+                     options.debug_sample_window)
+
     sys.argv = arguments
     sys.path = [ os.path.dirname(sys.argv[0]) ] + sys.path
 
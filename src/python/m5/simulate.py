@@ -64,10 +64,14 @@ _drain_manager = _m5.drain.DrainManager.instance()
 
 _instantiated = False # Has m5.instantiate() been called?
 
+# The instantiated SimObjects, in the order of root.descendants()
+_sim_objects = []
+
 # The final call to instantiate the SimObject graph and initialize the
 # system.
 def instantiate(ckpt_dir=None):
     global _instantiated
+    global _sim_objects
     from m5 import options
 
     if _instantiated:
@@ -87,13 +91,20 @@ def instantiate(ckpt_dir=None):
     # hierarchy so we catch them with future descendants() walks
     for obj in root.descendants(): obj.adoptOrphanParams()
 
+    # The hierarchy can't change anymore. Flatten it once instead of
+    # walking it for every pass below, and remember the object paths
+    # which are needed again and again to resolve proxies and name the
+    # C++ objects.
+    _sim_objects = list(root.descendants())
+    for obj in _sim_objects: obj.freezePath()
+
     # Unproxy in sorted order for determinism
-    for obj in root.descendants(): obj.unproxyParams()
+    for obj in _sim_objects: obj.unproxyParams()
 
     if options.dump_config:
         ini_file = open(os.path.join(options.outdir, options.dump_config), 'w')
         # Print ini sections in sorted order for easier diffing
-        for obj in sorted(root.descendants(), key=lambda o: o.path()):
+        for obj in sorted(_sim_objects, key=lambda o: o.path()):
             obj.print_ini(ini_file)
         ini_file.close()
 
@@ -112,25 +123,31 @@ def instantiate(ckpt_dir=None):
         do_dot(root, options.outdir, options.dot_config)
         do_ruby_dot(root, options.outdir, options.dot_config)
 
+    # Objects may be shared between event queues, give their stats one
+    # shard per simulation thread
+    num_queues = max(obj.eventq_index for obj in _sim_objects) + 1
+    if num_queues > 1:
+        stats.setNumShards(num_queues)
+
     # Initialize the global statistics
     stats.initSimStats()
 
     # Create the C++ sim objects and connect ports
-    for obj in root.descendants(): obj.createCCObject()
-    for obj in root.descendants(): obj.connectPorts()
+    for obj in _sim_objects: obj.createCCObject()
+    for obj in _sim_objects: obj.connectPorts()
 
     # Do a second pass to finish initializing the sim objects
-    for obj in root.descendants(): obj.init()
+    for obj in _sim_objects: obj.init()
 
     # Do a third pass to initialize statistics
     stats._bindStatHierarchy(root)
     root.regStats()
 
     # Do a fourth pass to initialize probe points
-    for obj in root.descendants(): obj.regProbePoints()
+    for obj in _sim_objects: obj.regProbePoints()
 
     # Do a fifth pass to connect probe listeners
-    for obj in root.descendants(): obj.regProbeListeners()
+    for obj in _sim_objects: obj.regProbeListeners()
 
     # We want to generate the DVFS diagram for the system. This can only be
     # done once all of the CPP objects have been created and initialised so
@@ -145,9 +162,9 @@ def instantiate(ckpt_dir=None):
     if ckpt_dir:
         _drain_manager.preCheckpointRestore()
         ckpt = _m5.core.getCheckpoint(ckpt_dir)
-        for obj in root.descendants(): obj.loadState(ckpt)
+        for obj in _sim_objects: obj.loadState(ckpt)
     else:
-        for obj in root.descendants(): obj.initState()
+        for obj in _sim_objects: obj.initState()
 
     # Check to see if any of the stat events are in the past after resuming from
     # a checkpoint, If so, this call will shift them to be at a valid time.
@@ -162,8 +179,7 @@ def simulate(*args, **kwargs):
         fatal("m5.instantiate() must be called before m5.simulate().")
 
     if need_startup:
-        root = objects.Root.getInstance()
-        for obj in root.descendants(): obj.startup()
+        for obj in _sim_objects: obj.startup()
         need_startup = False
 
         # Python exit handlers happen in reverse order.
@@ -129,23 +129,29 @@ def _url_factory(schemes, enable=True):
     return decorator
 
 @_url_factory([ None, "", "text", "file", ])
-def _textFactory(fn, desc=True, spaces=True):
+def _textFactory(fn, desc=True, spaces=True, changed_only=False):
     """Output stats in text format.
 
     Text stat files contain one stat per line with an optional
     description. The description is enabled by default, but can be
     disabled by setting the desc parameter to False.
 
+    When changed_only is set, every dump after the first one only
+    contains the stats that were modified since the previous dump.
+    Objects whose stats didn't change are skipped entirely, which makes
+    frequent dumps of large, mostly idle systems cheaper.
+
     Parameters:
       * desc (bool): Output stat descriptions (default: True)
       * spaces (bool): Output alignment spaces (default: True)
+      * changed_only (bool): Only output changed stats (default: False)
 
     Example:
       text://stats.txt?desc=False;spaces=False
 
     """
 
-    return _m5.stats.initText(fn, desc, spaces)
+    return _m5.stats.initText(fn, desc, spaces, changed_only)
 
 @_url_factory([ "h5", ], enable=hasattr(_m5.stats, "initHDF5"))
 def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
@@ -183,6 +189,30 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
 
     return _m5.stats.initHDF5(fn, chunking, desc, formulas)
 
+@_url_factory([ "bin", ])
+def _binaryFactory(fn, desc=False, formulas=True, compress=True):
+    """Output stats in a compact binary time series format.
+
+    The binary format writes a description of the stats once and then
+    appends the raw values of all stats on every dump. This makes
+    frequent periodic stat dumps cheap compared to the text format. The
+    files can be loaded using m5.stats.binary.
+
+    Known limitations:
+      * Sparse histograms currently unsupported.
+
+    Parameters:
+      * desc (bool): Output stat descriptions (default: False)
+      * formulas (bool): Output derived stats (default: True)
+      * compress (bool): Delta encode integral values (default: True)
+
+    Example:
+      bin://stats.bin?compress=False
+
+    """
+
+    return _m5.stats.initBinary(fn, desc, formulas, compress)
+
 @_url_factory(["json"])
 def _jsonFactory(fn):
     """Output stats in JSON format.
@@ -246,6 +276,11 @@ def initSimStats():
     _m5.stats.initSimStats()
     _m5.stats.registerPythonStatsHandlers()
 
+def setNumShards(num_shards):
+    '''Shard the storage of the stats created from now on across the given
+    number of simulation threads.'''
+    _m5.stats.setNumShards(num_shards)
+
 def _visit_groups(visitor, root=None):
     if root is None:
         root = Root.getInstance()
@@ -336,8 +371,15 @@ def prepare():
     _visit_stats(lambda g, s: s.prepare())
 
 def _dump_to_visitor(visitor, roots=None):
+    since = visitor.changedSince()
+
     # New stats
     def dump_group(group):
+        if since:
+            # Let the C++ side skip unchanged stats and groups
+            group.visitChanged(visitor, since)
+            return
+
         for stat in group.getStats():
             stat.visit(visitor)
         for n, g in group.getStatGroups().items():
@@ -359,7 +401,8 @@ def _dump_to_visitor(visitor, roots=None):
 
         # Legacy stats
         for stat in stats_list:
-            stat.visit(visitor)
+            if not since or stat.version() > since:
+                stat.visit(visitor)
 
 lastDump = 0
 # List[SimObject].
@@ -406,6 +449,9 @@ def dump(roots=None):
                 _dump_to_visitor(output, roots=all_roots)
                 output.end()
 
+    # Changes from now on belong to the next dump
+    _m5.stats.advanceVersion()
+
 def reset():
     '''Reset all statistics to the base state'''
 
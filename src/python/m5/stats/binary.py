@@ -0,0 +1,294 @@
+# Copyright (c) 2026 The Regents of The University of Michigan
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Reader for the binary stats format written by the "bin" stat output
+(src/base/stats/binary.cc).
+
+The module doesn't depend on the rest of gem5 and can be used from
+regular Python scripts, or run directly to print the stats in a file:
+
+    python3 binary.py m5out/stats.bin [stat_name ...]
+
+Example:
+
+    from m5.stats.binary import BinaryStats
+
+    stats = BinaryStats("m5out/stats.bin")
+    ticks, insts = stats.series("system.cpu.numInsts")
+    for dump in stats:
+        print(dump.tick, dump["system.cpu.ipc"])
+"""
+
+import struct
+from typing import Any, Dict, Iterator, List, Optional, Tuple
+
+MAGIC = b"gem5stat"
+VERSION = 1
+
+COMPRESSED_FLAG = 0x1
+
+SCHEMA_RECORD = ord("S")
+DATA_RECORD = ord("D")
+
+SCALAR, VECTOR, VECTOR2D, FORMULA, DIST, VECTOR_DIST = range(6)
+
+# Values stored for every distribution, ahead of its buckets
+DIST_FIELDS = (
+    "min",
+    "bucket_size",
+    "samples",
+    "sum",
+    "squares",
+    "logs",
+    "min_val",
+    "max_val",
+    "underflow",
+    "overflow",
+)
+
+_double = struct.Struct("<d")
+
+
+class _Buffer:
+    """Cursor over the payload of a record"""
+
+    def __init__(self, data: bytes):
+        self.data = data
+        self.pos = 0
+
+    def varint(self) -> int:
+        value = 0
+        shift = 0
+        while True:
+            byte = self.data[self.pos]
+            self.pos += 1
+            value |= (byte & 0x7F) << shift
+            if byte < 0x80:
+                return value
+            shift += 7
+
+    def string(self) -> str:
+        size = self.varint()
+        value = self.data[self.pos : self.pos + size].decode()
+        self.pos += size
+        return value
+
+    def byte(self) -> int:
+        value = self.data[self.pos]
+        self.pos += 1
+        return value
+
+    def double(self) -> float:
+        (value,) = _double.unpack_from(self.data, self.pos)
+        self.pos += _double.size
+        return value
+
+
+class Stat:
+    """Description of a stat and where its values are in a dump"""
+
+    def __init__(self, buf: _Buffer, offset: int):
+        self.name = buf.string()
+        self.kind = buf.byte()
+        self.x = buf.varint()
+        self.y = buf.varint()
+        self.unit = buf.string()
+        self.desc = buf.string()
+        self.subnames = [buf.string() for _ in range(buf.varint())]
+        self.y_subnames = [buf.string() for _ in range(buf.varint())]
+        self.offset = offset
+
+    @property
+    def size(self) -> int:
+        return self.x * self.y
+
+    def _dist(self, values: List[float]) -> Dict[str, Any]:
+        dist = dict(zip(DIST_FIELDS, values))
+        dist["buckets"] = values[len(DIST_FIELDS) :]
+        return dist
+
+    def value(self, values: List[float]) -> Any:
+        """Extract the value of this stat from the values of a dump.
+
+        Scalars are returned as a float, vectors and formulas as a list,
+        2d vectors as a list of rows, and distributions as a dict of
+        their fields, with the buckets in "buckets".
+        """
+        v = values[self.offset : self.offset + self.size]
+        if self.kind == SCALAR:
+            return v[0]
+        elif self.kind in (VECTOR, FORMULA):
+            return v
+        elif self.kind == VECTOR2D:
+            return [v[i * self.y : (i + 1) * self.y] for i in range(self.x)]
+        elif self.kind == DIST:
+            return self._dist(v)
+        elif self.kind == VECTOR_DIST:
+            return [
+                self._dist(v[i * self.y : (i + 1) * self.y])
+                for i in range(self.x)
+            ]
+        raise ValueError(f"Unknown kind {self.kind} for stat {self.name}")
+
+
+class Dump:
+    """The values of all stats at one stat dump"""
+
+    def __init__(
+        self, tick: int, schema: Dict[str, Stat], values: List[float]
+    ):
+        self.tick = tick
+        self.schema = schema
+        self.values = values
+
+    def __contains__(self, name: str) -> bool:
+        return name in self.schema
+
+    def __getitem__(self, name: str) -> Any:
+        return self.schema[name].value(self.values)
+
+    def get(self, name: str, default: Any = None) -> Any:
+        stat = self.schema.get(name)
+        return default if stat is None else stat.value(self.values)
+
+    def names(self) -> List[str]:
+        return list(self.schema)
+
+
+class BinaryStats:
+    """All the dumps in a binary stats file"""
+
+    def __init__(self, path: str):
+        with open(path, "rb") as f:
+            data = f.read()
+
+        if data[: len(MAGIC)] != MAGIC:
+            raise ValueError(f"{path} is not a binary stats file")
+        pos = len(MAGIC)
+        (version,) = struct.unpack_from("<I", data, pos)
+        pos += 4
+        if version != VERSION:
+            raise ValueError(f"Unsupported binary stats version {version}")
+        self.compressed = bool(data[pos] & COMPRESSED_FLAG)
+        pos += 1
+
+        self.dumps: List[Dump] = []
+        schema: Dict[str, Stat] = {}
+        last: List[float] = []
+        header = _Buffer(data)
+        while pos < len(data):
+            header.pos = pos
+            rtype = header.byte()
+            size = header.varint()
+            end = header.pos + size
+            if end > len(data):
+                # Truncated record, e.g. from a simulation still running
+                break
+            buf = _Buffer(data[header.pos : end])
+            pos = end
+
+            if rtype == SCHEMA_RECORD:
+                schema = {}
+                offset = 0
+                for _ in range(buf.varint()):
+                    stat = Stat(buf, offset)
+                    schema[stat.name] = stat
+                    offset += stat.size
+                last = [0.0] * offset
+            elif rtype == DATA_RECORD:
+                tick = buf.varint()
+                if self.compressed:
+                    last = self._decode(buf, last)
+                else:
+                    last = [buf.double() for _ in range(len(last))]
+                self.dumps.append(Dump(tick, schema, last))
+            else:
+                raise ValueError(f"Unknown record type {rtype:#x}")
+
+    @staticmethod
+    def _decode(buf: _Buffer, last: List[float]) -> List[float]:
+        values = []
+        for prev in last:
+            token = buf.varint()
+            if token & 1:
+                values.append(buf.double())
+            else:
+                zigzag = token >> 1
+                delta = (zigzag >> 1) ^ -(zigzag & 1)
+                values.append(float(int(prev) + delta))
+        return values
+
+    def __len__(self) -> int:
+        return len(self.dumps)
+
+    def __iter__(self) -> Iterator[Dump]:
+        return iter(self.dumps)
+
+    def __getitem__(self, index: int) -> Dump:
+        return self.dumps[index]
+
+    def names(self) -> List[str]:
+        """Names of all the stats in the file, in order of appearance"""
+        names = {}
+        for dump in self.dumps:
+            for name in dump.schema:
+                names.setdefault(name, None)
+        return list(names)
+
+    def stat(self, name: str) -> Optional[Stat]:
+        """Description of a stat, from the last dump containing it"""
+        for dump in reversed(self.dumps):
+            if name in dump.schema:
+                return dump.schema[name]
+        return None
+
+    def series(self, name: str) -> Tuple[List[int], List[Any]]:
+        """Ticks and values of a stat over all dumps containing it"""
+        ticks = []
+        values = []
+        for dump in self.dumps:
+            stat = dump.schema.get(name)
+            if stat is not None:
+                ticks.append(dump.tick)
+                values.append(stat.value(dump.values))
+        return ticks, values
+
+
+if __name__ == "__main__":
+    import sys
+
+    if len(sys.argv) < 2:
+        print(f"Usage: {sys.argv[0]} FILE [STAT...]", file=sys.stderr)
+        sys.exit(1)
+
+    stats = BinaryStats(sys.argv[1])
+    selected = sys.argv[2:]
+    for dump in stats:
+        print(f"---------- Tick {dump.tick} ----------")
+        for name in selected or dump.names():
+            if name in dump:
+                print(f"{name} {dump[name]}")
@@ -42,13 +42,17 @@
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
 
+#include <fstream>
+#include <iostream>
 #include <map>
 #include <vector>
 
 #include "base/compiler.hh"
 #include "base/debug.hh"
+#include "base/logging.hh"
 #include "base/output.hh"
 #include "base/trace.hh"
+#include "sim/core.hh"
 #include "sim/debug.hh"
 
 namespace py = pybind11;
@@ -67,6 +71,33 @@ output(const char *filename)
     Trace::setDebugLogger(new Trace::OstreamLogger(*file_stream->stream()));
 }
 
+static void
+outputBinary(const char *filename)
+{
+    const std::string name(filename);
+    fatal_if(name == "cout" || name == "cerr",
+             "Binary debug output must be written to a file.\n");
+
+    auto *logger = new Trace::BinaryLogger(simout.resolve(name));
+    Trace::setDebugLogger(logger);
+    registerExitCallback([logger]() { logger->flush(); });
+}
+
+static uint64_t
+decode(const char *infile, const char *outfile)
+{
+    const std::string name(outfile);
+    if (name == "cout") {
+        Trace::OstreamLogger logger(std::cout);
+        return Trace::decodeBinaryTrace(infile, logger);
+    }
+
+    std::ofstream out(name);
+    fatal_if(!out, "Unable to open '%s' for writing.\n", name);
+    Trace::OstreamLogger logger(out);
+    return Trace::decodeBinaryTrace(infile, logger);
+}
+
 static void
 ignore(const char *expr)
 {
@@ -75,6 +106,12 @@ ignore(const char *expr)
     Trace::getDebugLogger()->addIgnore(ignore);
 }
 
+static void
+sample(Tick period, Tick window)
+{
+    Trace::getDebugLogger()->sample(period, window);
+}
+
 void
 pybind_init_debug(py::module_ &m_native)
 {
@@ -122,7 +159,10 @@ pybind_init_debug(py::module_ &m_native)
     py::module_ m_trace = m_native.def_submodule("trace");
     m_trace
         .def("output", &output)
+        .def("outputBinary", &outputBinary)
+        .def("decode", &decode)
         .def("ignore", &ignore)
+        .def("sample", &sample)
         .def("enable", &Trace::enable)
         .def("disable", &Trace::disable)
         ;
@@ -42,6 +42,7 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/binary.hh"
 #include "base/stats/text.hh"
 #include "config/have_hdf5.hh"
 
@@ -112,6 +113,7 @@ pybind_init_stats(py::module_ &m_native)
         .def("initSimStats", &statistics::initSimStats)
         .def("initText", &statistics::initText,
             py::return_value_policy::reference)
+        .def("initBinary", &statistics::initBinary)
 #if HAVE_HDF5
         .def("initHDF5", &statistics::initHDF5)
 #endif
@@ -122,6 +124,8 @@ pybind_init_stats(py::module_ &m_native)
         .def("updateEvents", &statistics::updateEvents)
         .def("processResetQueue", &statistics::processResetQueue)
         .def("processDumpQueue", &statistics::processDumpQueue)
+        .def("advanceVersion", &statistics::advanceVersion)
+        .def("setNumShards", &statistics::setNumShards)
         .def("enable", &statistics::enable)
         .def("enabled", &statistics::enabled)
         .def("statsList", &statistics::statsList)
@@ -131,6 +135,7 @@ pybind_init_stats(py::module_ &m_native)
         .def("begin", &statistics::Output::begin)
         .def("end", &statistics::Output::end)
         .def("valid", &statistics::Output::valid)
+        .def("changedSince", &statistics::Output::changedSince)
         .def("beginGroup", &statistics::Output::beginGroup)
         .def("endGroup", &statistics::Output::endGroup)
         ;
@@ -152,6 +157,7 @@ pybind_init_stats(py::module_ &m_native)
         .def("prepare", &statistics::Info::prepare)
         .def("reset", &statistics::Info::reset)
         .def("zero", &statistics::Info::zero)
+        .def("version", &statistics::Info::version)
         .def("visit", &statistics::Info::visit)
         ;
 
@@ -235,6 +241,11 @@ pybind_init_stats(py::module_ &m_native)
             })
         .def("getStatGroups", &statistics::Group::getStatGroups)
         .def("addStatGroup", &statistics::Group::addStatGroup)
+        .def("visitChanged", [](const statistics::Group &self,
+                                statistics::Output &visitor,
+                                statistics::Version since) {
+                 return self.visitChanged(visitor, since);
+             })
         .def("resolveStat", [](const statistics::Group &self,
                                const std::string &name) -> py::object {
                  const statistics::Info *stat = self.resolveStat(name);
@@ -45,6 +45,20 @@ class Process(SimObject):
     useArchPT = Param.Bool('false', 'maintain an in-memory version of the page\
                             table in an architecture-specific format')
     kvmInSE = Param.Bool('false', 'initialize the process for KvmCPU in SE')
+    # The host memory is accessed behind the back of the caches, so this
+    # is only safe when no cache holds the buffers. It is always done when
+    # the system bypasses the caches.
+    zeroCopySyscalls = Param.Bool(False, 'transfer the data of I/O syscalls '
+                                  'directly between host files and the '
+                                  'memory backing the guest buffers')
+    # Pages of a mapped binary which the guest hasn't written to are read
+    # from the file until then. Rebuilding or truncating the binary while
+    # the simulation runs silently changes the memory of the guest, or
+    # kills the simulator with SIGBUS.
+    mapBinary = Param.Bool(False, 'map the page-aligned parts of the '
+                           'binary copy-on-write from its file instead of '
+                           'copying them, the file must not change while '
+                           'the simulation runs')
     maxStackSize = Param.MemorySize('64MiB', 'maximum size of the stack')
 
     uid = Param.Int(100, 'user id')
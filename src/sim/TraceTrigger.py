@@ -0,0 +1,72 @@
+# Copyright (c) 2026 The Regents of The University of Michigan
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import SimObject
+
+class TraceTrigger(SimObject):
+    """
+    Enable debug flags, and thus debug output and instruction tracing,
+    when a condition is met instead of at a fixed tick. The trigger is
+    activated by the first of its start conditions to happen, and
+    deactivated after a number of instructions or a duration, or by the
+    m5 trace trigger pseudo-op. It is then armed again, so that a PC or
+    a stat crossing its threshold again activates it again.
+
+    With pre_trigger set, the debug flags are enabled for the whole
+    simulation but the messages are only kept in a ring buffer until the
+    trigger is activated, at which point the last pre_trigger messages
+    are output before the ones that follow.
+    """
+    type = 'TraceTrigger'
+    cxx_header = "sim/trace_trigger.hh"
+    cxx_class = 'gem5::TraceTrigger'
+
+    system = Param.System(Parent.any, "System to watch")
+    flags = VectorParam.String("Debug flags to enable, e.g., Exec")
+    pre_trigger = Param.Unsigned(0, "Number of debug messages preceding "
+        "the activation to output, 0 to only enable the flags once "
+        "activated")
+
+    thread = Param.Unsigned(0, "Thread context of the system whose "
+        "instructions start_insts and insts count")
+    start_insts = Param.Counter(0, "Activate once the thread has "
+        "committed this many instructions (0 to disable)")
+    start_pc = Param.Addr(MaxAddr, "Activate when any thread of the "
+        "system reaches this PC")
+    stat = Param.String("", "Stat activating the trigger when its value "
+        "goes above stat_threshold, relative to the system, e.g., "
+        "cpu.numCycles")
+    stat_threshold = Param.Float(0, "Threshold of the stat")
+    stat_period = Param.Latency('1us', "How often to check the stat")
+    pseudo_op = Param.Bool(False, "Whether the m5 trace trigger pseudo-op "
+        "activates and deactivates the trigger")
+
+    insts = Param.Counter(0, "Deactivate after the thread committed this "
+        "many instructions (0 to disable)")
+    duration = Param.Latency('0', "Deactivate after this time "
+        "(0 to disable)")
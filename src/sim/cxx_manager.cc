@@ -712,6 +712,60 @@ CxxConfigManager::setParamVector(const std::string &object_name,
     }
 }
 
+void
+CxxConfigManager::applyOverride(const std::string &assignment)
+{
+    std::string::size_type equals = assignment.find('=');
+    std::string::size_type dot = assignment.rfind('.', equals);
+
+    if (equals == std::string::npos || dot == std::string::npos ||
+        dot == 0 || dot + 1 == equals)
+    {
+        throw Exception("", csprintf("Bad parameter assignment: \"%s\"",
+            assignment));
+    }
+
+    std::string object_name = assignment.substr(0, dot);
+    std::string param_name = assignment.substr(dot + 1, equals - dot - 1);
+    std::string param_value = assignment.substr(equals + 1);
+
+    std::string object_type;
+    const CxxConfigDirectoryEntry &entry =
+        findObjectType(object_name, object_type);
+
+    auto param = entry.parameters.find(param_name);
+    if (param == entry.parameters.end()) {
+        throw Exception(object_name, csprintf("Type %s has no parameter %s",
+            object_type, param_name));
+    }
+
+    if (param->second->isSimObject) {
+        throw Exception(object_name, csprintf("Can't override SimObject"
+            " parameter %s", param_name));
+    }
+
+    if (param->second->isVector) {
+        std::vector<std::string> param_values;
+        tokenize(param_values, param_value, ',');
+        setParamVector(object_name, param_name, param_values);
+    } else {
+        setParam(object_name, param_name, param_value);
+    }
+}
+
+void
+CxxConfigManager::applyOverrides(std::istream &is)
+{
+    std::string line;
+
+    while (std::getline(is, line)) {
+        eat_white(line);
+        if (line.empty() || line[0] == '#')
+            continue;
+        applyOverride(line);
+    }
+}
+
 void CxxConfigManager::addRenaming(const Renaming &renaming)
 {
     renamings.push_back(renaming);
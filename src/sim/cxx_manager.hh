@@ -50,6 +50,7 @@
 #ifndef __SIM_CXX_MANAGER_HH__
 #define __SIM_CXX_MANAGER_HH__
 
+#include <istream>
 #include <list>
 #include <map>
 #include <set>
@@ -310,6 +311,16 @@ class CxxConfigManager
     void setParamVector(const std::string &object_name,
         const std::string &param_name,
         const std::vector<std::string> &param_values);
+
+    /** Set a parameter from an assignment of the form
+     *  path(.path)*.param=value, as used to sweep parameters over a saved
+     *  config.  The values of vector parameters are comma separated.
+     *  SimObject references can't be overridden this way */
+    void applyOverride(const std::string &assignment);
+
+    /** Apply the overrides from a stream with one assignment per line.
+     *  Empty lines and lines starting with '#' are ignored */
+    void applyOverrides(std::istream &is);
 };
 
 } // namespace gem5
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/event_profile.hh"
+
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Keys of all the profiles, shared by all event queues */
+struct KeyRegistry
+{
+    std::mutex mutex;
+    std::deque<std::string> keys{ std::string() };
+    std::unordered_map<std::string, uint32_t> ids;
+};
+
+KeyRegistry &
+keyRegistry()
+{
+    static KeyRegistry registry;
+    return registry;
+}
+
+} // anonymous namespace
+
+void
+EventProfile::reset()
+{
+    entries.assign(entries.size(), Entry());
+}
+
+std::string
+EventProfile::key(uint32_t id)
+{
+    KeyRegistry &registry = keyRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return id < registry.keys.size() ? registry.keys[id] : std::string();
+}
+
+uint32_t
+EventProfile::keyId(const Event &event)
+{
+    // Events without a name get a unique default one, aggregate them by
+    // their description instead.
+    std::string key = event.name();
+    if (key.compare(0, 6, "Event_") == 0)
+        key = std::string("unnamed.") + event.description();
+
+    KeyRegistry &registry = keyRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto res = registry.ids.emplace(key, registry.keys.size());
+    if (res.second)
+        registry.keys.push_back(key);
+    return res.first->second;
+}
+
+} // namespace gem5
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENT_PROFILE_HH__
+#define __SIM_EVENT_PROFILE_HH__
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/compiler.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * Host time profile of the events serviced by an event queue.
+ *
+ * Events are aggregated by key, which is the name of the event, e.g.,
+ * system.cpu.tickEvent, or "unnamed." followed by its description for
+ * events without a name. Keys are shared by all the profiles, and each
+ * event remembers the id of its key after the first time it is
+ * processed so that the key is only looked up once per event object.
+ *
+ * Host time is measured using the time stamp counter on x86 hosts, and
+ * in nanoseconds elsewhere.
+ */
+class EventProfile
+{
+  public:
+    struct Entry
+    {
+        /** Number of events processed */
+        uint64_t events = 0;
+        /** Host time spent processing them */
+        uint64_t hostTicks = 0;
+    };
+
+    /** Current host time */
+    static uint64_t
+    now()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    /**
+     * Account the host time since start to an event which was just
+     * processed.
+     */
+    void
+    record(Event *event, uint64_t start)
+    {
+        const uint64_t end = now();
+
+        uint32_t id = event->profileId;
+        if (GEM5_UNLIKELY(!id))
+            id = event->profileId = keyId(*event);
+        if (GEM5_UNLIKELY(id >= entries.size()))
+            entries.resize(id + 1);
+
+        Entry &entry = entries[id];
+        entry.events++;
+        entry.hostTicks += end - start;
+    }
+
+    /** Entries of the profile, indexed by key id */
+    const std::vector<Entry> &getEntries() const { return entries; }
+
+    void reset();
+
+    /** Key of an id, 0 being an invalid id */
+    static std::string key(uint32_t id);
+
+  protected:
+    std::vector<Entry> entries;
+
+    /** Look up the id of the key of an event, allocating it if new */
+    static uint32_t keyId(const Event &event);
+};
+
+} // namespace gem5
+
+#endif // __SIM_EVENT_PROFILE_HH__
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "sim/event_profile.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class NamedEvent : public Event
+{
+  protected:
+    std::string _name;
+
+  public:
+    NamedEvent(const std::string &name) : _name(name) {}
+
+    void process() override {}
+    const std::string name() const override { return _name; }
+};
+
+class UnnamedEvent : public Event
+{
+  public:
+    void process() override {}
+    const char *description() const override { return "unnamed test"; }
+};
+
+/** Profile exposing the id of the key of an event */
+class TestProfile : public EventProfile
+{
+  public:
+    using EventProfile::keyId;
+};
+
+} // anonymous namespace
+
+/** Test that events are accounted to the key of their name. */
+TEST(EventProfileTest, Record)
+{
+    TestProfile profile;
+    NamedEvent a("system.cpu.tickEvent");
+    NamedEvent b("system.mem.respondEvent");
+
+    profile.record(&a, EventProfile::now());
+    profile.record(&a, EventProfile::now());
+    profile.record(&b, EventProfile::now());
+
+    const uint32_t a_id = TestProfile::keyId(a);
+    const uint32_t b_id = TestProfile::keyId(b);
+    ASSERT_NE(a_id, 0);
+    ASSERT_NE(b_id, 0);
+    ASSERT_NE(a_id, b_id);
+    EXPECT_EQ(EventProfile::key(a_id), "system.cpu.tickEvent");
+    EXPECT_EQ(EventProfile::key(b_id), "system.mem.respondEvent");
+
+    const auto &entries = profile.getEntries();
+    ASSERT_GT(entries.size(), std::max(a_id, b_id));
+    EXPECT_EQ(entries[a_id].events, 2);
+    EXPECT_EQ(entries[b_id].events, 1);
+}
+
+/** Test that events with the same name share a key. */
+TEST(EventProfileTest, SameName)
+{
+    TestProfile profile;
+    NamedEvent a("system.l2.sendEvent");
+    NamedEvent b("system.l2.sendEvent");
+
+    profile.record(&a, EventProfile::now());
+    profile.record(&b, EventProfile::now());
+
+    const uint32_t id = TestProfile::keyId(a);
+    EXPECT_EQ(TestProfile::keyId(b), id);
+    EXPECT_EQ(profile.getEntries()[id].events, 2);
+}
+
+/** Test that events without a name are keyed by their description. */
+TEST(EventProfileTest, Unnamed)
+{
+    TestProfile profile;
+    UnnamedEvent a;
+    UnnamedEvent b;
+
+    profile.record(&a, EventProfile::now());
+    profile.record(&b, EventProfile::now());
+
+    const uint32_t id = TestProfile::keyId(a);
+    EXPECT_EQ(EventProfile::key(id), "unnamed.unnamed test");
+    EXPECT_EQ(TestProfile::keyId(b), id);
+    EXPECT_EQ(profile.getEntries()[id].events, 2);
+}
+
+/** Test that the host time is accounted, and reset. */
+TEST(EventProfileTest, HostTicksAndReset)
+{
+    TestProfile profile;
+    NamedEvent a("system.cpu.fetchEvent");
+
+    const uint64_t start = EventProfile::now();
+    uint64_t end = start;
+    while (end - start < 1000)
+        end = EventProfile::now();
+    profile.record(&a, start);
+
+    const uint32_t id = TestProfile::keyId(a);
+    EXPECT_GE(profile.getEntries()[id].hostTicks, 1000);
+
+    profile.reset();
+    EXPECT_EQ(profile.getEntries()[id].events, 0);
+    EXPECT_EQ(profile.getEntries()[id].hostTicks, 0);
+}
+
+/** Test that an invalid key id has no key. */
+TEST(EventProfileTest, InvalidKey)
+{
+    EXPECT_EQ(EventProfile::key(0), "");
+    EXPECT_EQ(EventProfile::key(-1), "");
+}
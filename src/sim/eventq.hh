@@ -57,6 +57,7 @@ namespace gem5
 
 class EventQueue;       // forward declaration
 class BaseGlobalEvent;
+class EventProfile;
 
 //! Simulation Quantum for multiple eventq simulation.
 //! The quantum value is the period length after which the queues
@@ -251,6 +252,7 @@ class EventBase
 class Event : public EventBase, public Serializable
 {
     friend class EventQueue;
+    friend class EventProfile;
 
   private:
     // The event queue is now a linked list of linked lists.  The
@@ -272,6 +274,11 @@ class Event : public EventBase, public Serializable
     Priority _priority; //!< event priority
     Flags flags;
 
+    /// Key the host time spent processing this event is accounted to
+    /// when profiling, 0 until first processed (see EventProfile).
+    /// It fits in the padding after the flags.
+    uint32_t profileId;
+
 #ifndef NDEBUG
     /// Global counter to generate unique IDs for Event instances
     static Counter instanceCounter;
@@ -413,7 +420,7 @@ class Event : public EventBase, public Serializable
      */
     Event(Priority p = Default_Pri, Flags f = 0)
         : nextBin(nullptr), nextInBin(nullptr), _when(0), _priority(p),
-          flags(Initialized | f)
+          flags(Initialized | f), profileId(0)
     {
         assert(f.noneSet(~PublicWrite));
 #ifndef NDEBUG
@@ -628,6 +635,9 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
+    //! Host time profile of the events serviced, if enabled.
+    EventProfile *profile;
+
     //! Mutex to protect async queue.
     UncontendedMutex async_queue_mutex;
 
@@ -669,6 +679,13 @@ class EventQueue
     EventQueue(const EventQueue &);
 
   public:
+    /**
+     * Account the host time spent processing events to a profile, or
+     * stop profiling them if null.
+     */
+    void setProfile(EventProfile *p) { profile = p; }
+    EventProfile *getProfile() const { return profile; }
+
     class ScopedMigration
     {
       public:
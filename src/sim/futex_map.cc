@@ -58,6 +58,8 @@ FutexMap::suspend(Addr addr, uint64_t tgid, ThreadContext *tc)
 int
 FutexMap::wakeup(Addr addr, uint64_t tgid, int count)
 {
+    std::lock_guard<std::mutex> lock(futexMutex);
+
     FutexKey key(addr, tgid);
     auto it = find(key);
 
@@ -89,6 +91,8 @@ void
 FutexMap::suspend_bitset(Addr addr, uint64_t tgid, ThreadContext *tc,
                int bitmask)
 {
+    std::lock_guard<std::mutex> lock(futexMutex);
+
     FutexKey key(addr, tgid);
     auto it = find(key);
 
@@ -107,6 +111,8 @@ FutexMap::suspend_bitset(Addr addr, uint64_t tgid, ThreadContext *tc,
 int
 FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
 {
+    std::lock_guard<std::mutex> lock(futexMutex);
+
     FutexKey key(addr, tgid);
     auto it = find(key);
 
@@ -140,6 +146,8 @@ FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
 int
 FutexMap::requeue(Addr addr1, uint64_t tgid, int count, int count2, Addr addr2)
 {
+    std::lock_guard<std::mutex> lock(futexMutex);
+
     FutexKey key1(addr1, tgid);
     auto it1 = find(key1);
 
@@ -184,6 +192,7 @@ FutexMap::requeue(Addr addr1, uint64_t tgid, int count, int count2, Addr addr2)
 bool
 FutexMap::is_waiting(ThreadContext *tc)
 {
+    std::lock_guard<std::mutex> lock(futexMutex);
     return waitingTcs.find(tc) != waitingTcs.end();
 }
 
@@ -29,6 +29,7 @@
 #ifndef __FUTEX_MAP_HH__
 #define __FUTEX_MAP_HH__
 
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -141,6 +142,12 @@ class FutexMap : public std::unordered_map<FutexKey, WaiterList>
   private:
 
     std::unordered_set<ThreadContext *> waitingTcs;
+
+    /**
+     * Futex syscalls are serialized, but is_waiting() is also called when
+     * an interrupt is posted, possibly from another event queue.
+     */
+    std::mutex futexMutex;
 };
 
 } // namespace gem5
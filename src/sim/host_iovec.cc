@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/host_iovec.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+HostIoVec::HostIoVec(Addr page_size, Lookup _lookup,
+        const std::vector<memory::BackingStoreEntry> &backing_store,
+        Access _access, bool allowed)
+    : pageSize(page_size), lookup(std::move(_lookup)),
+      backingStore(backing_store), access(_access), _valid(allowed)
+{
+}
+
+uint8_t *
+HostIoVec::hostAddr(Addr paddr, Addr size) const
+{
+    for (const auto &store: backingStore) {
+        if (store.pmem && !store.range.interleaved() &&
+                store.range.contains(paddr) &&
+                store.range.contains(paddr + size - 1)) {
+            return store.pmem + (paddr - store.range.start());
+        }
+    }
+    return nullptr;
+}
+
+void
+HostIoVec::add(Addr addr, size_t size)
+{
+    if (!_valid || size == 0)
+        return;
+
+    const Addr end = addr + size;
+    if (end < addr) {
+        _valid = false;
+        return;
+    }
+
+    // Pages the target may not access as the transfers would are left to
+    // the BufferArg path
+    uint64_t denied = EmulationPageTable::Uncacheable;
+    if (access == WriteTarget)
+        denied |= EmulationPageTable::ReadOnly;
+
+    for (Addr vaddr = addr; vaddr < end; ) {
+        const Addr page = roundDown(vaddr, pageSize);
+        const Addr chunk = std::min(end, page + pageSize) - vaddr;
+
+        const EmulationPageTable::Entry *entry = lookup(vaddr);
+        if (!entry || (entry->flags & denied)) {
+            _valid = false;
+            return;
+        }
+
+        uint8_t *host_addr = hostAddr(entry->paddr + (vaddr - page), chunk);
+        if (!host_addr) {
+            _valid = false;
+            return;
+        }
+
+        // Pages contiguous in the host memory share a range
+        if (!iov.empty() &&
+                (uint8_t *)iov.back().iov_base + iov.back().iov_len ==
+                host_addr) {
+            iov.back().iov_len += chunk;
+        } else {
+            iov.push_back({host_addr, chunk});
+        }
+        vaddr += chunk;
+    }
+}
+
+template <typename Op>
+ssize_t
+HostIoVec::transfer(Op op)
+{
+    assert(_valid);
+    size_t done = 0;
+    for (size_t i = 0; i < iov.size(); ) {
+        const int count = std::min<size_t>(iov.size() - i, IOV_MAX);
+        size_t batch = 0;
+        for (int j = 0; j < count; ++j)
+            batch += iov[i + j].iov_len;
+
+        ssize_t ret = op(&iov[i], count, done);
+        if (ret < 0)
+            return done ? done : -1;
+        done += ret;
+        if ((size_t)ret < batch)
+            break;
+        i += count;
+    }
+    return done;
+}
+
+ssize_t
+HostIoVec::readFrom(int fd)
+{
+    assert(access == WriteTarget);
+    return transfer([fd](const struct iovec *v, int count, size_t) {
+        return ::readv(fd, v, count);
+    });
+}
+
+ssize_t
+HostIoVec::readFrom(int fd, off_t offset)
+{
+    assert(access == WriteTarget);
+    return transfer([fd, offset](const struct iovec *v, int count,
+                                 size_t done) {
+        return ::preadv(fd, v, count, offset + done);
+    });
+}
+
+ssize_t
+HostIoVec::writeTo(int fd)
+{
+    return transfer([fd](const struct iovec *v, int count, size_t) {
+        return ::writev(fd, v, count);
+    });
+}
+
+ssize_t
+HostIoVec::writeTo(int fd, off_t offset)
+{
+    return transfer([fd, offset](const struct iovec *v, int count,
+                                 size_t done) {
+        return ::pwritev(fd, v, count, offset + done);
+    });
+}
+
+} // namespace gem5
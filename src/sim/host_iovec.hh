@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_HOST_IOVEC_HH__
+#define __SIM_HOST_IOVEC_HH__
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <functional>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/page_table.hh"
+#include "mem/physical.hh"
+
+namespace gem5
+{
+
+/**
+ * HostIoVec gives the host memory backing buffers in target user space,
+ * so that emulated syscalls can transfer data between host files and
+ * guest memory directly with scatter/gather I/O, instead of going
+ * through an intermediate BufferArg and a port proxy.
+ *
+ * This bypasses the caches, so it is only used when the process allows
+ * it or the system bypasses the caches. The vector is also invalid if
+ * any part of the buffers is not mapped, is not backed by host memory,
+ * is uncacheable, or is read-only and would be written, in which case
+ * callers fall back to a BufferArg, which handles page faults.
+ */
+class HostIoVec
+{
+  public:
+    /** How the transfers access the buffers in target memory. */
+    enum Access
+    {
+        /** The buffers are written to a file, e.g. by write() */
+        ReadTarget,
+        /** The buffers are read into from a file, e.g. by read() */
+        WriteTarget
+    };
+
+    /** Page table entry of a target address, nullptr if not mapped. */
+    typedef std::function<const EmulationPageTable::Entry *(Addr)> Lookup;
+
+    /**
+     * An empty vector of buffers translated by 'lookup', with pages of
+     * 'page_size' bytes, into the host memory of 'backing_store'.
+     *
+     * @param allowed Whether direct access is allowed, the vector being
+     *        invalid otherwise
+     */
+    HostIoVec(Addr page_size, Lookup lookup,
+              const std::vector<memory::BackingStoreEntry> &backing_store,
+              Access access, bool allowed);
+
+    /**
+     * Append the buffer of 'size' bytes at target address 'addr',
+     * invalidating the vector if it cannot all be accessed directly.
+     */
+    void add(Addr addr, size_t size);
+
+    /** Whether the buffers can be accessed directly. */
+    bool valid() const { return _valid; }
+
+    /**
+     * Read from a host file into the buffers, like readv() or preadv()
+     * but without a limit on the number of host memory ranges.
+     * @return The number of bytes read, or -1 with errno set if the
+     * first transfer failed.
+     */
+    ssize_t readFrom(int fd);
+    ssize_t readFrom(int fd, off_t offset);
+
+    /**
+     * Write the buffers to a host file, like writev() or pwritev().
+     * @return The number of bytes written, or -1 with errno set if the
+     * first transfer failed.
+     */
+    ssize_t writeTo(int fd);
+    ssize_t writeTo(int fd, off_t offset);
+
+  private:
+    /**
+     * Issue an I/O operation on batches of at most IOV_MAX ranges until
+     * all of them are transferred or a transfer is short.
+     */
+    template <typename Op>
+    ssize_t transfer(Op op);
+
+    /** Host address of a physical range, nullptr if not backed. */
+    uint8_t *hostAddr(Addr paddr, Addr size) const;
+
+    const Addr pageSize;
+    Lookup lookup;
+    std::vector<memory::BackingStoreEntry> backingStore;
+    const Access access;
+    bool _valid;
+    std::vector<struct iovec> iov;
+};
+
+} // namespace gem5
+
+#endif // __SIM_HOST_IOVEC_HH__
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "sim/host_iovec.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const Addr PageSize = 0x1000;
+
+/**
+ * Target memory of four physical pages backed by a host buffer. Target
+ * pages 0 and 1 map physical pages 2 and 3, which are contiguous on the
+ * host, and target page 2 maps physical page 0.
+ */
+class HostIoVecTest : public testing::Test
+{
+  protected:
+    HostIoVecTest()
+        : host(4 * PageSize, 0),
+          backingStore{memory::BackingStoreEntry(
+              AddrRange(0, 4 * PageSize), host.data(), false, true, false)}
+    {
+        map(0, 2 * PageSize);
+        map(PageSize, 3 * PageSize);
+        map(2 * PageSize, 0);
+    }
+
+    void
+    SetUp() override
+    {
+        ASSERT_EQ(pipe(fds), 0);
+    }
+
+    void
+    TearDown() override
+    {
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    /** Map a target page */
+    void
+    map(Addr vaddr, Addr paddr, uint64_t flags=0)
+    {
+        pageTable.emplace(vaddr, EmulationPageTable::Entry(paddr, flags));
+    }
+
+    /** An empty vector translating with the page table of the test */
+    HostIoVec
+    ioVec(HostIoVec::Access access, bool allowed=true)
+    {
+        return HostIoVec(PageSize, [this](Addr vaddr) {
+            auto it = pageTable.find(vaddr & ~(PageSize - 1));
+            return it == pageTable.end() ? nullptr : &it->second;
+        }, backingStore, access, allowed);
+    }
+
+    /** Host address of a target address */
+    uint8_t *
+    hostAddr(Addr vaddr)
+    {
+        auto it = pageTable.find(vaddr & ~(PageSize - 1));
+        EXPECT_NE(it, pageTable.end());
+        return host.data() + it->second.paddr + (vaddr & (PageSize - 1));
+    }
+
+    std::vector<uint8_t> host;
+    std::vector<memory::BackingStoreEntry> backingStore;
+    std::map<Addr, EmulationPageTable::Entry> pageTable;
+    int fds[2];
+};
+
+} // anonymous namespace
+
+/** Data read from a file is scattered over the target pages */
+TEST_F(HostIoVecTest, ReadAcrossPages)
+{
+    const Addr start = PageSize - 4;
+    const std::string data = "0123456789abcdef";
+
+    HostIoVec iov = ioVec(HostIoVec::WriteTarget);
+    iov.add(start, data.size());
+    iov.add(2 * PageSize + PageSize - 4, 4);
+    ASSERT_TRUE(iov.valid());
+
+    ASSERT_EQ(write(fds[1], data.data(), data.size()), data.size());
+    ASSERT_EQ(write(fds[1], "wxyz", 4), 4);
+    ASSERT_EQ(iov.readFrom(fds[0]), data.size() + 4);
+
+    ASSERT_EQ(std::memcmp(hostAddr(start), "0123", 4), 0);
+    ASSERT_EQ(std::memcmp(hostAddr(PageSize), "456789abcdef", 12), 0);
+    ASSERT_EQ(std::memcmp(hostAddr(3 * PageSize - 4), "wxyz", 4), 0);
+}
+
+/** Data written to a file is gathered from the target pages */
+TEST_F(HostIoVecTest, WriteAcrossPages)
+{
+    std::memcpy(hostAddr(2 * PageSize - 2), "ab", 2);
+    std::memcpy(hostAddr(2 * PageSize), "cd", 2);
+
+    HostIoVec iov = ioVec(HostIoVec::ReadTarget);
+    iov.add(2 * PageSize - 2, 4);
+    ASSERT_TRUE(iov.valid());
+    ASSERT_EQ(iov.writeTo(fds[1]), 4);
+
+    char buf[4];
+    ASSERT_EQ(read(fds[0], buf, sizeof(buf)), 4);
+    ASSERT_EQ(std::memcmp(buf, "abcd", 4), 0);
+}
+
+/** Direct access must be allowed by the process or the system */
+TEST_F(HostIoVecTest, NotAllowed)
+{
+    HostIoVec iov = ioVec(HostIoVec::WriteTarget, false);
+    iov.add(0, 16);
+    ASSERT_FALSE(iov.valid());
+}
+
+/** A buffer partly unmapped is left to the BufferArg path */
+TEST_F(HostIoVecTest, Unmapped)
+{
+    HostIoVec iov = ioVec(HostIoVec::ReadTarget);
+    iov.add(3 * PageSize - 8, 16);
+    ASSERT_FALSE(iov.valid());
+}
+
+/** A buffer not backed by host memory is left to the BufferArg path */
+TEST_F(HostIoVecTest, NotBacked)
+{
+    map(3 * PageSize, 8 * PageSize);
+    HostIoVec iov = ioVec(HostIoVec::ReadTarget);
+    iov.add(3 * PageSize, 16);
+    ASSERT_FALSE(iov.valid());
+}
+
+/** Read-only pages may be written to files, but not read into */
+TEST_F(HostIoVecTest, ReadOnly)
+{
+    map(3 * PageSize, PageSize, EmulationPageTable::ReadOnly);
+
+    HostIoVec read_target = ioVec(HostIoVec::ReadTarget);
+    read_target.add(3 * PageSize, 16);
+    ASSERT_TRUE(read_target.valid());
+
+    HostIoVec write_target = ioVec(HostIoVec::WriteTarget);
+    write_target.add(3 * PageSize, 16);
+    ASSERT_FALSE(write_target.valid());
+}
+
+/** Uncacheable pages are never accessed directly */
+TEST_F(HostIoVecTest, Uncacheable)
+{
+    map(3 * PageSize, PageSize, EmulationPageTable::Uncacheable);
+
+    HostIoVec iov = ioVec(HostIoVec::ReadTarget);
+    iov.add(3 * PageSize, 16);
+    ASSERT_FALSE(iov.valid());
+}
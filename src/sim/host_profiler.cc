@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/host_profiler.hh"
+
+#include <algorithm>
+#include <map>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "sim/core.hh"
+#include "sim/root.hh"
+
+namespace gem5
+{
+
+HostProfiler::HostProfiler(const Params &p)
+    : SimObject(p), startHostTicks(0), stats(*this)
+{
+}
+
+void
+HostProfiler::init()
+{
+    SimObject::init();
+
+    for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+        EventQueue *eq = mainEventQueue[i];
+        fatal_if(eq->getProfile(), "%s: %s is already being profiled.\n",
+                 name(), eq->name());
+        profiles.emplace_back(new EventProfile);
+        eq->setProfile(profiles.back().get());
+    }
+
+    startHostTicks = EventProfile::now();
+    startTime = std::chrono::steady_clock::now();
+
+    if (!params().flame_graph.empty()) {
+        registerExitCallback([this]() {
+            OutputStream *os = simout.create(params().flame_graph);
+            writeFlameGraph(*os->stream());
+            simout.close(os);
+        });
+    }
+}
+
+void
+HostProfiler::addOwners(const statistics::Group &group)
+{
+    for (const auto &child : group.getStatGroups()) {
+        if (auto *obj = dynamic_cast<const SimObject *>(child.second)) {
+            if (ownerIds.emplace(obj->name(), owners.size()).second)
+                owners.push_back(obj->name());
+        }
+        addOwners(*child.second);
+    }
+}
+
+size_t
+HostProfiler::owner(uint32_t key_id)
+{
+    if (key_id >= keyOwners.size())
+        keyOwners.resize(key_id + 1, owners.size());
+    if (keyOwners[key_id] < owners.size())
+        return keyOwners[key_id];
+
+    // The owner is the SimObject whose name is the longest prefix of the
+    // name of the event.
+    size_t owner_id = 0;
+    std::string key = EventProfile::key(key_id);
+    while (!key.empty()) {
+        auto it = ownerIds.find(key);
+        if (it != ownerIds.end()) {
+            owner_id = it->second;
+            break;
+        }
+        const auto pos = key.rfind('.');
+        if (pos == std::string::npos)
+            break;
+        key.resize(pos);
+    }
+
+    keyOwners[key_id] = owner_id;
+    return owner_id;
+}
+
+double
+HostProfiler::hostTickFrequency() const
+{
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - startTime;
+    if (elapsed.count() <= 0)
+        return 1;
+    return (EventProfile::now() - startHostTicks) / elapsed.count();
+}
+
+void
+HostProfiler::preDumpStats()
+{
+    SimObject::preDumpStats();
+
+    std::vector<uint64_t> events(owners.size(), 0);
+    std::vector<uint64_t> host_ticks(owners.size(), 0);
+    for (const auto &profile : profiles) {
+        const auto &entries = profile->getEntries();
+        for (uint32_t id = 1; id < entries.size(); ++id) {
+            if (!entries[id].events)
+                continue;
+            const size_t o = owner(id);
+            events[o] += entries[id].events;
+            host_ticks[o] += entries[id].hostTicks;
+        }
+    }
+
+    const double frequency = hostTickFrequency();
+    for (size_t o = 0; o < owners.size(); ++o) {
+        stats.events[o] = events[o];
+        stats.hostTicks[o] = host_ticks[o];
+        stats.hostSeconds[o] = host_ticks[o] / frequency;
+    }
+}
+
+void
+HostProfiler::resetStats()
+{
+    SimObject::resetStats();
+
+    for (auto &profile : profiles)
+        profile->reset();
+}
+
+void
+HostProfiler::writeFlameGraph(std::ostream &os) const
+{
+    std::map<std::string, uint64_t> stacks;
+    for (const auto &profile : profiles) {
+        const auto &entries = profile->getEntries();
+        for (uint32_t id = 1; id < entries.size(); ++id) {
+            if (!entries[id].hostTicks)
+                continue;
+            std::string stack = EventProfile::key(id);
+            std::replace(stack.begin(), stack.end(), '.', ';');
+            stacks[stack] += entries[id].hostTicks;
+        }
+    }
+
+    for (const auto &stack : stacks)
+        os << stack.first << " " << stack.second << "\n";
+}
+
+HostProfiler::ProfilerStats::ProfilerStats(HostProfiler &_profiler)
+    : statistics::Group(&_profiler),
+      profiler(_profiler),
+      ADD_STAT(events, statistics::units::Count::get(),
+               "Number of events processed for every SimObject"),
+      ADD_STAT(hostTicks, statistics::units::Count::get(),
+               "Host time stamp counter ticks (nanoseconds on hosts "
+               "without one) spent processing the events of every "
+               "SimObject"),
+      ADD_STAT(hostSeconds, statistics::units::Second::get(),
+               "Host time spent processing the events of every "
+               "SimObject"),
+      ADD_STAT(hostShare, statistics::units::Ratio::get(),
+               "Share of the host time spent processing events spent on "
+               "the events of every SimObject")
+{
+}
+
+void
+HostProfiler::ProfilerStats::regStats()
+{
+    statistics::Group::regStats();
+
+    using namespace statistics;
+
+    // All the stat groups are bound by now, collect the SimObjects from
+    // the root of the hierarchy.
+    profiler.owners.assign(1, "other");
+    profiler.ownerIds.clear();
+    profiler.addOwners(*Root::root());
+
+    const size_t num_owners = profiler.owners.size();
+    events.init(num_owners).flags(nozero);
+    hostTicks.init(num_owners).flags(nozero);
+    hostSeconds.init(num_owners).flags(nozero);
+    for (size_t o = 0; o < num_owners; ++o) {
+        events.subname(o, profiler.owners[o]);
+        hostTicks.subname(o, profiler.owners[o]);
+        hostSeconds.subname(o, profiler.owners[o]);
+        hostShare.subname(o, profiler.owners[o]);
+    }
+
+    hostShare.flags(nozero | nonan);
+    hostShare = hostTicks / sum(hostTicks);
+}
+
+} // namespace gem5
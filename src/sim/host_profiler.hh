@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_HOST_PROFILER_HH__
+#define __SIM_HOST_PROFILER_HH__
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "params/HostProfiler.hh"
+#include "sim/event_profile.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+/**
+ * Profiles the host time spent processing the events of all the event
+ * queues, and attributes it to the SimObjects owning the events. See
+ * HostProfiler.py.
+ */
+class HostProfiler : public SimObject
+{
+  protected:
+    /** Profiles of the main event queues */
+    std::vector<std::unique_ptr<EventProfile>> profiles;
+
+    /**
+     * SimObjects the events are attributed to, the first one being
+     * used for events no SimObject owns.
+     */
+    std::vector<std::string> owners;
+    std::unordered_map<std::string, size_t> ownerIds;
+
+    /** Owner of every profile key, looked up when first needed */
+    std::vector<size_t> keyOwners;
+
+    /** Host time and wall clock time when profiling started */
+    uint64_t startHostTicks;
+    std::chrono::steady_clock::time_point startTime;
+
+    struct ProfilerStats : public statistics::Group
+    {
+        ProfilerStats(HostProfiler &profiler);
+
+        void regStats() override;
+
+        HostProfiler &profiler;
+
+        statistics::Vector events;
+        statistics::Vector hostTicks;
+        statistics::Vector hostSeconds;
+        statistics::Formula hostShare;
+    } stats;
+
+    /** Add the SimObjects of a stat group and its sub-groups as owners */
+    void addOwners(const statistics::Group &group);
+
+    /** Owner of the events of a profile key */
+    size_t owner(uint32_t key_id);
+
+    /** Host ticks per second, measured since profiling started */
+    double hostTickFrequency() const;
+
+  public:
+    PARAMS(HostProfiler);
+    HostProfiler(const Params &p);
+
+    void init() override;
+    void preDumpStats() override;
+    void resetStats() override;
+
+    /**
+     * Write the host time spent in every event in the folded stacks
+     * format, one event per line with the components of its name as the
+     * frames of the stack.
+     */
+    void writeFlameGraph(std::ostream &os) const;
+};
+
+} // namespace gem5
+
+#endif // __SIM_HOST_PROFILER_HH__
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/image_writer.hh"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+ImageWriter::ImageWriter(Addr page_size, Lookup _lookup, Allocate _allocate,
+        const std::vector<memory::BackingStoreEntry> &backing_store,
+        Write write, bool map_files)
+    : pageSize(page_size), hostPageSize(sysconf(_SC_PAGESIZE)),
+      lookup(_lookup), allocate(_allocate), backingStore(backing_store),
+      fallbackWrite(write), mapFiles(map_files)
+{
+}
+
+Addr
+ImageWriter::translate(Addr vaddr) const
+{
+    const EmulationPageTable::Entry *entry = lookup(vaddr);
+    assert(entry);
+    return entry->paddr + (vaddr & (pageSize - 1));
+}
+
+const memory::BackingStoreEntry *
+ImageWriter::findStore(Addr vaddr, Addr size) const
+{
+    const Addr paddr = translate(vaddr);
+    for (const auto &entry : backingStore) {
+        if (!entry.range.interleaved() &&
+                entry.range.contains(paddr) &&
+                entry.range.contains(paddr + size - 1)) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+Addr
+ImageWriter::write(const loader::MemoryImage &img)
+{
+    Addr mapped = 0;
+
+    for (const auto &seg : img.segments()) {
+        if (!seg.size)
+            continue;
+
+        const Addr seg_end = seg.base + seg.size;
+        const Addr end = roundUp(seg_end, pageSize);
+
+        for (Addr run = roundDown(seg.base, pageSize); run < end;) {
+            // Pages mapped by another segment are written one at a
+            // time. Unmapped pages are allocated in a single,
+            // physically contiguous run.
+            Addr run_end = run + pageSize;
+            const bool fresh = !lookup(run);
+            if (fresh) {
+                while (run_end < end && !lookup(run_end))
+                    run_end += pageSize;
+                allocate(run, run_end - run);
+            }
+
+            const Addr lo = std::max(run, seg.base);
+            const Addr hi = std::min(run_end, seg_end);
+            const Addr len = hi - lo;
+            const uint8_t *src =
+                seg.data ? seg.data + (lo - seg.base) : nullptr;
+            run = run_end;
+
+            const auto *store = findStore(lo, len);
+            if (!store) {
+                fallbackWrite(lo, src, len);
+                continue;
+            }
+
+            uint8_t *dst =
+                store->pmem + (translate(lo) - store->range.start());
+            // Freshly allocated pages of an anonymous backing store are
+            // known to be zero and haven't been touched by the host.
+            const bool anon = fresh && store->shmFd == -1;
+
+            if (!src) {
+                // BSS, leave untouched anonymous pages to be zero-filled
+                // on demand by the host.
+                if (!anon)
+                    std::memset(dst, 0, len);
+                continue;
+            }
+
+            Addr copied = 0;
+            if (mapFiles && anon && seg.ifd) {
+                // Map the host pages entirely covered by the segment
+                // from the file, provided that they are aligned the
+                // same way in the file and in the backing store.
+                const Addr head = roundUp((Addr)dst, hostPageSize) -
+                    (Addr)dst;
+                const off_t offset = src + head - seg.ifd->data();
+                const Addr map_len = head < len ?
+                    roundDown(len - head, hostPageSize) : 0;
+                if (map_len && offset % hostPageSize == 0 &&
+                        mmap(dst + head, map_len, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_FIXED, seg.ifd->fd(),
+                             offset) != MAP_FAILED) {
+                    std::memcpy(dst, src, head);
+                    copied = head + map_len;
+                    mapped += map_len;
+                }
+            }
+            std::memcpy(dst + copied, src + copied, len - copied);
+
+            // Zero the rest of the last page explicitly, it is cheap and
+            // doesn't depend on the host never having touched it.
+            const Addr tail = roundUp(hi, pageSize) - hi;
+            if (anon && tail &&
+                    store->range.contains(translate(lo) + len + tail - 1)) {
+                std::memset(dst + len, 0, tail);
+            }
+        }
+    }
+
+    return mapped;
+}
+
+} // namespace gem5
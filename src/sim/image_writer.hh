@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_IMAGE_WRITER_HH__
+#define __SIM_IMAGE_WRITER_HH__
+
+#include <functional>
+#include <vector>
+
+#include "base/loader/memory_image.hh"
+#include "base/types.hh"
+#include "mem/page_table.hh"
+#include "mem/physical.hh"
+
+namespace gem5
+{
+
+/**
+ * ImageWriter loads memory images, such as the segments of a binary,
+ * into the address space of an SE process.
+ *
+ * Instead of writing the image through a port proxy page by page, the
+ * pages of each segment are allocated in physically contiguous runs and
+ * written directly into the backing store of the simulated memory.
+ * Freshly allocated pages of an anonymous backing store have never been
+ * touched by the host, so they are known to be zero, and the BSS in them
+ * is not written at all.
+ *
+ * Optionally, host pages entirely covered by file data are mapped
+ * copy-on-write from the image file, so they are only read from disk
+ * when touched. Pages the guest didn't write to keep reading from the
+ * file, so it must not change while the process runs.
+ */
+class ImageWriter
+{
+  public:
+    /** Page table entry of a target address, nullptr if not mapped. */
+    typedef std::function<const EmulationPageTable::Entry *(Addr)> Lookup;
+
+    /**
+     * Map 'size' bytes of unmapped pages at target address 'vaddr' to
+     * physically contiguous pages.
+     */
+    typedef std::function<void(Addr vaddr, Addr size)> Allocate;
+
+    /**
+     * Write 'size' bytes of 'data' at target address 'vaddr', or zeros
+     * if 'data' is nullptr, for memory without a backing store.
+     */
+    typedef std::function<void(Addr vaddr, const uint8_t *data,
+                               Addr size)> Write;
+
+    /**
+     * @param map_files Map whole host pages from the image files instead
+     * of copying them
+     */
+    ImageWriter(Addr page_size, Lookup lookup, Allocate allocate,
+                const std::vector<memory::BackingStoreEntry> &backing_store,
+                Write write, bool map_files);
+
+    /**
+     * Load a memory image, allocating the pages it needs.
+     * @return The number of bytes mapped from image files.
+     */
+    Addr write(const loader::MemoryImage &img);
+
+  private:
+    /**
+     * Backing store of a physically contiguous range of target memory,
+     * nullptr if there is none.
+     */
+    const memory::BackingStoreEntry *findStore(Addr vaddr, Addr size) const;
+
+    /** Physical address of a mapped target address. */
+    Addr translate(Addr vaddr) const;
+
+    const Addr pageSize;
+    const Addr hostPageSize;
+    Lookup lookup;
+    Allocate allocate;
+    std::vector<memory::BackingStoreEntry> backingStore;
+    Write fallbackWrite;
+    const bool mapFiles;
+};
+
+} // namespace gem5
+
+#endif // __SIM_IMAGE_WRITER_HH__
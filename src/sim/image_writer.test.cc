@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/loader/image_file_data.hh"
+#include "base/loader/memory_image.hh"
+#include "sim/image_writer.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/**
+ * The target and host pages have the same size, so that target pages can
+ * be mapped from the image file.
+ */
+const Addr PageSize = sysconf(_SC_PAGESIZE);
+const Addr NumPages = 8;
+
+/** Where the binary is loaded, and the size of its sections */
+const Addr TextBase = 16 * PageSize;
+const Addr TextSize = 2 * PageSize + PageSize / 2;
+const Addr BssSize = PageSize + PageSize / 2;
+
+/**
+ * Target memory of NumPages physical pages, allocated in order, in an
+ * anonymous host mapping, and an image file holding the text of a
+ * binary.
+ */
+class ImageWriterTest : public testing::Test
+{
+  protected:
+    void
+    SetUp() override
+    {
+        host = (uint8_t *)mmap(nullptr, NumPages * PageSize,
+                               PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(host, MAP_FAILED);
+
+        char name[] = "image-writer-XXXXXX";
+        int fd = mkstemp(name);
+        ASSERT_NE(fd, -1);
+        filename = name;
+        contents.resize(4 * PageSize);
+        for (size_t i = 0; i < contents.size(); i++)
+            contents[i] = i * 7 + i / PageSize;
+        ASSERT_EQ(write(fd, contents.data(), contents.size()),
+                  contents.size());
+        close(fd);
+
+        file = std::make_shared<loader::ImageFileData>(filename);
+    }
+
+    void
+    TearDown() override
+    {
+        file.reset();
+        unlink(filename.c_str());
+        munmap(host, NumPages * PageSize);
+    }
+
+    /** The text of the binary at 'offset' in the file, followed by BSS */
+    loader::MemoryImage
+    binary(Addr offset)
+    {
+        return loader::MemoryImage({
+            {"text", TextBase, file, offset, TextSize},
+            {"bss", TextBase + TextSize, BssSize}});
+    }
+
+    /**
+     * A writer into the host memory, with a shared memory descriptor,
+     * if any, or through the fallback if there is no backing store.
+     */
+    ImageWriter
+    writer(bool has_store, int shm_fd=-1, bool map_files=true)
+    {
+        std::vector<memory::BackingStoreEntry> backing_store;
+        if (has_store) {
+            backing_store.emplace_back(AddrRange(0, NumPages * PageSize),
+                                       host, false, true, false, shm_fd);
+        }
+
+        return ImageWriter(PageSize,
+            [this](Addr vaddr) -> const EmulationPageTable::Entry * {
+                auto it = pageTable.find(vaddr & ~(PageSize - 1));
+                return it == pageTable.end() ? nullptr : &it->second;
+            },
+            [this](Addr vaddr, Addr size) {
+                for (Addr page = 0; page < size; page += PageSize) {
+                    pageTable.emplace(vaddr + page,
+                        EmulationPageTable::Entry(nextPaddr, 0));
+                    nextPaddr += PageSize;
+                }
+            },
+            backing_store,
+            [this](Addr vaddr, const uint8_t *data, Addr size) {
+                for (Addr i = 0; i < size; i++)
+                    host[translate(vaddr + i)] = data ? data[i] : 0;
+            }, map_files);
+    }
+
+    /** Physical address of a target address */
+    Addr
+    translate(Addr vaddr)
+    {
+        auto it = pageTable.find(vaddr & ~(PageSize - 1));
+        EXPECT_NE(it, pageTable.end());
+        return it->second.paddr + (vaddr & (PageSize - 1));
+    }
+
+    /** Check the text loaded from 'offset' in the file, and a zero BSS */
+    void
+    checkBinary(Addr offset)
+    {
+        for (Addr i = 0; i < TextSize; i++) {
+            ASSERT_EQ(host[translate(TextBase + i)], contents[offset + i])
+                << "at text offset " << i;
+        }
+        for (Addr i = 0; i < BssSize; i++) {
+            ASSERT_EQ(host[translate(TextBase + TextSize + i)], 0)
+                << "at bss offset " << i;
+        }
+    }
+
+    uint8_t *host = nullptr;
+    std::string filename;
+    std::vector<uint8_t> contents;
+    loader::ImageFileDataPtr file;
+    std::map<Addr, EmulationPageTable::Entry> pageTable;
+    Addr nextPaddr = 0;
+};
+
+} // anonymous namespace
+
+/**
+ * Whole pages of text aligned in the file are mapped from it, without
+ * modifying the file when the guest writes to them.
+ */
+TEST_F(ImageWriterTest, MapFromFile)
+{
+    ASSERT_EQ(writer(true).write(binary(0)), 2 * PageSize);
+    checkBinary(0);
+
+    host[translate(TextBase)] ^= 0xff;
+    EXPECT_EQ(file->data()[0], contents[0]);
+}
+
+/** Nothing is mapped from the file unless asked to */
+TEST_F(ImageWriterTest, CopyWithoutMapping)
+{
+    ASSERT_EQ(writer(true, -1, false).write(binary(0)), 0);
+    checkBinary(0);
+}
+
+/** Text which isn't page aligned in the file is copied */
+TEST_F(ImageWriterTest, CopyUnaligned)
+{
+    ASSERT_EQ(writer(true).write(binary(64)), 0);
+    checkBinary(64);
+}
+
+/**
+ * Memory shared with other processes may not be zero, and is written
+ * explicitly.
+ */
+TEST_F(ImageWriterTest, SharedBackingStore)
+{
+    std::memset(host, 0xff, NumPages * PageSize);
+    ASSERT_EQ(writer(true, 0).write(binary(0)), 0);
+    checkBinary(0);
+}
+
+/** Memory without a backing store is written through the fallback */
+TEST_F(ImageWriterTest, NoBackingStore)
+{
+    std::memset(host, 0xff, NumPages * PageSize);
+    ASSERT_EQ(writer(false).write(binary(0)), 0);
+    checkBinary(0);
+}
+
+/**
+ * Segments sharing a page, and pages already mapped, are written in
+ * place.
+ */
+TEST_F(ImageWriterTest, PreviouslyMapped)
+{
+    ImageWriter image_writer = writer(true);
+    ASSERT_EQ(image_writer.write(binary(0)), 2 * PageSize);
+    std::memset(host, 0xff, NumPages * PageSize);
+    ASSERT_EQ(image_writer.write(binary(PageSize)), 0);
+    checkBinary(PageSize);
+}
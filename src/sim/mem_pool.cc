@@ -151,6 +151,7 @@ MemPools::populate(const AddrRangeList &memories)
 Addr
 MemPools::allocPhysPages(int npages, int pool_id)
 {
+    std::lock_guard<std::mutex> lock(allocMutex);
     return pools[pool_id].allocate(npages);
 }
 
@@ -32,6 +32,7 @@
 #ifndef __MEM_POOL_HH__
 #define __MEM_POOL_HH__
 
+#include <mutex>
 #include <vector>
 
 #include "base/addr_range.hh"
@@ -90,6 +91,9 @@ class MemPools : public Serializable
 
     std::vector<MemPool> pools;
 
+    /** Serializes allocations from processes on different event queues. */
+    std::mutex allocMutex;
+
   public:
     MemPools(Addr page_shift) : pageShift(page_shift) {}
 
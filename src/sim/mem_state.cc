@@ -59,6 +59,8 @@ MemState::operator=(const MemState &in)
     if (this == &in)
         return *this;
 
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+
     _pageBytes = in._pageBytes;
     _brkPoint = in._brkPoint;
     _stackBase = in._stackBase;
@@ -82,6 +84,8 @@ MemState::resetOwner(Process *owner)
 bool
 MemState::isUnmapped(Addr start_addr, Addr length)
 {
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+
     Addr end_addr = start_addr + length;
     const AddrRange range(start_addr, end_addr);
     for (const auto &vma : _vmaList) {
@@ -107,6 +111,8 @@ MemState::isUnmapped(Addr start_addr, Addr length)
 void
 MemState::updateBrkRegion(Addr old_brk, Addr new_brk)
 {
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+
     /**
      * To make this simple, avoid reducing the heap memory area if the
      * new_brk point is less than the old_brk; this occurs when the heap is
@@ -167,6 +173,8 @@ void
 MemState::mapRegion(Addr start_addr, Addr length,
                     const std::string& region_name, int sim_fd, Addr offset)
 {
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+
     DPRINTF(Vma, "memstate: creating vma (%s) [0x%x - 0x%x]\n",
             region_name.c_str(), start_addr, start_addr + length);
 
@@ -186,6 +194,8 @@ MemState::mapRegion(Addr start_addr, Addr length,
 void
 MemState::unmapRegion(Addr start_addr, Addr length)
 {
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+
     Addr end_addr = start_addr + length;
     const AddrRange range(start_addr, end_addr);
 
@@ -283,6 +293,8 @@ MemState::unmapRegion(Addr start_addr, Addr length)
 void
 MemState::remapRegion(Addr start_addr, Addr new_start_addr, Addr length)
 {
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+
     Addr end_addr = start_addr + length;
     const AddrRange range(start_addr, end_addr);
 
@@ -386,6 +398,8 @@ MemState::remapRegion(Addr start_addr, Addr new_start_addr, Addr length)
 bool
 MemState::fixupFault(Addr vaddr)
 {
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+
     /**
      * Check if we are accessing a mapped virtual address. If so then we
      * just haven't allocated it a physical page yet and can do so here.
@@ -451,6 +465,8 @@ MemState::fixupFault(Addr vaddr)
 Addr
 MemState::extendMmap(Addr length)
 {
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+
     Addr start = _mmapEnd;
 
     if (_ownerProcess->mmapGrowsDown())
@@ -479,6 +495,8 @@ MemState::extendMmap(Addr length)
 std::string
 MemState::printVmaList()
 {
+    std::lock_guard<std::recursive_mutex> lock(_lock);
+
     std::stringstream file_content;
 
     for (auto vma : _vmaList) {
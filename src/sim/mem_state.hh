@@ -31,6 +31,7 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -279,6 +280,13 @@ class MemState : public Serializable
      * support this or the unmapping method must be changed.
      */
     std::list<VMA> _vmaList;
+
+    /**
+     * The threads of a process may be simulated on different event
+     * queues and fault on the address space concurrently. Recursive as
+     * the region updates are built on top of each other.
+     */
+    std::recursive_mutex _lock;
 };
 
 } // namespace gem5
@@ -57,11 +57,13 @@
 #include "base/statistics.hh"
 #include "cpu/thread_context.hh"
 #include "mem/page_table.hh"
+#include "mem/physical.hh"
 #include "mem/se_translating_port_proxy.hh"
 #include "params/Process.hh"
 #include "sim/emul_driver.hh"
 #include "sim/fd_array.hh"
 #include "sim/fd_entry.hh"
+#include "sim/image_writer.hh"
 #include "sim/redirect_path.hh"
 #include "sim/se_workload.hh"
 #include "sim/syscall_desc.hh"
@@ -116,6 +118,8 @@ Process::Process(const ProcessParams &params, EmulationPageTable *pTable,
       seWorkload(dynamic_cast<SEWorkload *>(system->workload)),
       useArchPT(params.useArchPT),
       kvmInSE(params.kvmInSE),
+      zeroCopySyscalls(params.zeroCopySyscalls),
+      mapBinary(params.mapBinary),
       useForClone(false),
       pTable(pTable),
       objFile(obj_file),
@@ -302,8 +306,8 @@ Process::initState()
                 tc, SETranslatingPortProxy::Always));
 
     // load object file into target memory
-    image.write(*initVirtMem);
-    interpImage.write(*initVirtMem);
+    writeImage(image);
+    writeImage(interpImage);
 }
 
 DrainState
@@ -343,6 +347,22 @@ Process::allocateMem(Addr vaddr, int64_t size, bool clobber)
                           EmulationPageTable::MappingFlags(0));
 }
 
+void
+Process::writeImage(const loader::MemoryImage &img)
+{
+    ImageWriter writer(pTable->pageSize(),
+        [this](Addr vaddr) { return pTable->lookup(vaddr); },
+        [this](Addr vaddr, Addr size) { allocateMem(vaddr, size); },
+        system->getPhysMem().getBackingStore(),
+        [this](Addr vaddr, const uint8_t *data, Addr size) {
+            if (data)
+                initVirtMem->writeBlob(vaddr, data, size);
+            else
+                initVirtMem->memsetBlob(vaddr, 0, size);
+        }, mapBinary);
+    writer.write(img);
+}
+
 void
 Process::replicatePage(Addr vaddr, Addr new_paddr, ThreadContext *old_tc,
                        ThreadContext *new_tc, bool allocate_page)
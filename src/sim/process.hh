@@ -121,6 +121,13 @@ class Process : public SimObject
     // requested, and may configure more if necessary.
     void allocateMem(Addr vaddr, int64_t size, bool clobber=false);
 
+    /**
+     * Load a memory image into the address space of the process, mapping
+     * it from its file where possible if mapBinary is set (see
+     * ImageWriter).
+     */
+    void writeImage(const loader::MemoryImage &img);
+
     /// Attempt to fix up a fault at vaddr by allocating a page on the stack.
     /// @return Whether the fault has been fixed.
     bool fixupFault(Addr vaddr);
@@ -179,6 +186,10 @@ class Process : public SimObject
     bool useArchPT;
     // running KVM requires special initialization
     bool kvmInSE;
+    // issue host I/O of syscalls directly to the guest memory
+    bool zeroCopySyscalls;
+    // map the binary from its file instead of copying it
+    bool mapBinary;
     // flag for using the process as a thread which shares page tables
     bool useForClone;
 
@@ -70,6 +70,7 @@
 #include "sim/stat_control.hh"
 #include "sim/stats.hh"
 #include "sim/system.hh"
+#include "sim/trace_trigger.hh"
 
 namespace gem5
 {
@@ -468,6 +469,13 @@ togglesync(ThreadContext *tc)
     DistIface::toggleSync(tc);
 }
 
+void
+traceTrigger(ThreadContext *tc, uint64_t enable)
+{
+    DPRINTF(PseudoInst, "pseudo_inst::traceTrigger(%i)\n", enable);
+    TraceTrigger::pseudoOpTrigger(tc, enable);
+}
+
 void
 triggerWorkloadEvent(ThreadContext *tc)
 {
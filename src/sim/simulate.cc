@@ -48,6 +48,7 @@
 
 #include "base/logging.hh"
 #include "base/pollevent.hh"
+#include "base/stats/storage.hh"
 #include "base/types.hh"
 #include "sim/async.hh"
 #include "sim/eventq.hh"
@@ -101,7 +102,8 @@ class SimulatorThreads
             // We'll call these the "subordinate" threads.
             for (uint32_t i = 1; i < numQueues; i++) {
                 threads.emplace_back(
-                    [this](EventQueue *eq) {
+                    [this, i](EventQueue *eq) {
+                        statistics::setShard(i);
                         thread_main(eq);
                     }, mainEventQueue[i]);
             }
@@ -29,20 +29,105 @@
 
 #include "sim/syscall_desc.hh"
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "base/types.hh"
+#include "cpu/base.hh"
 #include "sim/eventq.hh"
+#include "sim/global_event.hh"
 #include "sim/syscall_debug_macros.hh"
+#include "sim/system.hh"
 
 namespace gem5
 {
 
 class ThreadContext;
 
+namespace
+{
+
+/**
+ * Runs a system call while the simulation threads of all the event
+ * queues are stopped at a barrier. Syscalls update state shared by the
+ * threads of a process (address space, file descriptors, futexes) and
+ * may wake up contexts simulated on other event queues, so this is how
+ * they are serialized when the CPUs are spread across queues. Being a
+ * GlobalSyncEvent, every queue picks up the events the syscall scheduled
+ * on it before resuming.
+ */
+class SyscallBarrierEvent : public GlobalSyncEvent
+{
+  public:
+    std::function<void()> callback;
+
+    SyscallBarrierEvent() : GlobalSyncEvent(Default_Pri, 0) {}
+
+    void process() override;
+
+    const char *description() const override { return "syscall barrier"; }
+};
+
+/**
+ * A global event can't be deleted while the other threads may still be
+ * leaving its barrier. They have all left it once they reach the barrier
+ * of the next syscall, which is when the events are deleted.
+ */
+std::vector<std::unique_ptr<SyscallBarrierEvent>> retiredBarriers;
+
+void
+SyscallBarrierEvent::process()
+{
+    // Only one global event is processed at a time, and always with the
+    // other threads stopped, so no lock is needed.
+    retiredBarriers.clear();
+
+    auto func = std::move(callback);
+    callback = nullptr;
+    func();
+
+    retiredBarriers.emplace_back(this);
+}
+
+/**
+ * Whether the syscall may interact with contexts simulated on another
+ * event queue. The threads of a process are spread over the contexts of
+ * its system: clone() starts them on any free context, and futexes,
+ * exit_group() or kill() act on the contexts of the whole system.
+ */
+bool
+spansEventQueues(ThreadContext *tc)
+{
+    if (!inParallelMode)
+        return false;
+
+    EventQueue *eventq = tc->getCpuPtr()->eventQueue();
+    for (auto *other : tc->getSystemPtr()->threads) {
+        if (other->getCpuPtr()->eventQueue() != eventq)
+            return true;
+    }
+    return false;
+}
+
+} // anonymous namespace
+
 void
 SyscallDesc::doSyscall(ThreadContext *tc)
 {
     DPRINTF_SYSCALL(Base, "Calling %s...\n", dumper(name(), tc));
 
+    if (spansEventQueues(tc)) {
+        // Other event queues may be simulating threads of the same
+        // process, defer the syscall to the next barrier. Like any other
+        // cross queue event, it has to be at least a quantum away.
+        tc->suspend();
+        DPRINTF_SYSCALL(Base, "%s deferred to a global barrier.\n", name());
+        setupBarrier(tc, curTick() + simQuantum);
+        return;
+    }
+
     SyscallReturn retval = executor(this, tc);
 
     if (retval.needsRetry()) {
@@ -79,15 +164,35 @@ SyscallDesc::retrySyscall(ThreadContext *tc)
 void
 SyscallDesc::setupRetry(ThreadContext *tc)
 {
+    // Schedule it in about 100 CPU cycles. That will give other contexts
+    // a chance to execute a bit of code before trying again.
+    auto *cpu = tc->getCpuPtr();
+    Tick when = curTick() + cpu->cyclesToTicks(Cycles(100));
+
+    if (spansEventQueues(tc)) {
+        setupBarrier(tc, std::max(when, curTick() + simQuantum));
+        return;
+    }
+
     // Create an event which will retry the system call later.
     auto retry = [this, tc]() { retrySyscall(tc); };
     auto *event = new EventFunctionWrapper(retry, name(), true);
+    curEventQueue()->schedule(event, when);
+}
 
-    // Schedule it in about 100 CPU cycles. That will give other contexts
-    // a chance to execute a bit of code before trying again.
-    auto *cpu = tc->getCpuPtr();
-    curEventQueue()->schedule(event,
-            curTick() + cpu->cyclesToTicks(Cycles(100)));
+void
+SyscallDesc::setupBarrier(ThreadContext *tc, Tick when)
+{
+    auto retry = [this, tc]() {
+        // Whichever thread runs the barrier, execute the syscall in the
+        // context of the event queue of the calling thread.
+        EventQueue::ScopedMigration migrate(tc->getCpuPtr()->eventQueue());
+        retrySyscall(tc);
+    };
+
+    auto *event = new SyscallBarrierEvent;
+    event->callback = retry;
+    event->schedule(when);
 }
 
 void
@@ -103,6 +103,13 @@ class SyscallDesc
     int _num;
 
     void setupRetry(ThreadContext *tc);
+
+    /**
+     * Schedule the (re)execution of the syscall at a global barrier, used
+     * when the CPUs are simulated on several event queues.
+     */
+    void setupBarrier(ThreadContext *tc, Tick when);
+
     void handleReturn(ThreadContext *tc, const SyscallReturn &ret);
 
     /** Mechanism for ISAs to connect to the emul function definitions */
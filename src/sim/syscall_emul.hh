@@ -58,7 +58,9 @@
 
 #if defined(__linux__)
 #include <sched.h>
+#include <sys/epoll.h>
 #include <sys/eventfd.h>
+#include <sys/sendfile.h>
 #include <sys/statfs.h>
 
 #else
@@ -82,7 +84,9 @@
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cerrno>
+#include <climits>
 #include <memory>
 #include <string>
 
@@ -1763,10 +1767,20 @@ readvFunc(SyscallDesc *desc, ThreadContext *tc,
 
     SETranslatingPortProxy prox(tc);
     typename OS::tgt_iovec tiov[count];
+    prox.readBlob(tiov_base, tiov, count * sizeof(typename OS::tgt_iovec));
+
+    HostIoVec host_iov = targetIoVec(tc, HostIoVec::WriteTarget);
+    for (typename OS::size_t i = 0; i < count; ++i) {
+        host_iov.add(gtoh(tiov[i].iov_base, OS::byteOrder),
+                     gtoh(tiov[i].iov_len, OS::byteOrder));
+    }
+    if (host_iov.valid()) {
+        ssize_t result = host_iov.readFrom(sim_fd);
+        return (result == -1) ? -errno : result;
+    }
+
     struct iovec hiov[count];
     for (typename OS::size_t i = 0; i < count; ++i) {
-        prox.readBlob(tiov_base + (i * sizeof(typename OS::tgt_iovec)),
-                      &tiov[i], sizeof(typename OS::tgt_iovec));
         hiov[i].iov_len = gtoh(tiov[i].iov_len, OS::byteOrder);
         hiov[i].iov_base = new char [hiov[i].iov_len];
     }
@@ -1800,16 +1814,25 @@ writevFunc(SyscallDesc *desc, ThreadContext *tc,
     int sim_fd = hbfdp->getSimFD();
 
     SETranslatingPortProxy prox(tc);
-    struct iovec hiov[count];
+    typename OS::tgt_iovec tiov[count];
+    prox.readBlob(tiov_base, tiov, count * sizeof(typename OS::tgt_iovec));
+
+    HostIoVec host_iov = targetIoVec(tc, HostIoVec::ReadTarget);
     for (typename OS::size_t i = 0; i < count; ++i) {
-        typename OS::tgt_iovec tiov;
+        host_iov.add(gtoh(tiov[i].iov_base, OS::byteOrder),
+                     gtoh(tiov[i].iov_len, OS::byteOrder));
+    }
+    if (host_iov.valid()) {
+        ssize_t result = host_iov.writeTo(sim_fd);
+        return (result == -1) ? -errno : result;
+    }
 
-        prox.readBlob(tiov_base + i*sizeof(typename OS::tgt_iovec),
-                      &tiov, sizeof(typename OS::tgt_iovec));
-        hiov[i].iov_len = gtoh(tiov.iov_len, OS::byteOrder);
+    struct iovec hiov[count];
+    for (typename OS::size_t i = 0; i < count; ++i) {
+        hiov[i].iov_len = gtoh(tiov[i].iov_len, OS::byteOrder);
         hiov[i].iov_base = new char [hiov[i].iov_len];
-        prox.readBlob(gtoh(tiov.iov_base, OS::byteOrder), hiov[i].iov_base,
-                      hiov[i].iov_len);
+        prox.readBlob(gtoh(tiov[i].iov_base, OS::byteOrder),
+                      hiov[i].iov_base, hiov[i].iov_len);
     }
 
     int result = writev(sim_fd, hiov, count);
@@ -1975,9 +1998,16 @@ pread64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    HostIoVec host_buf =
+        targetIoVec(tc, HostIoVec::WriteTarget, bufPtr, nbytes);
+    if (host_buf.valid()) {
+        ssize_t bytes_read = host_buf.readFrom(sim_fd, offset);
+        return (bytes_read == -1) ? -errno : bytes_read;
+    }
+
     BufferArg bufArg(bufPtr, nbytes);
 
-    int bytes_read = pread(sim_fd, bufArg.bufferPtr(), nbytes, offset);
+    ssize_t bytes_read = pread(sim_fd, bufArg.bufferPtr(), nbytes, offset);
 
     bufArg.copyOut(SETranslatingPortProxy(tc));
 
@@ -1996,10 +2026,18 @@ pwrite64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    HostIoVec host_buf =
+        targetIoVec(tc, HostIoVec::ReadTarget, bufPtr, nbytes);
+    if (host_buf.valid()) {
+        ssize_t bytes_written = host_buf.writeTo(sim_fd, offset);
+        return (bytes_written == -1) ? -errno : bytes_written;
+    }
+
     BufferArg bufArg(bufPtr, nbytes);
     bufArg.copyIn(SETranslatingPortProxy(tc));
 
-    int bytes_written = pwrite(sim_fd, bufArg.bufferPtr(), nbytes, offset);
+    ssize_t bytes_written =
+        pwrite(sim_fd, bufArg.bufferPtr(), nbytes, offset);
 
     return (bytes_written == -1) ? -errno : bytes_written;
 }
@@ -2636,8 +2674,15 @@ readFunc(SyscallDesc *desc, ThreadContext *tc,
         && !(hbfdp->getFlags() & OS::TGT_O_NONBLOCK))
         return SyscallReturn::retry();
 
+    HostIoVec host_buf =
+        targetIoVec(tc, HostIoVec::WriteTarget, buf_ptr, nbytes);
+    if (host_buf.valid()) {
+        ssize_t bytes_read = host_buf.readFrom(sim_fd);
+        return (bytes_read == -1) ? -errno : bytes_read;
+    }
+
     BufferArg buf_arg(buf_ptr, nbytes);
-    int bytes_read = read(sim_fd, buf_arg.bufferPtr(), nbytes);
+    ssize_t bytes_read = read(sim_fd, buf_arg.bufferPtr(), nbytes);
 
     if (bytes_read > 0)
         buf_arg.copyOut(SETranslatingPortProxy(tc));
@@ -2657,9 +2702,6 @@ writeFunc(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = hbfdp->getSimFD();
 
-    BufferArg buf_arg(buf_ptr, nbytes);
-    buf_arg.copyIn(SETranslatingPortProxy(tc));
-
     struct pollfd pfd;
     pfd.fd = sim_fd;
     pfd.events = POLLOUT;
@@ -2676,7 +2718,16 @@ writeFunc(SyscallDesc *desc, ThreadContext *tc,
             return SyscallReturn::retry();
     }
 
-    int bytes_written = write(sim_fd, buf_arg.bufferPtr(), nbytes);
+    ssize_t bytes_written;
+    HostIoVec host_buf =
+        targetIoVec(tc, HostIoVec::ReadTarget, buf_ptr, nbytes);
+    if (host_buf.valid()) {
+        bytes_written = host_buf.writeTo(sim_fd);
+    } else {
+        BufferArg buf_arg(buf_ptr, nbytes);
+        buf_arg.copyIn(SETranslatingPortProxy(tc));
+        bytes_written = write(sim_fd, buf_arg.bufferPtr(), nbytes);
+    }
 
     if (bytes_written != -1)
         fsync(sim_fd);
@@ -2817,7 +2868,12 @@ eventfdFunc(SyscallDesc *desc, ThreadContext *tc,
 #if defined(__linux__)
     auto p = tc->getProcessPtr();
 
-    int sim_fd = eventfd(initval, in_flags);
+    // EFD_CLOEXEC and EFD_NONBLOCK are the target open flags
+    int host_flags = in_flags & EFD_SEMAPHORE;
+    host_flags |= (in_flags & OS::TGT_O_CLOEXEC) ? EFD_CLOEXEC : 0;
+    host_flags |= (in_flags & OS::TGT_O_NONBLOCK) ? EFD_NONBLOCK : 0;
+
+    int sim_fd = eventfd(initval, host_flags);
     if (sim_fd == -1)
         return -errno;
 
@@ -2835,6 +2891,223 @@ eventfdFunc(SyscallDesc *desc, ThreadContext *tc,
 #endif
 }
 
+/// Target epoll_create1() handler.
+template <class OS>
+SyscallReturn
+epollCreate1Func(SyscallDesc *desc, ThreadContext *tc, int in_flags)
+{
+#if defined(__linux__)
+    auto p = tc->getProcessPtr();
+
+    // EPOLL_CLOEXEC is the target O_CLOEXEC
+    if (in_flags & ~OS::TGT_O_CLOEXEC)
+        return -EINVAL;
+    bool cloexec = in_flags & OS::TGT_O_CLOEXEC;
+
+    int sim_fd = epoll_create1(cloexec ? EPOLL_CLOEXEC : 0);
+    if (sim_fd == -1)
+        return -errno;
+
+    int flags = cloexec ? OS::TGT_O_CLOEXEC : 0;
+    auto hbfdp = std::make_shared<HBFDEntry>(flags, sim_fd, cloexec);
+    int tgt_fd = p->fds->allocFD(hbfdp);
+    return tgt_fd;
+#else
+    warnUnsupportedOS("epoll_create1");
+    return -1;
+#endif
+}
+
+/// Target epoll_create() handler.
+template <class OS>
+SyscallReturn
+epollCreateFunc(SyscallDesc *desc, ThreadContext *tc, int size)
+{
+    if (size <= 0)
+        return -EINVAL;
+    return epollCreate1Func<OS>(desc, tc, 0);
+}
+
+/// Target epoll_ctl() handler. The file descriptors are translated to
+/// host ones, while the user data of the event is passed through as is
+/// for epoll_wait() to return it.
+template <class OS>
+SyscallReturn
+epollCtlFunc(SyscallDesc *desc, ThreadContext *tc, int tgt_epfd, int op,
+             int tgt_fd, VPtr<typename OS::tgt_epoll_event> event_ptr)
+{
+#if defined(__linux__)
+    auto p = tc->getProcessPtr();
+
+    auto epfdp = std::dynamic_pointer_cast<HBFDEntry>((*p->fds)[tgt_epfd]);
+    if (!epfdp)
+        return -EBADF;
+    auto hbfdp = std::dynamic_pointer_cast<HBFDEntry>((*p->fds)[tgt_fd]);
+    if (!hbfdp)
+        return -EBADF;
+
+    struct epoll_event event = {};
+    if (op != EPOLL_CTL_DEL) {
+        if (!event_ptr)
+            return -EFAULT;
+        event.events = gtoh(event_ptr->events, OS::byteOrder);
+        event.data.u64 = gtoh(event_ptr->data, OS::byteOrder);
+    }
+
+    int result = epoll_ctl(epfdp->getSimFD(), op, hbfdp->getSimFD(), &event);
+    return (result == -1) ? -errno : 0;
+#else
+    warnUnsupportedOS("epoll_ctl");
+    return -1;
+#endif
+}
+
+/// Target epoll_pwait() handler. As for poll(), the host is never waited
+/// on: if no event is ready a finite timeout expires immediately, and an
+/// infinite one retries the syscall until an event or a signal arrives.
+/// The signal mask is ignored.
+template <class OS>
+SyscallReturn
+epollPwaitFunc(SyscallDesc *desc, ThreadContext *tc, int tgt_epfd,
+               VPtr<> events_ptr, int maxevents, int tmout, VPtr<> sigmask)
+{
+#if defined(__linux__)
+    auto p = tc->getProcessPtr();
+
+    auto epfdp = std::dynamic_pointer_cast<HBFDEntry>((*p->fds)[tgt_epfd]);
+    if (!epfdp)
+        return -EBADF;
+    typedef typename OS::tgt_epoll_event TgtEvent;
+    // The same bound as the Linux kernel, so the size of the target buffer
+    // cannot overflow
+    if (maxevents <= 0 || maxevents > INT_MAX / (int)sizeof(TgtEvent))
+        return -EINVAL;
+
+    // Returning fewer events than asked for is allowed, so the host buffer
+    // does not grow with what the target asks for
+    const int max_host_events = 1024;
+    std::vector<struct epoll_event> events(
+        std::min(maxevents, max_host_events));
+    int status = epoll_wait(epfdp->getSimFD(), events.data(), events.size(),
+                            0);
+    if (status == -1)
+        return -errno;
+
+    if (status == 0 && tmout < 0) {
+        System *sysh = tc->getSystemPtr();
+        for (auto &signal: sysh->signalList) {
+            if (signal.receiver == p)
+                return -EINTR;
+        }
+        return SyscallReturn::retry();
+    }
+
+    BufferArg events_buf(events_ptr, sizeof(TgtEvent) * status);
+    TgtEvent *tgt_events = (TgtEvent *)events_buf.bufferPtr();
+    for (int i = 0; i < status; i++) {
+        tgt_events[i].events = htog((uint32_t)events[i].events,
+                                    OS::byteOrder);
+        tgt_events[i].data = htog((uint64_t)events[i].data.u64,
+                                  OS::byteOrder);
+    }
+    events_buf.copyOut(SETranslatingPortProxy(tc));
+
+    return status;
+#else
+    warnUnsupportedOS("epoll_pwait");
+    return -1;
+#endif
+}
+
+/// Target epoll_wait() handler.
+template <class OS>
+SyscallReturn
+epollWaitFunc(SyscallDesc *desc, ThreadContext *tc, int tgt_epfd,
+              VPtr<> events_ptr, int maxevents, int tmout)
+{
+    return epollPwaitFunc<OS>(desc, tc, tgt_epfd, events_ptr, maxevents,
+                              tmout, 0);
+}
+
+/// Target sendfile() handler, also used for sendfile64() with a 64 bit
+/// offset on 32 bit targets. The data is copied by the host.
+template <class OS, typename OffT = typename OS::off_t>
+SyscallReturn
+sendfileFunc(SyscallDesc *desc, ThreadContext *tc, int tgt_out_fd,
+             int tgt_in_fd, VPtr<OffT> offset_ptr,
+             typename OS::size_t count)
+{
+#if defined(__linux__)
+    auto p = tc->getProcessPtr();
+
+    auto out_fdp = std::dynamic_pointer_cast<HBFDEntry>((*p->fds)[tgt_out_fd]);
+    if (!out_fdp)
+        return -EBADF;
+    auto in_fdp = std::dynamic_pointer_cast<HBFDEntry>((*p->fds)[tgt_in_fd]);
+    if (!in_fdp)
+        return -EBADF;
+
+    off_t offset = 0;
+    if (offset_ptr)
+        offset = gtoh(*offset_ptr, OS::byteOrder);
+
+    ssize_t result = sendfile(out_fdp->getSimFD(), in_fdp->getSimFD(),
+                              offset_ptr ? &offset : nullptr, count);
+    if (result == -1)
+        return -errno;
+
+    if (offset_ptr)
+        *offset_ptr = htog((OffT)offset, OS::byteOrder);
+    return result;
+#else
+    warnUnsupportedOS("sendfile");
+    return -1;
+#endif
+}
+
+/// Target copy_file_range() handler. The data is copied by the host.
+template <class OS>
+SyscallReturn
+copyFileRangeFunc(SyscallDesc *desc, ThreadContext *tc, int tgt_in_fd,
+                  VPtr<int64_t> in_offset_ptr, int tgt_out_fd,
+                  VPtr<int64_t> out_offset_ptr, typename OS::size_t len,
+                  unsigned flags)
+{
+#if defined(__linux__)
+    auto p = tc->getProcessPtr();
+
+    auto in_fdp = std::dynamic_pointer_cast<FileFDEntry>((*p->fds)[tgt_in_fd]);
+    if (!in_fdp)
+        return -EBADF;
+    auto out_fdp =
+        std::dynamic_pointer_cast<FileFDEntry>((*p->fds)[tgt_out_fd]);
+    if (!out_fdp)
+        return -EBADF;
+
+    loff_t in_offset = 0, out_offset = 0;
+    if (in_offset_ptr)
+        in_offset = gtoh(*in_offset_ptr, OS::byteOrder);
+    if (out_offset_ptr)
+        out_offset = gtoh(*out_offset_ptr, OS::byteOrder);
+
+    ssize_t result = copy_file_range(
+            in_fdp->getSimFD(), in_offset_ptr ? &in_offset : nullptr,
+            out_fdp->getSimFD(), out_offset_ptr ? &out_offset : nullptr,
+            len, flags);
+    if (result == -1)
+        return -errno;
+
+    if (in_offset_ptr)
+        *in_offset_ptr = htog((int64_t)in_offset, OS::byteOrder);
+    if (out_offset_ptr)
+        *out_offset_ptr = htog((int64_t)out_offset, OS::byteOrder);
+    return result;
+#else
+    warnUnsupportedOS("copy_file_range");
+    return -1;
+#endif
+}
+
 /// Target sched_getaffinity
 template <class OS>
 SyscallReturn
@@ -39,10 +39,13 @@
 
 #include "base/types.hh"
 #include "mem/se_translating_port_proxy.hh"
+#include "sim/host_iovec.hh"
 
 namespace gem5
 {
 
+class ThreadContext;
+
 /**
  * Base class for BufferArg and TypedBufferArg, Not intended to be
  * used directly.
@@ -168,6 +171,17 @@ class TypedBufferArg : public BaseBufferArg
     T &operator[](int i) { return ((T *)bufPtr)[i]; }
 };
 
+/**
+ * A HostIoVec for buffers in the memory of the process of 'tc'. Direct
+ * access is allowed if the process says no cache holds its syscall
+ * buffers, or if the system bypasses the caches.
+ */
+HostIoVec targetIoVec(ThreadContext *tc, HostIoVec::Access access);
+
+/** A HostIoVec for the buffer of 'size' bytes at target address 'addr'. */
+HostIoVec targetIoVec(ThreadContext *tc, HostIoVec::Access access,
+                      Addr addr, size_t size);
+
 } // namespace gem5
 
 #endif // __SIM_SYSCALL_EMUL_BUF_HH__
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/trace_trigger.hh"
+
+#include <algorithm>
+
+#include "base/debug.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "cpu/thread_context.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+std::vector<TraceTrigger *> TraceTrigger::pseudoOpTriggers;
+
+TraceTrigger::StartPCEvent::StartPCEvent(TraceTrigger &_trigger,
+                                         PCEventScope *scope, Addr pc)
+    : PCEvent(scope, _trigger.name() + ".startPCEvent", pc),
+      trigger(_trigger)
+{
+}
+
+void
+TraceTrigger::StartPCEvent::process(ThreadContext *tc)
+{
+    trigger.activate();
+}
+
+TraceTrigger::StatEvent::StatEvent(TraceTrigger &_trigger, Tick when)
+    : GlobalEvent(when, Default_Pri, 0), trigger(_trigger)
+{
+}
+
+void
+TraceTrigger::StatEvent::process()
+{
+    trigger.checkStat();
+}
+
+const char *
+TraceTrigger::StatEvent::description() const
+{
+    return "TraceTrigger stat check";
+}
+
+TraceTrigger::TraceTrigger(const Params &p)
+    : SimObject(p), system(p.system), ring(nullptr),
+      threadId(p.thread), startInsts(p.start_insts), startPC(p.start_pc),
+      statName(p.stat), statThreshold(p.stat_threshold),
+      statPeriod(p.stat_period), pseudoOp(p.pseudo_op), insts(p.insts),
+      duration(p.duration), active(false), thread(nullptr), stat(nullptr),
+      statAbove(false),
+      startInstEvent([this]{ activate(); }, name() + ".startInstEvent"),
+      stopInstEvent([this]{ deactivate(); }, name() + ".stopInstEvent"),
+      stopEvent([this]{ deactivate(); }, name() + ".stopEvent")
+{
+    for (const auto &flag_name : p.flags) {
+        debug::Flag *flag = debug::findFlag(flag_name);
+        fatal_if(!flag, "%s: Unknown debug flag '%s'.\n", name(), flag_name);
+        flags.push_back(flag);
+    }
+
+    fatal_if(!startInsts && startPC == MaxAddr && statName.empty() &&
+             !pseudoOp, "%s: No condition activates the trigger.\n",
+             name());
+    fatal_if(!statName.empty() && statPeriod == 0,
+             "%s: The stat period must not be zero.\n", name());
+
+    if (pseudoOp)
+        pseudoOpTriggers.push_back(this);
+}
+
+TraceTrigger::~TraceTrigger()
+{
+    auto it = std::find(pseudoOpTriggers.begin(), pseudoOpTriggers.end(),
+                        this);
+    if (it != pseudoOpTriggers.end())
+        pseudoOpTriggers.erase(it);
+}
+
+void
+TraceTrigger::startup()
+{
+    if (startInsts || insts) {
+        fatal_if(threadId >= system->threads.size(),
+                 "%s: The system has no thread %d.\n", name(), threadId);
+        thread = system->threads[threadId];
+    }
+
+    if (params().pre_trigger) {
+        // Messages are output by the ring logger once activated, the
+        // flags are enabled for the whole simulation.
+        ring = new Trace::RingLogger(Trace::getDebugLogger(),
+                                     params().pre_trigger);
+        Trace::setDebugLogger(ring);
+        for (auto *flag : flags)
+            flag->enable();
+    }
+
+    if (startInsts)
+        thread->scheduleInstCountEvent(&startInstEvent, startInsts);
+
+    if (startPC != MaxAddr)
+        startPCEvent.reset(new StartPCEvent(*this, system, startPC));
+
+    if (!statName.empty()) {
+        stat = system->resolveStat(statName);
+        fatal_if(!stat, "%s: Unknown stat '%s'.\n", name(), statName);
+        fatal_if(!dynamic_cast<const statistics::ScalarInfo *>(stat) &&
+                 !dynamic_cast<const statistics::VectorInfo *>(stat),
+                 "%s: Only the value of scalar and vector stats can be "
+                 "checked, '%s' is neither.\n", name(), statName);
+        statAbove = statValue() > statThreshold;
+        statEvent.reset(new StatEvent(*this, curTick() + statPeriod));
+    }
+}
+
+double
+TraceTrigger::statValue() const
+{
+    if (auto *scalar = dynamic_cast<const statistics::ScalarInfo *>(stat))
+        return scalar->result();
+    return static_cast<const statistics::VectorInfo *>(stat)->total();
+}
+
+void
+TraceTrigger::checkStat()
+{
+    // Only activate when the stat crosses the threshold, a stat that
+    // stays above it would otherwise keep activating the trigger.
+    const bool above = statValue() > statThreshold;
+    if (above && !statAbove)
+        activate();
+    statAbove = above;
+
+    // With several event queues, the event is only inserted in them at
+    // the next synchronization, at most a quantum away.
+    statEvent->schedule(curTick() + std::max(statPeriod, simQuantum));
+}
+
+void
+TraceTrigger::activate()
+{
+    if (active)
+        return;
+    active = true;
+
+    if (ring) {
+        ring->release();
+    } else {
+        for (auto *flag : flags)
+            flag->enable();
+    }
+
+    if (insts) {
+        thread->scheduleInstCountEvent(&stopInstEvent,
+                thread->getCurrentInstCount() + insts);
+    }
+    if (duration)
+        schedule(stopEvent, curTick() + duration);
+}
+
+void
+TraceTrigger::deactivate()
+{
+    if (!active)
+        return;
+    active = false;
+
+    if (ring) {
+        ring->record();
+    } else {
+        for (auto *flag : flags)
+            flag->disable();
+    }
+
+    if (stopInstEvent.scheduled())
+        thread->descheduleInstCountEvent(&stopInstEvent);
+    if (stopEvent.scheduled())
+        deschedule(stopEvent);
+}
+
+void
+TraceTrigger::pseudoOpTrigger(ThreadContext *tc, bool enable)
+{
+    bool handled = false;
+    for (auto *trigger : pseudoOpTriggers) {
+        if (trigger->system != tc->getSystemPtr())
+            continue;
+        if (enable)
+            trigger->activate();
+        else
+            trigger->deactivate();
+        handled = true;
+    }
+
+    warn_if_once(!handled, "No TraceTrigger handles the trace trigger "
+                 "pseudo-op, ignoring it.\n");
+}
+
+} // namespace gem5
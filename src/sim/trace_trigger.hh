@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 The Regents of The University of Michigan
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_TRACE_TRIGGER_HH__
+#define __SIM_TRACE_TRIGGER_HH__
+
+#include <memory>
+#include <vector>
+
+#include "base/stats/info.hh"
+#include "base/types.hh"
+#include "cpu/pc_event.hh"
+#include "params/TraceTrigger.hh"
+#include "sim/eventq.hh"
+#include "sim/global_event.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+class System;
+class ThreadContext;
+
+namespace debug
+{
+class Flag;
+} // namespace debug
+
+namespace Trace
+{
+class RingLogger;
+} // namespace Trace
+
+/**
+ * Enables a set of debug flags while a window of interest of the
+ * simulation, delimited by instruction counts, a PC, a stat or
+ * pseudo-ops, is being simulated. See TraceTrigger.py.
+ */
+class TraceTrigger : public SimObject
+{
+  protected:
+    class StartPCEvent : public PCEvent
+    {
+      protected:
+        TraceTrigger &trigger;
+
+      public:
+        StartPCEvent(TraceTrigger &_trigger, PCEventScope *scope, Addr pc);
+
+        void process(ThreadContext *tc) override;
+    };
+
+    /**
+     * Checks the stat with all the simulation threads synchronized, as
+     * the value of a stat updated by several threads is only exact then.
+     */
+    class StatEvent : public GlobalEvent
+    {
+      protected:
+        TraceTrigger &trigger;
+
+      public:
+        StatEvent(TraceTrigger &_trigger, Tick when);
+
+        void process() override;
+        const char *description() const override;
+    };
+
+    System *system;
+
+    std::vector<debug::Flag *> flags;
+
+    /** Flight recorder, if messages preceding the activation are kept */
+    Trace::RingLogger *ring;
+
+    const uint32_t threadId;
+    const Counter startInsts;
+    const Addr startPC;
+    const std::string statName;
+    const double statThreshold;
+    const Tick statPeriod;
+    const bool pseudoOp;
+    const Counter insts;
+    const Tick duration;
+
+    bool active;
+
+    ThreadContext *thread;
+
+    const statistics::Info *stat;
+    /** Whether the stat was above the threshold when last checked */
+    bool statAbove;
+
+    std::unique_ptr<StartPCEvent> startPCEvent;
+
+    /** Events scheduled on the instruction count queue of the thread */
+    EventFunctionWrapper startInstEvent;
+    EventFunctionWrapper stopInstEvent;
+
+    std::unique_ptr<StatEvent> statEvent;
+    EventFunctionWrapper stopEvent;
+
+    /** Triggers listening to the pseudo-op */
+    static std::vector<TraceTrigger *> pseudoOpTriggers;
+
+    /** Current value of the stat */
+    double statValue() const;
+
+    void checkStat();
+
+  public:
+    PARAMS(TraceTrigger);
+    TraceTrigger(const Params &p);
+    ~TraceTrigger();
+
+    void startup() override;
+
+    /** Start outputting debug messages, if not already doing so. */
+    void activate();
+
+    /** Stop outputting debug messages, and rearm the trigger. */
+    void deactivate();
+
+    bool isActive() const { return active; }
+
+    /**
+     * Handle the trace trigger pseudo-op executed by a thread.
+     *
+     * @param tc Thread executing the pseudo-op
+     * @param enable Whether to activate or deactivate the triggers
+     */
+    static void pseudoOpTrigger(ThreadContext *tc, bool enable);
+};
+
+} // namespace gem5
+
+#endif // __SIM_TRACE_TRIGGER_HH__
@@ -24,14 +24,27 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
+import argparse
+
 import m5
 from m5.objects import *
 m5.util.addToPath('../../../configs/')
 from common.Caches import *
 
+parser = argparse.ArgumentParser()
+parser.add_argument("--atomic", action="store_true",
+                    help="Use atomic (non-timing) mode")
+parser.add_argument("--bounded-snoop-filter", action="store_true",
+                    help="Bound the snoop filter of the L2 crossbar to a "
+                    "table much smaller than the lines cached by the L1s, "
+                    "so that lines are back-invalidated")
+parser.add_argument("--max-loads", type=int, default=100000,
+                    help="Number of loads of each tester")
+args = parser.parse_args()
+
 #MAX CORES IS 8 with the fals sharing method
 nb_cores = 8
-cpus = [MemTest(max_loads = 1e5, progress_interval = 1e4)
+cpus = [MemTest(max_loads = args.max_loads, progress_interval = 1e4)
         for i in range(nb_cores) ]
 
 # system simulated
@@ -49,6 +62,10 @@ system.cpu_clk_domain = SrcClockDomain(clock = '2GHz',
                                        voltage_domain = system.voltage_domain)
 
 system.toL2Bus = L2XBar(clk_domain = system.cpu_clk_domain)
+if args.bounded_snoop_filter:
+    system.toL2Bus.snoop_filter = SnoopFilter(lookup_latency = 0,
+                                              bounded = True,
+                                              entries = 64, assoc = 4)
 system.l2c = L2Cache(clk_domain = system.cpu_clk_domain, size='64kB', assoc=8)
 system.l2c.cpu_side = system.toL2Bus.mem_side_ports
 
@@ -74,7 +91,7 @@ system.physmem.port = system.membus.mem_side_ports
 # -----------------------
 
 root = Root( full_system = False, system = system )
-root.system.mem_mode = 'timing'
+root.system.mem_mode = 'atomic' if args.atomic else 'timing'
 
 m5.instantiate()
 exit_event = m5.simulate()
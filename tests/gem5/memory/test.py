@@ -31,6 +31,8 @@ TODO: Add stats checking
 
 from testlib import *
 
+import re
+
 gem5_verify_config(
     name='simple_mem_default',
     verifiers=(), # No need for verfiers this will return non-zero on fail
@@ -67,6 +69,44 @@ gem5_verify_config(
     valid_isas=(constants.null_tag,),
 )
 
+# A bounded snoop filter much smaller than the L1s keeps evicting lines,
+# and MemTest checks that no data is lost when back-invalidating them
+for mode, args in (('timing', []), ('atomic', ['--atomic'])):
+    gem5_verify_config(
+        name='memtest_bounded_snoop_filter_' + mode,
+        verifiers=(),
+        config=joinpath(getcwd(), 'memtest-run.py'),
+        config_args = ['--bounded-snoop-filter'] + args,
+        valid_isas=(constants.null_tag,),
+    )
+
+# The evicted lines must be invalidated in the L1s holding them. MemTest
+# never sends invalidations itself, so a snoop hit for an InvalidateReq
+# in an L1 is a back-invalidation from the L2 crossbar.
+for mode, args in (('timing', []), ('atomic', ['--atomic'])):
+    gem5_verify_config(
+        name='memtest_back_invalidation_' + mode,
+        verifiers=(
+            verifier.MatchFileRegex(
+                re.compile(r'system\.toL2Bus\.snoop_filter\.evictions'
+                           r'\s+[1-9]'),
+                ['stats.txt']),
+            verifier.MatchFileRegex(
+                re.compile(r'system\.toL2Bus\.snoop_filter\.'
+                           r'backInvalidations\s+[1-9]'),
+                ['stats.txt']),
+            verifier.MatchFileRegex(
+                re.compile(r'.*system\.cpu\d+\.l1c: handleSnoop: snoop hit '
+                           r'for InvalidateReq'),
+                ['cache.log']),
+        ),
+        config=joinpath(getcwd(), 'memtest-run.py'),
+        config_args = ['--bounded-snoop-filter', '--max-loads', '2000'] +
+            args,
+        gem5_args = ['--debug-flags=Cache', '--debug-file=cache.log'],
+        valid_isas=(constants.null_tag,),
+    )
+
 null_tests = [
     ('garnet_synth_traffic', None, ['--sim-cycles', '5000000']),
     ('memcheck', None, ['--maxtick', '2000000000', '--prefetchers']),
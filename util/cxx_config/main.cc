@@ -54,6 +54,7 @@
  */
 
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
@@ -84,6 +85,10 @@ usage(const std::string &prog_name)
         "    -v <object> <param> <values> -- set a vector parameter from"
         " a comma\n"
         "                                    separated values string\n"
+        "    -o <object>.<param>=<value>  -- set a (vector) parameter\n"
+        "    -O <file>                    -- set the parameters assigned in"
+        " file,\n"
+        "                                    one -o assignment per line\n"
         "    -d <flag>                    -- set a debug flag (-<flag>\n"
         "                                    clear a flag)\n"
         "    -s <dir> <ticks>             -- save checkpoint to dir after"
@@ -163,6 +168,22 @@ main(int argc, char **argv)
                 config_manager->setParamVector(argv[arg_ptr],
                     argv[arg_ptr + 1], values);
                 arg_ptr += 3;
+            } else if (option == "-o") {
+                if (num_args < 1)
+                    usage(prog_name);
+                config_manager->applyOverride(argv[arg_ptr]);
+                arg_ptr++;
+            } else if (option == "-O") {
+                if (num_args < 1)
+                    usage(prog_name);
+                std::ifstream overrides(argv[arg_ptr]);
+                if (!overrides) {
+                    std::cerr << "Can't open overrides file: " <<
+                        argv[arg_ptr] << '\n';
+                    return EXIT_FAILURE;
+                }
+                config_manager->applyOverrides(overrides);
+                arg_ptr++;
             } else if (option == "-d") {
                 if (num_args < 1)
                     usage(prog_name);
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of The University of Michigan
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Decode a binary debug trace written with --debug-binary to the usual
+# text format. The decoder is part of gem5, so the script is run as a
+# gem5 configuration script, e.g.:
+#
+#   gem5.opt util/decode_debug_trace.py m5out/trace.bin trace.txt
+#
+# Format flags passed to gem5 are honored, e.g., running it with
+# --debug-flags=FmtFlag prefixes every message with its debug flag.
+
+import argparse
+
+import m5
+
+parser = argparse.ArgumentParser(
+    description="Decode a binary gem5 debug trace to text.")
+parser.add_argument("trace", help="Binary trace written with --debug-binary")
+parser.add_argument("output", nargs="?", default="cout",
+                    help="Text file to write to [Default: %(default)s]")
+args = parser.parse_args()
+
+messages = m5.trace.decode(args.trace, args.output)
+if args.output != "cout":
+    print("Decoded %d messages to %s" % (messages, args.output))
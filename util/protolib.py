@@ -71,14 +71,31 @@
 import gzip
 import struct
 
+# Magic number at the start of every zstd frame
+ZSTD_MAGIC = b'\x28\xb5\x2f\xfd'
+
 def openFileRd(in_file):
     """
     This opens the file passed as argument for reading using an appropriate
-    function depending on if it is gzipped or not. It returns the file
-    handle.
+    function depending on if it is gzipped, zstd compressed or not. It
+    returns the file handle.
     """
     try:
-        # First see if this file is gzipped
+        # zstd files are made of one frame per chunk followed by a seek
+        # table, which the reader skips over
+        with open(in_file, 'rb') as f:
+            is_zstd = f.read(4) == ZSTD_MAGIC
+        if is_zstd:
+            try:
+                import zstandard
+            except ImportError:
+                print("The zstandard module is needed to read ", in_file)
+                exit(-1)
+            dctx = zstandard.ZstdDecompressor()
+            return dctx.stream_reader(open(in_file, 'rb'),
+                                      read_across_frames=True)
+
+        # Then see if this file is gzipped
         try:
             # Opening the file works even if it is not a gzip file
             proto_in = gzip.open(in_file, 'rb')